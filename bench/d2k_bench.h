@@ -0,0 +1,35 @@
+#ifndef D2K_BENCH_H__
+#define D2K_BENCH_H__
+
+#include <time.h>
+
+static inline uint64_t bench_now_ns(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((uint64_t)ts.tv_sec * 1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+static inline void bench_report(const char *name, uint64_t elapsed_ns,
+                                                  size_t operations) {
+  printf("%-32s %12zu ops %10.2f ns/op\n",
+    name,
+    operations,
+    (double)elapsed_ns / (double)operations
+  );
+}
+
+/*
+ * Small deterministic PRNG so runs are comparable between builds and
+ * machines.
+ */
+static inline uint32_t bench_random(uint32_t *seed) {
+  *seed = (*seed * 1103515245) + 12345;
+
+  return (*seed >> 16) & 0x7FFF;
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
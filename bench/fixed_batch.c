@@ -0,0 +1,80 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * Per-tic movement math for a crowd of actors: scale momentum, divide out
+ * slopes, measure distances and find facing angles, with each available
+ * implementation.
+ */
+
+#define ACTOR_COUNT 4096
+#define TIC_COUNT   2000
+
+static void bench_impl(const char *name, D2KFixedPoint *out,
+                                         D2KAngle *angles,
+                                         const D2KFixedPoint *a,
+                                         const D2KFixedPoint *b) {
+  char label[64];
+  uint64_t start;
+
+  snprintf(label, sizeof(label), "fixed_batch: %s mul", name);
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    d2k_fixed_batch_mul(out, a, b, ACTOR_COUNT);
+  }
+  bench_report(label, bench_now_ns() - start, TIC_COUNT * ACTOR_COUNT);
+
+  snprintf(label, sizeof(label), "fixed_batch: %s div", name);
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    d2k_fixed_batch_div(out, a, b, ACTOR_COUNT);
+  }
+  bench_report(label, bench_now_ns() - start, TIC_COUNT * ACTOR_COUNT);
+
+  snprintf(label, sizeof(label), "fixed_batch: %s distance", name);
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    d2k_fixed_batch_approx_distance(out, a, b, ACTOR_COUNT);
+  }
+  bench_report(label, bench_now_ns() - start, TIC_COUNT * ACTOR_COUNT);
+
+  snprintf(label, sizeof(label), "fixed_batch: %s angle", name);
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    d2k_fixed_batch_point_to_angle(angles, d2k_tantoangle, a, b,
+                                                           ACTOR_COUNT);
+  }
+  bench_report(label, bench_now_ns() - start, TIC_COUNT * ACTOR_COUNT);
+}
+
+bool bench_fixed_batch(Status *status) {
+  static D2KFixedPoint a[ACTOR_COUNT];
+  static D2KFixedPoint b[ACTOR_COUNT];
+  static D2KFixedPoint out[ACTOR_COUNT];
+  static D2KAngle angles[ACTOR_COUNT];
+  D2KFixedBatchImpl best = d2k_fixed_batch_impl();
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < ACTOR_COUNT; i++) {
+    a[i] = (D2KFixedPoint)((bench_random(&seed) << 8) - (1 << 22));
+    b[i] = (D2KFixedPoint)((bench_random(&seed) << 4) + FRACUNIT);
+  }
+
+  for (int i = 0; i < D2K_FIXED_BATCH_IMPL_MAX; i++) {
+    if (!d2k_fixed_batch_impl_supported((D2KFixedBatchImpl)i)) {
+      continue;
+    }
+
+    if (!d2k_fixed_batch_use_impl((D2KFixedBatchImpl)i, status)) {
+      return false;
+    }
+
+    bench_impl(d2k_fixed_batch_impl_name((D2KFixedBatchImpl)i),
+      out, angles, a, b
+    );
+  }
+
+  return d2k_fixed_batch_use_impl(best, status);
+}
+
+/* vi: set et ts=2 sw=2: */
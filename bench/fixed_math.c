@@ -0,0 +1,54 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * Slope and momentum divisions like the ones movement and line-of-sight code
+ * does every tic, through the 64-bit integer and double-precision paths.
+ */
+
+#define DIVISION_COUNT 4096
+#define ROUND_COUNT    2000
+
+bool bench_fixed_math(Status *status) {
+  static D2KFixedPoint a[DIVISION_COUNT];
+  static D2KFixedPoint b[DIVISION_COUNT];
+  uint32_t seed = 1;
+  uint32_t int64_sum = 0;
+  uint32_t double_sum = 0;
+  uint64_t start;
+
+  for (size_t i = 0; i < DIVISION_COUNT; i++) {
+    a[i] = (D2KFixedPoint)((bench_random(&seed) << 8) - (1 << 22));
+    b[i] = (D2KFixedPoint)((bench_random(&seed) << 4) + FRACUNIT);
+  }
+
+  start = bench_now_ns();
+  for (size_t round = 0; round < ROUND_COUNT; round++) {
+    for (size_t i = 0; i < DIVISION_COUNT; i++) {
+      int64_sum += (uint32_t)d2k_fixed_div_int64(a[i], b[i]);
+    }
+  }
+  bench_report("fixed_div: int64", bench_now_ns() - start,
+    ROUND_COUNT * DIVISION_COUNT
+  );
+
+  start = bench_now_ns();
+  for (size_t round = 0; round < ROUND_COUNT; round++) {
+    for (size_t i = 0; i < DIVISION_COUNT; i++) {
+      double_sum += (uint32_t)d2k_fixed_div(a[i], b[i]);
+    }
+  }
+  bench_report("fixed_div: double", bench_now_ns() - start,
+    ROUND_COUNT * DIVISION_COUNT
+  );
+
+  if (int64_sum != double_sum) {
+    return status_error(status, "d2k_bench", 1,
+      "fixed_div implementations differ"
+    );
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,52 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * Hashing an IWAD-sized buffer, with XXH64 and with the byte-at-a-time FNV-1a
+ * that used to key the DeHackEd cache.
+ */
+
+#define DATA_SIZE  (12 * 1024 * 1024)
+#define PASS_COUNT 8
+
+static uint64_t fnv1a(const unsigned char *data, size_t size) {
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+bool bench_hash(Status *status) {
+  static unsigned char data[DATA_SIZE];
+  volatile uint64_t sink = 0;
+  uint32_t seed = 1;
+  uint64_t start;
+
+  for (size_t i = 0; i < DATA_SIZE; i++) {
+    data[i] = (unsigned char)bench_random(&seed);
+  }
+
+  start = bench_now_ns();
+  for (size_t pass = 0; pass < PASS_COUNT; pass++) {
+    sink ^= d2k_hash(data, DATA_SIZE, pass);
+  }
+  bench_report("hash: xxh64 byte", bench_now_ns() - start,
+                                   PASS_COUNT * DATA_SIZE);
+
+  start = bench_now_ns();
+  for (size_t pass = 0; pass < PASS_COUNT; pass++) {
+    sink ^= fnv1a(data, DATA_SIZE);
+  }
+  bench_report("hash: fnv1a byte", bench_now_ns() - start,
+                                   PASS_COUNT * DATA_SIZE);
+
+  (void)sink;
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "d2k.h"
+#include "d2k_bench.h"
+
+bool bench_fixed_batch(Status *status);
+bool bench_fixed_math(Status *status);
+bool bench_hash(Status *status);
+bool bench_map_blockmap_things(Status *status);
+bool bench_map_object_slab(Status *status);
+bool bench_map_object_state_table(Status *status);
+bool bench_map_udmf(Status *status);
+bool bench_path_traversal(Status *status);
+bool bench_sight(Status *status);
+bool bench_thinker(Status *status);
+
+int main(void) {
+  Status status;
+
+  status_init(&status);
+
+  if (!(bench_fixed_batch(&status)            &&
+        bench_fixed_math(&status)             &&
+        bench_hash(&status)                   &&
+        bench_map_blockmap_things(&status)    &&
+        bench_map_object_slab(&status)        &&
+        bench_map_object_state_table(&status) &&
+        bench_map_udmf(&status)               &&
+        bench_path_traversal(&status)         &&
+        bench_sight(&status)                  &&
+        bench_thinker(&status))) {
+    fprintf(stderr, "%s\n", status.message);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,230 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * A crowded 32x32-cell map: every tic each object wanders a little and is
+ * relinked, then a batch of radius queries sums the health of everything in
+ * range.  Run through vanilla-style blocklinks (heap objects in shuffled
+ * order, unlinked and relinked on every move) and through the handle index.
+ */
+
+#define MAP_CELLS     32
+#define OBJECT_COUNT  8192
+#define QUERY_COUNT   2048
+#define TIC_COUNT     100
+#define QUERY_RADIUS  (128 * FRACUNIT)
+
+typedef struct BenchLinkedStruct {
+  D2KMapObject              object;
+  struct BenchLinkedStruct  *bnext;
+  struct BenchLinkedStruct **bprev;
+} BenchLinked;
+
+static BenchLinked *blocklinks[MAP_CELLS * MAP_CELLS];
+
+static void set_position(BenchLinked *linked) {
+  int bx = linked->object.x >> MAPBLOCKSHIFT;
+  int by = linked->object.y >> MAPBLOCKSHIFT;
+  BenchLinked **link = &blocklinks[(by * MAP_CELLS) + bx];
+
+  linked->bprev = link;
+  linked->bnext = *link;
+
+  if (*link) {
+    (*link)->bprev = &linked->bnext;
+  }
+
+  *link = linked;
+}
+
+static void unset_position(BenchLinked *linked) {
+  *linked->bprev = linked->bnext;
+
+  if (linked->bnext) {
+    linked->bnext->bprev = linked->bprev;
+  }
+}
+
+static bool sum_health(D2KMapObject *map_object, void *data) {
+  *(int *)data += map_object->health;
+
+  return true;
+}
+
+static D2KFixedPoint wander(D2KFixedPoint v, uint32_t *seed) {
+  v += (D2KFixedPoint)(bench_random(seed) % 33 - 16) * FRACUNIT;
+
+  if (v < 0) {
+    return 0;
+  }
+
+  if (v >= MAP_CELLS * 128 * FRACUNIT) {
+    return (MAP_CELLS * 128 - 1) * FRACUNIT;
+  }
+
+  return v;
+}
+
+static D2KFixedPoint random_position(uint32_t *seed) {
+  return (D2KFixedPoint)(bench_random(seed) % (MAP_CELLS * 128)) * FRACUNIT;
+}
+
+static bool run_handles(D2KBlockmapThings *things, D2KMapObjectSlab *slab,
+                                                   int *total,
+                                                   Status *status) {
+  static D2KMapObject *objects[OBJECT_COUNT];
+  uint32_t seed = 1;
+  uint64_t start;
+
+  for (size_t i = 0; i < OBJECT_COUNT; i++) {
+    if (!d2k_map_object_slab_spawn(slab, &objects[i], status)) {
+      return false;
+    }
+
+    objects[i]->x = random_position(&seed);
+    objects[i]->y = random_position(&seed);
+    objects[i]->health = 1;
+
+    if (!d2k_blockmap_things_link(things, objects[i], status)) {
+      return false;
+    }
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (size_t i = 0; i < OBJECT_COUNT; i++) {
+      objects[i]->x = wander(objects[i]->x, &seed);
+      objects[i]->y = wander(objects[i]->y, &seed);
+
+      if (!d2k_blockmap_things_relink(things, objects[i], status)) {
+        return false;
+      }
+    }
+
+    for (size_t q = 0; q < QUERY_COUNT; q++) {
+      D2KFixedPoint x = random_position(&seed);
+      D2KFixedPoint y = random_position(&seed);
+
+      d2k_blockmap_things_iterate_box(things, slab,
+        x - QUERY_RADIUS - MAXRADIUS,
+        y - QUERY_RADIUS - MAXRADIUS,
+        x + QUERY_RADIUS + MAXRADIUS,
+        y + QUERY_RADIUS + MAXRADIUS,
+        sum_health,
+        total
+      );
+    }
+  }
+  bench_report("blockmap things: handles", bench_now_ns() - start,
+    TIC_COUNT * (OBJECT_COUNT + QUERY_COUNT)
+  );
+
+  return status_ok(status);
+}
+
+bool bench_map_blockmap_things(Status *status) {
+  static BenchLinked *linked[OBJECT_COUNT];
+  D2KBlockmap blockmap;
+  D2KBlockmapThings things;
+  D2KMapObjectSlab slab;
+  uint32_t seed = 1;
+  int total = 0;
+  bool ok;
+  uint64_t start;
+
+  /* Vanilla blocklinks */
+  for (size_t i = 0; i < OBJECT_COUNT; i++) {
+    if (!d2k_calloc((void **)&linked[i], 1, sizeof(BenchLinked), status)) {
+      return false;
+    }
+  }
+
+  for (size_t i = OBJECT_COUNT - 1; i > 0; i--) {
+    size_t j = ((bench_random(&seed) << 15) | bench_random(&seed)) % (i + 1);
+    BenchLinked *swap = linked[i];
+
+    linked[i] = linked[j];
+    linked[j] = swap;
+  }
+
+  /* Same positions and queries as the handle run */
+  seed = 1;
+
+  for (size_t i = 0; i < OBJECT_COUNT; i++) {
+    linked[i]->object.x = random_position(&seed);
+    linked[i]->object.y = random_position(&seed);
+    linked[i]->object.health = 1;
+    set_position(linked[i]);
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (size_t i = 0; i < OBJECT_COUNT; i++) {
+      unset_position(linked[i]);
+      linked[i]->object.x = wander(linked[i]->object.x, &seed);
+      linked[i]->object.y = wander(linked[i]->object.y, &seed);
+      set_position(linked[i]);
+    }
+
+    for (size_t q = 0; q < QUERY_COUNT; q++) {
+      D2KFixedPoint x = random_position(&seed);
+      D2KFixedPoint y = random_position(&seed);
+      int xl = (x - QUERY_RADIUS - MAXRADIUS) >> MAPBLOCKSHIFT;
+      int xh = (x + QUERY_RADIUS + MAXRADIUS) >> MAPBLOCKSHIFT;
+      int yl = (y - QUERY_RADIUS - MAXRADIUS) >> MAPBLOCKSHIFT;
+      int yh = (y + QUERY_RADIUS + MAXRADIUS) >> MAPBLOCKSHIFT;
+
+      for (int bx = xl < 0 ? 0 : xl; bx <= xh && bx < MAP_CELLS; bx++) {
+        for (int by = yl < 0 ? 0 : yl; by <= yh && by < MAP_CELLS; by++) {
+          for (BenchLinked *l = blocklinks[(by * MAP_CELLS) + bx];
+               l;
+               l = l->bnext) {
+            sum_health(&l->object, &total);
+          }
+        }
+      }
+    }
+  }
+  bench_report("blockmap things: blocklinks", bench_now_ns() - start,
+    TIC_COUNT * (OBJECT_COUNT + QUERY_COUNT)
+  );
+
+  for (size_t i = 0; i < OBJECT_COUNT; i++) {
+    d2k_free(linked[i]);
+  }
+
+  /* Handle index */
+  d2k_blockmap_init(&blockmap);
+  blockmap.width = MAP_CELLS;
+  blockmap.height = MAP_CELLS;
+
+  if (!d2k_blockmap_things_init(&things, &blockmap, status)) {
+    return false;
+  }
+
+  if (!d2k_map_object_slab_init(&slab, OBJECT_COUNT, status)) {
+    d2k_blockmap_things_free(&things);
+    return false;
+  }
+
+  total = -total;
+  ok = run_handles(&things, &slab, &total, status);
+
+  d2k_map_object_slab_free(&slab);
+  d2k_blockmap_things_free(&things);
+
+  if (!ok) {
+    return false;
+  }
+
+  /* Both runs see the same things, so this should be back to zero */
+  if (total) {
+    return status_error(status, "d2k_bench", 1,
+      "blocklinks and handle index query results differ"
+    );
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,87 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * Projectile churn: a steady population of objects where each tic some die
+ * and the same number spawn, with calloc/free and with the slab.
+ */
+
+#define POPULATION     4096
+#define CHURN_PER_TIC  256
+#define TIC_COUNT      2000
+
+bool bench_map_object_slab(Status *status) {
+  static D2KMapObject *objects[POPULATION];
+  static D2KMapObjectHandle handles[POPULATION];
+  D2KMapObjectSlab slab;
+  uint32_t seed = 1;
+  uint64_t start;
+
+  for (size_t i = 0; i < POPULATION; i++) {
+    if (!d2k_calloc((void **)&objects[i], 1, sizeof(D2KMapObject), status)) {
+      return false;
+    }
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (size_t i = 0; i < CHURN_PER_TIC; i++) {
+      size_t victim = bench_random(&seed) % POPULATION;
+
+      d2k_free(objects[victim]);
+
+      if (!d2k_calloc((void **)&objects[victim], 1, sizeof(D2KMapObject),
+                                                    status)) {
+        return false;
+      }
+    }
+  }
+  bench_report("map objects: calloc/free", bench_now_ns() - start,
+    TIC_COUNT * CHURN_PER_TIC
+  );
+
+  for (size_t i = 0; i < POPULATION; i++) {
+    d2k_free(objects[i]);
+  }
+
+  if (!d2k_map_object_slab_init(&slab, POPULATION, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < POPULATION; i++) {
+    D2KMapObject *map_object = NULL;
+
+    if (!d2k_map_object_slab_spawn(&slab, &map_object, status)) {
+      d2k_map_object_slab_free(&slab);
+      return false;
+    }
+
+    handles[i] = map_object->handle;
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (size_t i = 0; i < CHURN_PER_TIC; i++) {
+      size_t victim = bench_random(&seed) % POPULATION;
+      D2KMapObject *map_object = NULL;
+
+      d2k_map_object_slab_remove(&slab, handles[victim]);
+
+      if (!d2k_map_object_slab_spawn(&slab, &map_object, status)) {
+        d2k_map_object_slab_free(&slab);
+        return false;
+      }
+
+      handles[victim] = map_object->handle;
+    }
+  }
+  bench_report("map objects: slab", bench_now_ns() - start,
+    TIC_COUNT * CHURN_PER_TIC
+  );
+
+  d2k_map_object_slab_free(&slab);
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
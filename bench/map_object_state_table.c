@@ -0,0 +1,132 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * A busy map's worth of actors cycling through a synthetic 1024-state
+ * table, a quarter of whose states have an action.  Run through
+ * P_MobjThinker's per-object walk (tics and a state pointer on each map
+ * object) and through the compiled table's batch advance.
+ */
+
+#define STATE_COUNT 1024
+#define ACTOR_COUNT 16384
+#define TIC_COUNT   500
+
+static size_t action_calls = 0;
+
+static void count_action(void) {
+  action_calls++;
+}
+
+static bool run_action(size_t actor, uint32_t state, D2KActionFunction action,
+                                                     void *data) {
+  (void)actor;
+  (void)state;
+  (void)data;
+
+  action();
+
+  return true;
+}
+
+/* P_SetMobjState, minus everything but the state machine */
+static void set_state(D2KMapObject *map_object, D2KMapObjectState *states,
+                                                D2KMapObjectStateNum state) {
+  do {
+    D2KMapObjectState *st = &states[state];
+
+    map_object->state = st;
+    map_object->tics = st->tics;
+    map_object->sprite = st->sprite;
+    map_object->frame = st->frame;
+
+    if (st->action) {
+      st->action();
+    }
+
+    state = st->next_state;
+  } while (!map_object->tics);
+}
+
+bool bench_map_object_state_table(Status *status) {
+  static D2KMapObjectState states[STATE_COUNT];
+  static int32_t tics[ACTOR_COUNT];
+  static uint32_t actor_states[ACTOR_COUNT];
+  D2KMapObject *map_objects = NULL;
+  D2KMapObjectStateTable table;
+  uint32_t seed = 1;
+  size_t list_calls;
+  uint64_t start;
+
+  for (size_t i = 1; i < STATE_COUNT; i++) {
+    states[i].tics = (int32_t)(1 + (bench_random(&seed) % 8));
+    states[i].next_state = 1 + (bench_random(&seed) % (STATE_COUNT - 1));
+
+    if ((bench_random(&seed) % 4) == 0) {
+      states[i].action = count_action;
+    }
+  }
+
+  if (!d2k_calloc((void **)&map_objects, ACTOR_COUNT, sizeof(D2KMapObject),
+                                                      status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < ACTOR_COUNT; i++) {
+    D2KMapObjectStateNum state = 1 + (i % (STATE_COUNT - 1));
+
+    map_objects[i].state = &states[state];
+    map_objects[i].tics = states[state].tics;
+    actor_states[i] = state;
+    tics[i] = states[state].tics;
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (size_t i = 0; i < ACTOR_COUNT; i++) {
+      D2KMapObject *map_object = &map_objects[i];
+
+      if (map_object->tics != -1) {
+        map_object->tics--;
+
+        if (!map_object->tics) {
+          set_state(map_object, states, map_object->state->next_state);
+        }
+      }
+    }
+  }
+  bench_report("states: per object", bench_now_ns() - start,
+    TIC_COUNT * ACTOR_COUNT
+  );
+
+  d2k_free(map_objects);
+  list_calls = action_calls;
+  action_calls = 0;
+
+  if (!d2k_map_object_state_table_init(&table, states, STATE_COUNT, status)) {
+    return false;
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    d2k_map_object_state_table_advance(&table, tics, actor_states,
+                                                     ACTOR_COUNT,
+                                                     run_action,
+                                                     NULL);
+  }
+  bench_report("states: batch advance", bench_now_ns() - start,
+    TIC_COUNT * ACTOR_COUNT
+  );
+
+  d2k_map_object_state_table_free(&table);
+
+  if (action_calls != list_calls) {
+    return status_error(status, "d2k_bench", 1,
+      "per-object and batch state advances ran different actions"
+    );
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,153 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * A synthetic TEXTMAP the size of a big community map: a grid of square
+ * sectors, four two-sided linedefs, sidedefs and a thing per sector, laid
+ * out the way editors write it.  Parsed on one thread, then split across
+ * as many as the machine has.
+ */
+
+#define GRID_SIZE   100
+#define PASS_COUNT  5
+#define BLOCK_SPACE 512
+
+static size_t append(char *text, size_t len, const char *block) {
+  size_t block_len = strlen(block);
+
+  memcpy(text + len, block, block_len);
+
+  return len + block_len;
+}
+
+static size_t build_textmap(char *text) {
+  char block[BLOCK_SPACE];
+  uint32_t seed = 1;
+  size_t len = 0;
+  size_t cell_count = GRID_SIZE * GRID_SIZE;
+
+  len = append(text, len, "namespace = \"doom\";\n\n");
+
+  for (size_t i = 0; i < cell_count; i++) {
+    snprintf(block, sizeof(block),
+      "thing // %zu\n{\nx = %zu.000;\ny = %zu.000;\nangle = %u;\n"
+      "type = 3004;\nskill2 = true;\nskill3 = true;\nskill4 = true;\n"
+      "single = true;\ncoop = true;\ndm = true;\n}\n\n",
+      i, (i % GRID_SIZE) * 64 + 32, (i / GRID_SIZE) * 64 + 32,
+      (bench_random(&seed) % 8) * 45
+    );
+    len = append(text, len, block);
+  }
+
+  for (size_t i = 0; i < (GRID_SIZE + 1) * (GRID_SIZE + 1); i++) {
+    snprintf(block, sizeof(block), "vertex // %zu\n{\nx = %zu.000;\n"
+                                   "y = %zu.000;\n}\n\n",
+      i, (i % (GRID_SIZE + 1)) * 64, (i / (GRID_SIZE + 1)) * 64
+    );
+    len = append(text, len, block);
+  }
+
+  for (size_t i = 0; i < cell_count * 4; i++) {
+    snprintf(block, sizeof(block),
+      "linedef // %zu\n{\nv1 = %zu;\nv2 = %zu;\nsidefront = %zu;\n"
+      "sideback = %zu;\ntwosided = true;\nspecial = %u;\n}\n\n",
+      i, i % cell_count, (i + 1) % cell_count, i, (i + 1) % (cell_count * 4),
+      bench_random(&seed) % 2
+    );
+    len = append(text, len, block);
+  }
+
+  for (size_t i = 0; i < cell_count * 4; i++) {
+    snprintf(block, sizeof(block),
+      "sidedef // %zu\n{\noffsetx = %u;\nsector = %zu;\n"
+      "texturetop = \"STARTAN3\";\ntexturebottom = \"STARTAN3\";\n"
+      "texturemiddle = \"-\";\n}\n\n",
+      i, bench_random(&seed) % 64, i / 4
+    );
+    len = append(text, len, block);
+  }
+
+  for (size_t i = 0; i < cell_count; i++) {
+    snprintf(block, sizeof(block),
+      "sector // %zu\n{\nheightfloor = %u;\nheightceiling = 128;\n"
+      "texturefloor = \"FLOOR4_8\";\ntextureceiling = \"CEIL3_5\";\n"
+      "lightlevel = 192;\n}\n\n",
+      i, (bench_random(&seed) % 8) * 8
+    );
+    len = append(text, len, block);
+  }
+
+  return len;
+}
+
+bool bench_map_udmf(Status *status) {
+  size_t cell_count = GRID_SIZE * GRID_SIZE;
+  size_t block_count = (cell_count * 11) + ((GRID_SIZE + 1) * (GRID_SIZE + 1));
+  char *text = NULL;
+  D2KUDMFRecords records;
+  D2KUDMFRecords parallel_records;
+  bool matched;
+  uint64_t start;
+  size_t len;
+
+  if (!d2k_malloc((void **)&text, block_count, BLOCK_SPACE, status)) {
+    return false;
+  }
+
+  len = build_textmap(text);
+  d2k_udmf_records_init(&records);
+
+  start = bench_now_ns();
+  for (size_t pass = 0; pass < PASS_COUNT; pass++) {
+    d2k_udmf_records_clear(&records);
+
+    if (!d2k_udmf_parse(&records, text, len, status)) {
+      d2k_udmf_records_free(&records);
+      d2k_free(text);
+      return false;
+    }
+  }
+  bench_report("udmf: parse (per KB)", bench_now_ns() - start,
+    (PASS_COUNT * len) / 1024
+  );
+
+  d2k_udmf_records_init(&parallel_records);
+
+  start = bench_now_ns();
+  for (size_t pass = 0; pass < PASS_COUNT; pass++) {
+    d2k_udmf_records_clear(&parallel_records);
+
+    if (!d2k_udmf_parse_parallel(&parallel_records, text, len, 0, status)) {
+      d2k_udmf_records_free(&parallel_records);
+      d2k_udmf_records_free(&records);
+      d2k_free(text);
+      return false;
+    }
+  }
+  bench_report("udmf: parallel parse (per KB)", bench_now_ns() - start,
+    (PASS_COUNT * len) / 1024
+  );
+
+  d2k_free(text);
+
+  matched = (
+    records.linedefs.len == cell_count * 4 &&
+    records.sectors.len == cell_count &&
+    parallel_records.linedefs.len == records.linedefs.len &&
+    memcmp(parallel_records.linedefs.elements, records.linedefs.elements,
+           records.linedefs.len * records.linedefs.element_size) == 0
+  );
+
+  d2k_udmf_records_free(&parallel_records);
+  d2k_udmf_records_free(&records);
+
+  if (!matched) {
+    return status_error(status, "d2k_bench", 1,
+      "serial and parallel UDMF parses produced different blocks"
+    );
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,90 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+#include "d2k_test.h"
+
+/*
+ * Deathmatch-style hitscan load: lots of short-to-medium traces through a
+ * grid with scattered solid walls, each stopping at the first one it hits.
+ */
+
+#define GRID_WIDTH  64
+#define GRID_HEIGHT 64
+#define TRACE_COUNT 200000
+#define MAX_RANGE   (16 * GRID_MAP_CELL_SIZE)
+
+static bool stop_at_solid_line(D2KPathTraversal *traversal,
+                               D2KIntercept *intercept,
+                               void *data) {
+  size_t *lines_crossed = data;
+
+  (void)traversal;
+
+  if (!(intercept->d.line->flags & D2K_LINEDEF_FLAG_TWO_SIDED)) {
+    return false;
+  }
+
+  (*lines_crossed)++;
+
+  return true;
+}
+
+static D2KFixedPoint random_coord(uint32_t *seed, size_t cells) {
+  return d2k_int_to_fixed_point(
+    (int32_t)(bench_random(seed) % (cells * GRID_MAP_CELL_SIZE))
+  );
+}
+
+static D2KFixedPoint random_offset(uint32_t *seed) {
+  return d2k_int_to_fixed_point(
+    (int32_t)(bench_random(seed) % (2 * MAX_RANGE)) - MAX_RANGE
+  );
+}
+
+bool bench_path_traversal(Status *status) {
+  GridMap grid;
+  D2KPathTraversal traversal;
+  uint32_t seed = 1;
+  size_t lines_crossed = 0;
+  uint64_t start;
+
+  if (!grid_map_init(&grid, GRID_WIDTH, GRID_HEIGHT, status)) {
+    return false;
+  }
+
+  for (size_t y = 0; y < GRID_HEIGHT; y++) {
+    for (size_t x = 1; x < GRID_WIDTH; x++) {
+      if ((bench_random(&seed) % 16) == 0) {
+        grid_map_vertical_line(&grid, x, y)->flags &=
+          ~D2K_LINEDEF_FLAG_TWO_SIDED;
+      }
+    }
+  }
+
+  if (!d2k_path_traversal_init(&traversal, &grid.map, status)) {
+    grid_map_free(&grid);
+    return false;
+  }
+
+  start = bench_now_ns();
+  for (size_t i = 0; i < TRACE_COUNT; i++) {
+    D2KFixedPoint x1 = random_coord(&seed, GRID_WIDTH);
+    D2KFixedPoint y1 = random_coord(&seed, GRID_HEIGHT);
+    D2KFixedPoint x2 = x1 + random_offset(&seed);
+    D2KFixedPoint y2 = y1 + random_offset(&seed);
+
+    d2k_path_traverse(&traversal, x1, y1, x2, y2,
+      D2K_PATH_TRAVERSE_ADD_LINES,
+      stop_at_solid_line,
+      &lines_crossed
+    );
+  }
+  bench_report("path traversal: hitscans", bench_now_ns() - start,
+                                           TRACE_COUNT);
+
+  d2k_path_traversal_free(&traversal);
+  grid_map_free(&grid);
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,119 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+#include "d2k_test.h"
+
+/*
+ * A crowded co-op arena: a big grid with scattered solid walls and uneven
+ * floors, many monsters, and a handful of players they all look for.
+ */
+
+#define GRID_WIDTH    64
+#define GRID_HEIGHT   64
+#define MONSTER_COUNT 512
+#define PLAYER_COUNT  4
+#define TIC_COUNT     200
+
+static void build_arena(GridMap *grid, uint32_t *seed) {
+  for (size_t y = 0; y < grid->height; y++) {
+    for (size_t x = 0; x < grid->width; x++) {
+      D2KSector *sector = grid_map_sector(grid, x, y);
+
+      sector->floor_height = d2k_int_to_fixed_point(
+        (int32_t)(bench_random(seed) % 5) * 8
+      );
+    }
+  }
+
+  for (size_t y = 0; y < grid->height; y++) {
+    for (size_t x = 1; x < grid->width; x++) {
+      if ((bench_random(seed) % 16) == 0) {
+        grid_map_vertical_line(grid, x, y)->flags &=
+          ~D2K_LINEDEF_FLAG_TWO_SIDED;
+      }
+    }
+  }
+
+  for (size_t y = 1; y < grid->height; y++) {
+    for (size_t x = 0; x < grid->width; x++) {
+      if ((bench_random(seed) % 16) == 0) {
+        grid_map_horizontal_line(grid, x, y)->flags &=
+          ~D2K_LINEDEF_FLAG_TWO_SIDED;
+      }
+    }
+  }
+}
+
+static void place_randomly(GridMap *grid, D2KSightActor *actors,
+                                          size_t count,
+                                          uint32_t *seed) {
+  for (size_t i = 0; i < count; i++) {
+    grid_map_place_actor(grid, &actors[i],
+      bench_random(seed) % grid->width,
+      bench_random(seed) % grid->height
+    );
+  }
+}
+
+bool bench_sight(Status *status) {
+  static D2KSightActor monsters[MONSTER_COUNT];
+  static bool results[MONSTER_COUNT];
+  D2KSightActor players[PLAYER_COUNT];
+  GridMap grid;
+  D2KSight sight;
+  uint32_t seed = 1;
+  size_t visible = 0;
+  uint64_t start;
+
+  if (!grid_map_init(&grid, GRID_WIDTH, GRID_HEIGHT, status)) {
+    return false;
+  }
+
+  build_arena(&grid, &seed);
+  place_randomly(&grid, monsters, MONSTER_COUNT, &seed);
+  place_randomly(&grid, players, PLAYER_COUNT, &seed);
+
+  if (!d2k_sight_init(&sight, &grid.map, status)) {
+    grid_map_free(&grid);
+    return false;
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (size_t p = 0; p < PLAYER_COUNT; p++) {
+      for (size_t m = 0; m < MONSTER_COUNT; m++) {
+        visible += d2k_sight_check(&sight, &monsters[m], &players[p]);
+      }
+    }
+  }
+  bench_report("sight: single checks", bench_now_ns() - start,
+    TIC_COUNT * PLAYER_COUNT * MONSTER_COUNT
+  );
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (size_t p = 0; p < PLAYER_COUNT; p++) {
+      d2k_sight_check_many(&sight, monsters, MONSTER_COUNT, &players[p],
+                                                            results);
+      for (size_t m = 0; m < MONSTER_COUNT; m++) {
+        visible -= results[m];
+      }
+    }
+  }
+  bench_report("sight: batched checks", bench_now_ns() - start,
+    TIC_COUNT * PLAYER_COUNT * MONSTER_COUNT
+  );
+
+  d2k_sight_free(&sight);
+  grid_map_free(&grid);
+
+  /* Both loops see the same things, so this should be back to zero */
+  if (visible) {
+    return status_error(status, "d2k_bench", 1,
+      "batched and single sight results differ"
+    );
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
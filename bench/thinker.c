@@ -0,0 +1,114 @@
+#include "d2k.h"
+#include "d2k_bench.h"
+
+/*
+ * A busy map's worth of thinkers, run through a heap-allocated linked list
+ * spawned in shuffled order (as long-running maps end up) and through the
+ * pooled runtime.
+ */
+
+#define THINKER_COUNT 16384
+#define TIC_COUNT     500
+
+typedef struct {
+  D2KThinker    thinker;
+  D2KFixedPoint x;
+  D2KFixedPoint y;
+  D2KFixedPoint momx;
+  D2KFixedPoint momy;
+  char          rest[120];
+} BenchActor;
+
+static void move_actor(BenchActor *actor) {
+  actor->x += actor->momx;
+  actor->y += actor->momy;
+}
+
+bool bench_thinker(Status *status) {
+  static BenchActor *list_actors[THINKER_COUNT];
+  D2KThinker head;
+  D2KThinkerRuntime runtime;
+  size_t actors;
+  uint32_t seed = 1;
+  uint64_t start;
+
+  /* Linked list, allocated and linked in shuffled order */
+  for (size_t i = 0; i < THINKER_COUNT; i++) {
+    if (!d2k_calloc((void **)&list_actors[i], 1, sizeof(BenchActor),
+                                                 status)) {
+      return false;
+    }
+  }
+
+  for (size_t i = THINKER_COUNT - 1; i > 0; i--) {
+    size_t j = ((bench_random(&seed) << 15) | bench_random(&seed)) % (i + 1);
+    BenchActor *swap = list_actors[i];
+
+    list_actors[i] = list_actors[j];
+    list_actors[j] = swap;
+  }
+
+  head.next = &head;
+  head.prev = &head;
+
+  for (size_t i = 0; i < THINKER_COUNT; i++) {
+    D2KThinker *thinker = &list_actors[i]->thinker;
+
+    list_actors[i]->momx = FRACUNIT;
+    thinker->function = (D2KActionFunction)move_actor;
+    thinker->prev = head.prev;
+    thinker->next = &head;
+    head.prev->next = thinker;
+    head.prev = thinker;
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    for (D2KThinker *t = head.next; t != &head; t = t->next) {
+      t->function(t);
+    }
+  }
+  bench_report("thinkers: linked list", bench_now_ns() - start,
+    TIC_COUNT * THINKER_COUNT
+  );
+
+  for (size_t i = 0; i < THINKER_COUNT; i++) {
+    d2k_free(list_actors[i]);
+  }
+
+  /* Pooled runtime */
+  d2k_thinker_runtime_init(&runtime);
+
+  if (!d2k_thinker_runtime_add_class(&runtime, sizeof(BenchActor), &actors,
+                                                                   status)) {
+    d2k_thinker_runtime_free(&runtime);
+    return false;
+  }
+
+  for (size_t i = 0; i < THINKER_COUNT; i++) {
+    BenchActor *actor = NULL;
+
+    if (!d2k_thinker_runtime_spawn(&runtime, actors, (void **)&actor,
+                                                     status)) {
+      d2k_thinker_runtime_free(&runtime);
+      return false;
+    }
+
+    actor->momx = FRACUNIT;
+    actor->thinker.function = (D2KActionFunction)move_actor;
+  }
+
+  start = bench_now_ns();
+  for (size_t tic = 0; tic < TIC_COUNT; tic++) {
+    d2k_thinker_runtime_run(&runtime);
+  }
+  bench_report("thinkers: pooled", bench_now_ns() - start,
+    TIC_COUNT * THINKER_COUNT
+  );
+
+  d2k_thinker_runtime_free(&runtime);
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
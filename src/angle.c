@@ -72,6 +72,96 @@ int d2k_slope_div_ex(unsigned int num, unsigned int den) {
   return ans <= SLOPERANGE ? (int)ans : SLOPERANGE;
 }
 
+D2KAngle d2k_point_to_angle(const D2KAngle *tantoangle, D2KFixedPoint dx,
+                                                      D2KFixedPoint dy) {
+  D2KFixedPoint x = dx;
+  D2KFixedPoint y = dy;
+
+  if ((!x) && (!y)) {
+    return 0;
+  }
+
+  if (x >= 0) {
+    if (y >= 0) {
+      if (x > y) {
+        return tantoangle[d2k_slope_div(y, x)];
+      }
+
+      return ANG90 - 1 - tantoangle[d2k_slope_div(x, y)];
+    }
+
+    /* Negated as unsigned so INT_MIN stays INT_MIN, as it did in vanilla */
+    y = (D2KFixedPoint)(0u - (uint32_t)y);
+
+    if (x > y) {
+      return -tantoangle[d2k_slope_div(y, x)];
+    }
+
+    return ANG270 + tantoangle[d2k_slope_div(x, y)];
+  }
+
+  x = (D2KFixedPoint)(0u - (uint32_t)x);
+
+  if (y >= 0) {
+    if (x > y) {
+      return ANG180 - 1 - tantoangle[d2k_slope_div(y, x)];
+    }
+
+    return ANG90 + tantoangle[d2k_slope_div(x, y)];
+  }
+
+  y = (D2KFixedPoint)(0u - (uint32_t)y);
+
+  if (x > y) {
+    return ANG180 + tantoangle[d2k_slope_div(y, x)];
+  }
+
+  return ANG270 - 1 - tantoangle[d2k_slope_div(x, y)];
+}
+
+/*
+ * Looks up one of the PrBoom trig lumps; a missing lump leaves *lump NULL
+ * rather than failing.
+ */
+static bool lookup_trig_lump(D2KLumpDirectory *lump_directory,
+                             const char *lump_name,
+                             D2KLump **lump,
+                             Status *status) {
+  if (!d2k_lump_directory_lookup_ns(lump_directory, lump_name,
+                                                    D2K_LUMP_NAMESPACE_PRBOOM,
+                                                    lump,
+                                                    status)) {
+    if (!status_match(status, "base", ERROR_NOT_FOUND)) {
+      return false;
+    }
+
+    status_clear(status);
+    *lump = NULL;
+  }
+
+  return status_ok(status);
+}
+
+static bool read_trig_lump(D2KLump *lump, void *table, size_t count,
+                                                       Status *status) {
+  uint32_t *values = table;
+
+  if (!slice_read(&lump->data, 0, lump->data.len, table, status)) {
+    return false;
+  }
+
+#ifdef WORDS_BIGENDIAN
+  for (size_t i = 0; i < count; i++) {
+    values[i] = cble32(values[i]);
+  }
+#else
+  (void)values;
+  (void)count;
+#endif
+
+  return status_ok(status);
+}
+
 bool d2k_angle_load_trig_tables(D2KLumpDirectory *lump_directory,
                                 D2KFixedPoint *finesine,
                                 D2KFixedPoint *finecosine,
@@ -80,69 +170,54 @@ bool d2k_angle_load_trig_tables(D2KLumpDirectory *lump_directory,
                                 Status *status) {
   D2KLump *lump = NULL;
 
-  if (!d2k_lump_directory_lookup_ns(lump_directory, "SINETABL",
-                                                    D2K_LUMP_NAMESPACE_PRBOOM,
-                                                    &lump,
-                                                    status)) {
+  if (!lookup_trig_lump(lump_directory, "SINETABL", &lump, status)) {
     return false;
   }
 
-  if (lump->data.len != (sizeof(D2KFixedPoint) * SINE_COUNT)) {
+  if (!lump) {
+    cbmemmove(finesine, d2k_finesine, sizeof(D2KFixedPoint) * SINE_COUNT);
+  }
+  else if (lump->data.len != (sizeof(D2KFixedPoint) * SINE_COUNT)) {
     return invalid_sine_table(status);
   }
-
-  if (!slice_read(&lump->data, 0, lump->data.len, (void *)finesine, status)) {
+  else if (!read_trig_lump(lump, finesine, SINE_COUNT, status)) {
     return false;
   }
 
-  cbmemmove(finecosine, finesine + 2048, sizeof(D2KFixedPoint) * COSINE_COUNT);
+  cbmemmove(finecosine, finesine + (FINEANGLES / 4),
+                        sizeof(D2KFixedPoint) * COSINE_COUNT);
 
-  if (!d2k_lump_directory_lookup_ns(lump_directory, "TANGTABL",
-                                                    D2K_LUMP_NAMESPACE_PRBOOM,
-                                                    &lump,
-                                                    status)) {
+  if (!lookup_trig_lump(lump_directory, "TANGTABL", &lump, status)) {
     return false;
   }
 
-  if (lump->data.len != (sizeof(D2KFixedPoint) * TANGENT_COUNT)) {
+  if (!lump) {
+    cbmemmove(finetangent, d2k_finetangent,
+                          sizeof(D2KFixedPoint) * TANGENT_COUNT);
+  }
+  else if (lump->data.len != (sizeof(D2KFixedPoint) * TANGENT_COUNT)) {
     return invalid_tangent_table(status);
   }
-
-  if (!slice_read(&lump->data, 0, lump->data.len, (void *)finetangent,
-                                                  status)) {
+  else if (!read_trig_lump(lump, finetangent, TANGENT_COUNT, status)) {
     return false;
   }
 
-  if (!d2k_lump_directory_lookup_ns(lump_directory, "TANTOANG",
-                                                    D2K_LUMP_NAMESPACE_PRBOOM,
-                                                    &lump,
-                                                    status)) {
+  if (!lookup_trig_lump(lump_directory, "TANTOANG", &lump, status)) {
     return false;
   }
 
-  if (lump->data.len != (sizeof(D2KAngle) * TANGENT_TO_ANGLE_COUNT)) {
+  if (!lump) {
+    cbmemmove(tantoangle, d2k_tantoangle,
+                         sizeof(D2KAngle) * TANGENT_TO_ANGLE_COUNT);
+  }
+  else if (lump->data.len != (sizeof(D2KAngle) * TANGENT_TO_ANGLE_COUNT)) {
     return invalid_tangent_to_angle_table(status);
   }
-
-  if (!slice_read(&lump->data, 0, lump->data.len, (void *)tantoangle,
-                                                  status)) {
+  else if (!read_trig_lump(lump, tantoangle, TANGENT_TO_ANGLE_COUNT,
+                                             status)) {
     return false;
   }
 
-#ifdef WORDS_BIGENDIAN
-  for (size_t i = 0; i < SINE_COUNT; i++) {
-    finesine[i] = cble32(finesine[i]);
-  }
-
-  for (size_t i = 0; i < TANGENT_COUNT; i++) {
-    finetangent[i] = cble32(finetangent[i]);
-  }
-
-  for (size_t i = 0; i < TANGENT_TO_ANGLE_COUNT; i++) {
-    tantoangle[i] = cble32(tantoangle[i]);
-  }
-#endif
-
   return status_ok(status);
 }
 
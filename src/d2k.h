@@ -5,24 +5,43 @@
 
 #include "d2k/alloc.h"
 #include "d2k/angle.h"
+#include "d2k/dehacked.h"
+#include "d2k/divline.h"
+#include "d2k/fixed_batch.h"
 #include "d2k/fixed_math.h"
 #include "d2k/fixed_vertex.h"
+#include "d2k/hash.h"
+#include "d2k/lump_name_cache.h"
 #include "d2k/map.h"
 #include "d2k/map_blockmap.h"
+#include "d2k/map_blockmap_things.h"
+#include "d2k/map_instance.h"
 #include "d2k/map_linedefs.h"
 #include "d2k/map_loader.h"
 #include "d2k/map_nodes.h"
 #include "d2k/map_object.h"
 #include "d2k/map_object_info.h"
+#include "d2k/map_object_slab.h"
+#include "d2k/map_object_state_table.h"
 #include "d2k/map_object_type.h"
+#include "d2k/map_problem.h"
+#include "d2k/map_reject.h"
+#include "d2k/map_scratch.h"
+#include "d2k/map_sector_nodes.h"
 #include "d2k/map_sectors.h"
 #include "d2k/map_segs.h"
 #include "d2k/map_sidedefs.h"
 #include "d2k/map_subsectors.h"
+#include "d2k/map_things.h"
+#include "d2k/map_udmf.h"
+#include "d2k/map_validator.h"
 #include "d2k/map_vertexes.h"
+#include "d2k/path_traversal.h"
 #include "d2k/patch.h"
+#include "d2k/sight.h"
 #include "d2k/sound_origin.h"
 #include "d2k/sprite.h"
+#include "d2k/stamp_table.h"
 #include "d2k/texture.h"
 #include "d2k/thinker.h"
 #include "d2k/wad.h"
@@ -68,8 +68,31 @@ typedef uint32_t D2KAngle;
 /* Utility function, called by R_PointToAngle. */
 typedef int (*slope_div_fn)(uint32_t num, uint32_t den);
 
+/*
+ * Built-in tables from src/trig_tables.c, verified by hand with
+ * tools/check_trig_tables.c.  They live in read-only data, so every process
+ * using libd2k shares one copy.
+ */
+extern const D2KFixedPoint        d2k_finesine[SINE_COUNT];
+extern const D2KFixedPoint *const d2k_finecosine;
+extern const D2KFixedPoint        d2k_finetangent[TANGENT_COUNT];
+extern const D2KAngle             d2k_tantoangle[TANGENT_TO_ANGLE_COUNT];
+
 int  d2k_slope_div(uint32_t num, uint32_t den);
 int  d2k_slope_div_ex(unsigned int num, unsigned int den);
+
+/*
+ * Vanilla's R_PointToAngle for a point (dx, dy) away from the viewer.
+ * `tantoangle` is d2k_tantoangle or a table filled by
+ * d2k_angle_load_trig_tables.
+ */
+D2KAngle d2k_point_to_angle(const D2KAngle *tantoangle, D2KFixedPoint dx,
+                                                      D2KFixedPoint dy);
+
+/*
+ * Fills the given tables from the PrBoom SINETABL/TANGTABL/TANTOANG lumps,
+ * falling back to the built-in tables for any the WAD doesn't have.
+ */
 bool d2k_angle_load_trig_tables(struct D2KLumpDirectoryStruct *lump_directory,
                                 D2KFixedPoint *finesine,
                                 D2KFixedPoint *finecosine,
@@ -0,0 +1,134 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_DEHACKED_H__
+#define D2K_DEHACKED_H__
+
+#include "d2k/map_instance.h"
+#include "d2k/map_object_info.h"
+#include "d2k/map_object_state.h"
+#include "d2k/sprite.h"
+
+/*
+ * DeHackEd/BEX patches (a DEHACKED lump, or a .deh/.bex file's contents).
+ *
+ * A patch is applied to a copy-on-write view of the base state, map object
+ * info and sprite name tables, using the same paging as map instances: only
+ * the pages a patch actually changes are copied.  The base tables are never
+ * written.
+ *
+ * Supported: Thing, Frame and Pointer blocks, and the BEX [CODEPTR] and
+ * [SPRITES] sections.  Text, Sound, Ammo, Weapon, Misc, Cheat and the other
+ * BEX sections don't touch these tables and are skipped.
+ */
+
+enum {
+  D2K_DEHACKED_INVALID_THING_NUMBER = 1,
+  D2K_DEHACKED_INVALID_FRAME_NUMBER,
+  D2K_DEHACKED_INVALID_VALUE,
+  D2K_DEHACKED_UNKNOWN_ACTION,
+  D2K_DEHACKED_UNKNOWN_SPRITE,
+  D2K_DEHACKED_INVALID_SPRITE_NUMBER,
+  D2K_DEHACKED_TRUNCATED_TEXT,
+};
+
+/* BEX [CODEPTR] names, without the "A_" prefix: { "Chase", a_chase } */
+typedef struct D2KDehackedActionStruct {
+  const char        *name;
+  D2KActionFunction  action;
+} D2KDehackedAction;
+
+/* The unpatched tables, which every set of patched tables shares */
+typedef struct D2KDehackedBaseStruct {
+  Array                   *states;
+  Array                   *infos;
+  Array                   *sprite_names;
+  const D2KDehackedAction *actions;
+  size_t                   action_count;
+} D2KDehackedBase;
+
+/*
+ * `unknown_flag_count` counts the Bits mnemonics that were skipped because
+ * they weren't recognized, so callers can warn about them.
+ */
+typedef struct D2KDehackedTablesStruct {
+  D2KDehackedBase     *base;
+  D2KMapInstancePages  states;
+  D2KMapInstancePages  infos;
+  D2KMapInstancePages  sprite_names;
+  size_t               unknown_flag_count;
+} D2KDehackedTables;
+
+/*
+ * Patched tables keyed on a hash of the patch's bytes, so any number of
+ * matches running the same mod share one parsed copy, read-only.
+ */
+typedef struct D2KDehackedCacheStruct {
+  D2KDehackedBase base;
+  Array           entries;
+} D2KDehackedCache;
+
+bool d2k_dehacked_tables_init(D2KDehackedTables *tables,
+                              D2KDehackedBase *base,
+                              Status *status);
+void d2k_dehacked_tables_free(D2KDehackedTables *tables);
+bool d2k_dehacked_tables_apply(D2KDehackedTables *tables,
+                               const char *patch,
+                               size_t patch_size,
+                               Status *status);
+
+void d2k_dehacked_cache_init(D2KDehackedCache *cache, D2KDehackedBase *base);
+void d2k_dehacked_cache_free(D2KDehackedCache *cache);
+
+/*
+ * Returns the tables for `patch`, parsing and applying it only the first
+ * time it's seen.  The tables belong to the cache.
+ */
+bool d2k_dehacked_cache_get(D2KDehackedCache *cache,
+                            const char *patch,
+                            size_t patch_size,
+                            D2KDehackedTables **tables,
+                            Status *status);
+
+uint64_t d2k_dehacked_hash(const char *patch, size_t patch_size);
+
+static inline const D2KMapObjectState* d2k_dehacked_state(
+    D2KDehackedTables *tables,
+    size_t index) {
+  return d2k_map_instance_pages_get(&tables->states, index);
+}
+
+static inline const D2KMapObjectInfo* d2k_dehacked_info(
+    D2KDehackedTables *tables,
+    size_t index) {
+  return d2k_map_instance_pages_get(&tables->infos, index);
+}
+
+static inline const D2KSpriteName* d2k_dehacked_sprite_name(
+    D2KDehackedTables *tables,
+    size_t index) {
+  return d2k_map_instance_pages_get(&tables->sprite_names, index);
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
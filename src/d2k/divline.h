@@ -0,0 +1,122 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_DIVLINE_H__
+#define D2K_DIVLINE_H__
+
+#include "d2k/fixed_math.h"
+
+/* A line as a point and a direction, for traces and partition tests */
+typedef struct D2KDivlineStruct {
+  D2KFixedPoint x;
+  D2KFixedPoint y;
+  D2KFixedPoint dx;
+  D2KFixedPoint dy;
+} D2KDivline;
+
+/*
+ * P_DivlineSide: 0 (front), 1 (back) or 2 (on the line).  Vanilla's test for
+ * a point on a horizontal line compares x, not y, against the line's y; sight
+ * results (and so demos) depend on it, so it's kept.
+ */
+static inline int d2k_divline_side(const D2KDivline *line, D2KFixedPoint x,
+                                                           D2KFixedPoint y) {
+  D2KFixedPoint left;
+  D2KFixedPoint right;
+
+  if (!line->dx) {
+    if (x == line->x) {
+      return 2;
+    }
+
+    return x <= line->x ? line->dy > 0 : line->dy < 0;
+  }
+
+  if (!line->dy) {
+    if (x == line->y) {
+      return 2;
+    }
+
+    return y <= line->y ? line->dx < 0 : line->dx > 0;
+  }
+
+  right = ((y - line->y) >> FRACBITS) * (line->dx >> FRACBITS);
+  left  = ((x - line->x) >> FRACBITS) * (line->dy >> FRACBITS);
+
+  if (right < left) {
+    return 0;
+  }
+
+  if (right == left) {
+    return 2;
+  }
+
+  return 1;
+}
+
+/* P_PointOnDivlineSide: 0 (front) or 1 (back) */
+static inline int d2k_divline_point_on_side(const D2KDivline *line,
+                                            D2KFixedPoint x,
+                                            D2KFixedPoint y) {
+  if (!line->dx) {
+    return x <= line->x ? line->dy > 0 : line->dy < 0;
+  }
+
+  if (!line->dy) {
+    return y <= line->y ? line->dx < 0 : line->dx > 0;
+  }
+
+  x -= line->x;
+  y -= line->y;
+
+  /* Signs alone decide it when the operands disagree */
+  if ((line->dy ^ line->dx ^ x ^ y) < 0) {
+    return (line->dy ^ x) < 0;
+  }
+
+  return d2k_fixed_mul(y >> 8, line->dx >> 8) >=
+         d2k_fixed_mul(line->dy >> 8, x >> 8);
+}
+
+/*
+ * P_InterceptVector: how far along `trace` (as a fraction of its length) it
+ * meets `line`, or 0 if they're parallel.
+ */
+static inline D2KFixedPoint d2k_divline_intercept(const D2KDivline *trace,
+                                                  const D2KDivline *line) {
+  D2KFixedPoint den = d2k_fixed_mul(line->dy >> 8, trace->dx) -
+                      d2k_fixed_mul(line->dx >> 8, trace->dy);
+
+  if (!den) {
+    return 0;
+  }
+
+  return d2k_fixed_div(
+    d2k_fixed_mul((line->x - trace->x) >> 8, line->dy) +
+    d2k_fixed_mul((trace->y - line->y) >> 8, line->dx),
+    den
+  );
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,103 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_FIXED_BATCH_H__
+#define D2K_FIXED_BATCH_H__
+
+#include "d2k/fixed_math.h"
+#include "d2k/angle.h"
+
+/*
+ * Fixed-point kernels over arrays, for updating many actors at once.
+ *
+ * Every kernel produces exactly what calling the scalar function in
+ * fixed_math.h or angle.h on each element would, whichever implementation
+ * runs.  The implementation is picked on first use from what the CPU
+ * supports (SSE4.1/AVX2 on x86, NEON on AArch64); d2k_fixed_batch_self_test
+ * checks each supported one against the scalar code.
+ *
+ * Output arrays may alias input arrays.
+ */
+
+enum {
+  D2K_FIXED_BATCH_UNSUPPORTED_IMPL = 1,
+  D2K_FIXED_BATCH_SELF_TEST_FAILED,
+};
+
+typedef enum {
+  D2K_FIXED_BATCH_IMPL_SCALAR,
+  D2K_FIXED_BATCH_IMPL_SSE41,
+  D2K_FIXED_BATCH_IMPL_AVX2,
+  D2K_FIXED_BATCH_IMPL_NEON,
+  D2K_FIXED_BATCH_IMPL_MAX,
+} D2KFixedBatchImpl;
+
+bool               d2k_fixed_batch_impl_supported(D2KFixedBatchImpl impl);
+const char*        d2k_fixed_batch_impl_name(D2KFixedBatchImpl impl);
+D2KFixedBatchImpl  d2k_fixed_batch_impl(void);
+
+/*
+ * Overrides runtime detection; mostly useful for tests and benchmarks.  Not
+ * safe to call while other threads are running batch kernels.
+ */
+bool d2k_fixed_batch_use_impl(D2KFixedBatchImpl impl, Status *status);
+
+/* out[i] = d2k_fixed_mul(a[i], b[i]) */
+void d2k_fixed_batch_mul(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                             const D2KFixedPoint *b,
+                                             size_t count);
+
+/* out[i] = d2k_fixed_div(a[i], b[i]) */
+void d2k_fixed_batch_div(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                             const D2KFixedPoint *b,
+                                             size_t count);
+
+/* out[i] = d2k_fixed_mul(ax[i], bx[i]) + d2k_fixed_mul(ay[i], by[i]) */
+void d2k_fixed_batch_dot(D2KFixedPoint *out, const D2KFixedPoint *ax,
+                                             const D2KFixedPoint *ay,
+                                             const D2KFixedPoint *bx,
+                                             const D2KFixedPoint *by,
+                                             size_t count);
+
+/* out[i] = d2k_fixed_approx_distance(dx[i], dy[i]) */
+void d2k_fixed_batch_approx_distance(D2KFixedPoint *out,
+                                     const D2KFixedPoint *dx,
+                                     const D2KFixedPoint *dy,
+                                     size_t count);
+
+/* out[i] = d2k_point_to_angle(tantoangle, dx[i], dy[i]) */
+void d2k_fixed_batch_point_to_angle(D2KAngle *out,
+                                    const D2KAngle *tantoangle,
+                                    const D2KFixedPoint *dx,
+                                    const D2KFixedPoint *dy,
+                                    size_t count);
+
+/*
+ * Runs every implementation this CPU supports over edge-case and random
+ * inputs, failing with D2K_FIXED_BATCH_SELF_TEST_FAILED on the first result
+ * that differs from the scalar code.
+ */
+bool d2k_fixed_batch_self_test(Status *status);
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
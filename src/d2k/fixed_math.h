@@ -81,12 +81,68 @@ static inline D2KFixedPoint d2k_fixed_mul(D2KFixedPoint a, D2KFixedPoint b) {
   return (D2KFixedPoint)((int64_t) a * b >> FRACBITS);
 }
 
+/*
+ * abs() as vanilla sees it: INT_MIN wraps to itself instead of tripping
+ * -ftrapv.
+ */
+static inline D2KFixedPoint d2k_fixed_abs(D2KFixedPoint fp) {
+  return (D2KFixedPoint)(fp < 0 ? 0u - (uint32_t)fp : (uint32_t)fp);
+}
+
+/*
+ * Vanilla's FixedDiv, with a 64-bit integer divide.  Kept as the reference
+ * d2k_fixed_div is checked against.
+ *
+ * INT_MIN / 0 gets past vanilla's overflow check and faults in the divide;
+ * here it saturates like every other division by zero.
+ */
+static inline D2KFixedPoint d2k_fixed_div_int64(D2KFixedPoint a,
+                                                D2KFixedPoint b) {
+  if ((d2k_fixed_abs(a) >> 14) >= d2k_fixed_abs(b) || b == 0) {
+    return ((a ^ b) >> 31) ^ INT_MAX;
+  }
+
+  return (D2KFixedPoint)(((int64_t) a * FRACUNIT) / b);
+}
+
+/*
+ * Same results as d2k_fixed_div_int64, but divides in double precision,
+ * which is quite a bit cheaper than a 64-bit integer divide on most CPUs.
+ *
+ * a * FRACUNIT fits in 47 bits, so it's exact as a double.  When the
+ * overflow check passes, the quotient's rounding error (under 2^-6 / |b|) is
+ * less than its distance to the next integer (at least 1 / |b|), so
+ * truncating it can't land on a different integer.  The exception is
+ * a == INT_MIN, whose abs() is negative and slips past the check with a
+ * quotient that doesn't fit; that keeps the integer divide's wraparound.
+ */
 static inline D2KFixedPoint d2k_fixed_div(D2KFixedPoint a, D2KFixedPoint b) {
-  if ((abs(a) >> 14) >= abs(b)) {
+  if ((d2k_fixed_abs(a) >> 14) >= d2k_fixed_abs(b) || b == 0) {
     return ((a ^ b) >> 31) ^ INT_MAX;
   }
 
-  return (D2KFixedPoint)((int64_t) a << FRACBITS) / b;
+  if (a == INT_MIN) {
+    return (D2KFixedPoint)(((int64_t) a * FRACUNIT) / b);
+  }
+
+  return (D2KFixedPoint)(((double) a * FRACUNIT) / b);
+}
+
+/*
+ * Vanilla's P_AproxDistance: the larger delta plus half the smaller.  Sums
+ * are done unsigned so that huge deltas wrap like vanilla instead of
+ * tripping -ftrapv.
+ */
+static inline D2KFixedPoint d2k_fixed_approx_distance(D2KFixedPoint dx,
+                                                      D2KFixedPoint dy) {
+  uint32_t adx = dx < 0 ? 0u - (uint32_t)dx : (uint32_t)dx;
+  uint32_t ady = dy < 0 ? 0u - (uint32_t)dy : (uint32_t)dy;
+
+  if ((D2KFixedPoint)adx < (D2KFixedPoint)ady) {
+    return (D2KFixedPoint)(adx + ady - (uint32_t)((D2KFixedPoint)adx >> 1));
+  }
+
+  return (D2KFixedPoint)(adx + ady - (uint32_t)((D2KFixedPoint)ady >> 1));
 }
 
 static inline D2KFixedPoint d2k_fixed_mod(D2KFixedPoint a, D2KFixedPoint b) {
@@ -23,14 +23,12 @@
 #ifndef D2K_FIXED_VERTEX_H__
 #define D2K_FIXED_VERTEX_H__
 
-#include "d2k/angle.h"
 #include "d2k/fixed_math.h"
 
+/* View angle caching lives in D2KMapScratch */
 typedef struct D2KFixedVertexStruct {
   D2KFixedPoint x;
   D2KFixedPoint y;
-  D2KAngle      view_angle;
-  int           angle_time;
 } D2KFixedVertex;
 
 #endif
@@ -0,0 +1,58 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_HASH_H__
+#define D2K_HASH_H__
+
+/*
+ * XXH64: a 64-bit content hash, several times faster than byte-at-a-time
+ * hashes like FNV-1a since it consumes 32 bytes per round in four
+ * independent lanes.  Results match the reference XXH64, so keys can be
+ * checked with stock tools (`xxhsum -H1`).
+ *
+ * Not cryptographic: fine for cache keys and compatibility checks, not for
+ * anything an attacker gets to choose inputs for.
+ */
+
+#define D2K_HASH_STRIPE_SIZE 32
+
+typedef struct D2KHashStruct {
+  uint64_t total_len;
+  uint64_t lanes[4];
+  uint64_t seed;
+  uint8_t  buffer[D2K_HASH_STRIPE_SIZE];
+  size_t   buffer_len;
+} D2KHash;
+
+/*
+ * Streaming interface: feeding data in any number of d2k_hash_update calls
+ * gives the same result as hashing it all at once.
+ */
+void     d2k_hash_init(D2KHash *hash, uint64_t seed);
+void     d2k_hash_update(D2KHash *hash, const void *data, size_t len);
+uint64_t d2k_hash_final(const D2KHash *hash);
+
+uint64_t d2k_hash(const void *data, size_t len, uint64_t seed);
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,120 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_LUMP_NAME_CACHE_H__
+#define D2K_LUMP_NAME_CACHE_H__
+
+/*
+ * Map lumps refer to textures and flats by their raw 8-byte names, and big
+ * maps reuse a few hundred names across tens of thousands of records.  This
+ * is a small direct-mapped cache from those raw names to resolved indices so
+ * that each distinct name is (usually) only looked up in the lump directory
+ * once per map load.  A collision simply evicts the previous entry.
+ */
+
+#define D2K_LUMP_NAME_CACHE_BITS 9
+#define D2K_LUMP_NAME_CACHE_SIZE (1 << D2K_LUMP_NAME_CACHE_BITS)
+
+typedef struct D2KLumpNameCacheEntryStruct {
+  uint64_t key;
+  size_t   index;
+} D2KLumpNameCacheEntry;
+
+typedef struct D2KLumpNameCacheStruct {
+  D2KLumpNameCacheEntry entries[D2K_LUMP_NAME_CACHE_SIZE];
+  size_t                hits;
+  size_t                misses;
+} D2KLumpNameCache;
+
+static inline void d2k_lump_name_cache_init(D2KLumpNameCache *cache) {
+  /* A zero key is an empty name, which is never resolved through the cache */
+  memset(cache->entries, 0, sizeof(cache->entries));
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+/*
+ * Builds a cache key from a raw 8-byte name field.  Everything after the
+ * first NUL is ignored (some editors leave garbage there), so the key
+ * compares equal exactly when the C string names do.
+ */
+static inline uint64_t d2k_lump_name_cache_key(const char *raw_name) {
+  uint64_t key = 0;
+
+  for (size_t i = 0; i < 8; i++) {
+    uint8_t c = (uint8_t)raw_name[i];
+
+    if (!c) {
+      break;
+    }
+
+    key |= ((uint64_t)c) << (i * 8);
+  }
+
+  return key;
+}
+
+static inline void d2k_lump_name_cache_key_to_name(uint64_t key,
+                                                   char name[9]) {
+  for (size_t i = 0; i < 8; i++) {
+    name[i] = (char)((key >> (i * 8)) & 0xFF);
+  }
+
+  name[8] = '\0';
+}
+
+static inline D2KLumpNameCacheEntry* d2k_lump_name_cache_slot(
+    D2KLumpNameCache *cache,
+    uint64_t key) {
+  /* Fibonacci hashing; the top bits of the product are the well-mixed ones */
+  uint64_t hash = key * UINT64_C(0x9E3779B97F4A7C15);
+
+  return &cache->entries[hash >> (64 - D2K_LUMP_NAME_CACHE_BITS)];
+}
+
+static inline bool d2k_lump_name_cache_get(D2KLumpNameCache *cache,
+                                           uint64_t key,
+                                           size_t *index) {
+  D2KLumpNameCacheEntry *entry = d2k_lump_name_cache_slot(cache, key);
+
+  if (key && entry->key == key) {
+    *index = entry->index;
+    cache->hits++;
+    return true;
+  }
+
+  cache->misses++;
+  return false;
+}
+
+static inline void d2k_lump_name_cache_put(D2KLumpNameCache *cache,
+                                           uint64_t key,
+                                           size_t index) {
+  D2KLumpNameCacheEntry *entry = d2k_lump_name_cache_slot(cache, key);
+
+  entry->key = key;
+  entry->index = index;
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
@@ -37,26 +37,46 @@ struct D2KMapObjectStruct;
 struct D2KFixedVertexStruct;
 struct D2KLumpDirectoryStruct;
 
-#define LUMP_DATA_INT_TO_FIXED(data, i) \
-    d2k_int_to_fixed_point(cble32((data[(i)    ] << 24) | \
-                                  (data[(i) + 1] << 16) | \
-                                  (data[(i) + 2] <<  8) | \
-                                  (data[(i) + 3])))
+#define BOXTOP    0
+#define BOXBOTTOM 1
+#define BOXLEFT   2
+#define BOXRIGHT  3
+
+/* Largest radius of any thing; blockboxes are padded by this much */
+#define MAXRADIUS (32 * FRACUNIT)
+
+/* On-disk record sizes of the vanilla map lumps */
+#define D2K_VANILLA_THING_SIZE            10
+#define D2K_VANILLA_LINEDEF_SIZE          14
+#define D2K_VANILLA_SIDEDEF_SIZE          30
+#define D2K_VANILLA_VERTEX_SIZE            4
+#define D2K_VANILLA_SEG_SIZE              12
+#define D2K_VANILLA_SUBSECTOR_SIZE         4
+#define D2K_VANILLA_NODE_SIZE             28
+#define D2K_VANILLA_SECTOR_SIZE           26
+#define D2K_VANILLA_BLOCKMAP_HEADER_SIZE   8
+
+/*
+ * Record fields are little-endian; these decode them with wad.h's
+ * d2k_lump_data_* helpers, same as the validator.  `data` is a record's
+ * bytes and `i` a byte offset into it.  32-bit values (GL vertexes) are
+ * already fixed point, 16-bit ones are whole units.
+ */
+#define LUMP_DATA_FIXED(data, i) \
+    ((D2KFixedPoint)d2k_lump_data_int32((data), (i)))
 
 #define LUMP_DATA_SHORT_TO_FIXED(data, i) \
-    d2k_int_to_fixed_point(cble16((data[(i)] << 8) | (data[(i) + 1])))
+    d2k_int_to_fixed_point(d2k_lump_data_int16((data), (i)))
 
 #define LUMP_DATA_SHORT_TO_ANGLE(data, i) \
-    (D2KAngle)((cble16((data[(i)] << 8) | (data[(i) + 1]))) << 16)
+    (((D2KAngle)d2k_lump_data_uint16((data), (i))) << 16)
 
-#define LUMP_DATA_SHORT_TO_SHORT(data, i) \
-    (int16_t)(cble16((data[(i)] << 8) | (data[(i) + 1])))
+#define LUMP_DATA_SHORT_TO_SHORT(data, i) d2k_lump_data_int16((data), (i))
 
-#define LUMP_DATA_SHORT_TO_USHORT(data, i) \
-    (uint16_t)(cble16((data[(i)] << 8) | (data[(i) + 1])))
+#define LUMP_DATA_SHORT_TO_USHORT(data, i) d2k_lump_data_uint16((data), (i))
 
 #define LUMP_DATA_SHORT_TO_SIZE_T(data, i) \
-    (size_t)((cble16((data[(i)] << 8) | (data[(i) + 1]))) << 16)
+    ((size_t)d2k_lump_data_uint16((data), (i)))
 
 #define LUMP_DATA_SHORT_TO_INDEX(data, i) LUMP_DATA_SHORT_TO_SIZE_T(data, i)
 
@@ -125,6 +145,11 @@ typedef enum {
   D2K_MAP_LUMP_ENDMAP,
 } D2KMapLump;
 
+/* Lump names, indexed by D2KVanillaMapLump, D2KGLMapLump and D2KUDMFMapLump */
+extern const char *d2k_map_lump_vanilla_names[D2K_VANILLA_MAP_LUMP_MAX];
+extern const char *d2k_map_lump_gl_names[D2K_GL_MAP_LUMP_MAX];
+extern const char *d2k_map_lump_udmf_names[D2K_UDMF_MAP_LUMP_MAX];
+
 typedef struct D2KMapSectorNodeStruct {
   struct D2KSectorStruct        *sector;
   struct D2KMapObjectStruct     *mobj;
@@ -142,12 +167,19 @@ typedef struct D2KSegLineStruct {
   D2KFixedPoint            y1;
   D2KFixedPoint            x2;
   D2KFixedPoint            y2;
-  D2KFixedPoint            bbox[4];
 } D2KSegLine;
 
+/*
+ * Walks of the geometry don't write to the map: the per-walk state they
+ * need (vanilla's `validcount` and friends) lives in D2KMapScratch or in the
+ * walker's own context.  Nothing enforces this, though, so sharing a loaded
+ * map between simulations or threads is only safe while callers leave it
+ * alone too; per-simulation edits go through D2KMapInstance.
+ */
 typedef struct D2KMapStruct {
   char        wad_name[6];
   char        gl_wad_name[9];
+  Array       things;
   Array       vertexes;
   Array       segs;
   Array       sectors;
@@ -155,13 +187,46 @@ typedef struct D2KMapStruct {
   Array       nodes;
   Array       linedefs;
   Array       sidedefs;
+  Array       sector_lines;
   Array       sslines;
+  Array       reject;
   D2KBlockmap blockmap;
+  struct D2KSectorStruct *null_sector;
+  uint64_t    hash;
 } D2KMap;
 
 void d2k_map_init(D2KMap *map);
 void d2k_map_clear(D2KMap *map);
 
+/*
+ * Boom's P_InitTagLists: chains sectors that share a tag through their
+ * first_tag and next_tag fields, so tag lookups don't scan every sector.
+ */
+void d2k_map_init_sector_tag_lists(D2KMap *map);
+
+/*
+ * P_FindSectorFromLineTag's first match: the lowest-numbered sector tagged
+ * `tag`, or NULL if there isn't one.  Needs the tag lists built.
+ */
+struct D2KSectorStruct* d2k_map_find_tagged_sector(D2KMap *map, int tag);
+
+/*
+ * Content hash of a map's lumps: each lump's name, size and data, in order,
+ * skipping NULL lumps.  The map marker isn't included, so a map keeps its
+ * hash when moved to another slot.  The loaders store this in map->hash.
+ */
+uint64_t d2k_map_hash_lumps(struct D2KLumpStruct **lumps, size_t lump_count);
+
+/*
+ * Like d2k_map_hash_lumps, over the directory's lumps from `start` up to (but
+ * not including) `end`.  UDMF maps use this, as they have no fixed lump set.
+ */
+uint64_t d2k_map_hash_lump_range(
+  struct D2KLumpDirectoryStruct *lump_directory,
+  size_t start,
+  size_t end
+);
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
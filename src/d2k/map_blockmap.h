@@ -25,6 +25,10 @@
 
 #include "d2k/fixed_math.h"
 
+#define MAPBLOCKSHIFT (FRACBITS + 7)
+#define MAPBLOCKSIZE  (1 << MAPBLOCKSHIFT)
+#define MAPBTOFRAC    (MAPBLOCKSHIFT - FRACBITS)
+
 struct D2KLumpStruct;
 struct D2KMapLoaderStruct;
 
@@ -0,0 +1,171 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_BLOCKMAP_THINGS_H__
+#define D2K_MAP_BLOCKMAP_THINGS_H__
+
+#include "d2k/fixed_math.h"
+#include "d2k/map_blockmap.h"
+#include "d2k/map_object.h"
+#include "d2k/map_object_slab.h"
+
+/*
+ * Which map objects are in each blockmap cell; vanilla's blocklinks.
+ *
+ * Rather than threading a linked list through the objects, every cell keeps
+ * an array of handles: the first few inline, spilling to the heap once a
+ * cell gets crowded.  Scanning a cell then reads its handles contiguously
+ * instead of chasing `bnext` through every object.
+ *
+ * Each object's cell and position in that cell's array live in `links`,
+ * indexed by slab slot.  A cell's handles stay in link order, oldest first,
+ * so unlinking shifts the later handles down; that only touches this small
+ * array, never the objects being shifted.  While a cell is being iterated,
+ * unlinking leaves a hole instead, and the cell is compacted when the walk
+ * finishes.
+ */
+
+#define D2K_BLOCKMAP_THINGS_INLINE_HANDLES 6
+
+/* `count` includes holes; `iterating` counts walks in progress */
+typedef struct D2KBlockmapThingCellStruct {
+  uint32_t            count;
+  uint32_t            capacity;
+  uint32_t            iterating;
+  uint32_t            holes;
+  D2KMapObjectHandle *spilled;
+  D2KMapObjectHandle  handles[D2K_BLOCKMAP_THINGS_INLINE_HANDLES];
+} D2KBlockmapThingCell;
+
+/* `cell` is the cell index plus one; 0 means not in the blockmap */
+typedef struct D2KBlockmapThingLinkStruct {
+  uint32_t cell;
+  uint32_t position;
+} D2KBlockmapThingLink;
+
+typedef struct D2KBlockmapThingsStruct {
+  size_t        width;
+  size_t        height;
+  D2KFixedPoint origin_x;
+  D2KFixedPoint origin_y;
+  Array         cells;
+  Array         links;
+} D2KBlockmapThings;
+
+/* Return false to stop iterating */
+typedef bool (*D2KBlockmapThingVisitor)(D2KMapObject *map_object, void *data);
+
+/* Sizes the index to match `blockmap`; every cell starts empty */
+bool d2k_blockmap_things_init(D2KBlockmapThings *things,
+                              D2KBlockmap *blockmap,
+                              Status *status);
+void d2k_blockmap_things_free(D2KBlockmapThings *things);
+
+/*
+ * P_SetThingPosition's blockmap half.  Objects outside the blockmap aren't
+ * linked anywhere, as in vanilla.  Linking an object that's already linked
+ * moves it.  Objects must be unlinked before they're removed from the slab,
+ * since the object that reuses the slot would otherwise inherit the link.
+ */
+bool d2k_blockmap_things_link(D2KBlockmapThings *things,
+                              D2KMapObject *map_object,
+                              Status *status);
+void d2k_blockmap_things_unlink(D2KBlockmapThings *things,
+                                D2KMapObject *map_object);
+
+/*
+ * Call after moving an object.  As with vanilla's P_UnsetThingPosition and
+ * P_SetThingPosition, it becomes the newest object in its cell even if it
+ * didn't leave that cell.
+ */
+bool d2k_blockmap_things_relink(D2KBlockmapThings *things,
+                                D2KMapObject *map_object,
+                                Status *status);
+
+/*
+ * P_BlockThingsIterator: visits the objects in one cell, newest first, and
+ * returns false if `visitor` did.  Out-of-range cells are empty.  `visitor`
+ * may unlink, relink or remove any object; each object in the cell when the
+ * walk starts is visited at most once, and objects unlinked or removed
+ * before their turn are skipped.
+ */
+bool d2k_blockmap_things_iterate(D2KBlockmapThings *things,
+                                 D2KMapObjectSlab *slab,
+                                 int block_x,
+                                 int block_y,
+                                 D2KBlockmapThingVisitor visitor,
+                                 void *data);
+
+/*
+ * Visits every cell overlapping the box, column by column as P_CheckPosition
+ * and P_RadiusAttack do.  Callers pad the box by MAXRADIUS themselves when
+ * they want things whose centers lie outside it.
+ */
+bool d2k_blockmap_things_iterate_box(D2KBlockmapThings *things,
+                                     D2KMapObjectSlab *slab,
+                                     D2KFixedPoint left,
+                                     D2KFixedPoint bottom,
+                                     D2KFixedPoint right,
+                                     D2KFixedPoint top,
+                                     D2KBlockmapThingVisitor visitor,
+                                     void *data);
+
+static inline int d2k_blockmap_things_block_x(D2KBlockmapThings *things,
+                                              D2KFixedPoint x) {
+  return (D2KFixedPoint)((uint32_t)x - (uint32_t)things->origin_x) >>
+         MAPBLOCKSHIFT;
+}
+
+static inline int d2k_blockmap_things_block_y(D2KBlockmapThings *things,
+                                              D2KFixedPoint y) {
+  return (D2KFixedPoint)((uint32_t)y - (uint32_t)things->origin_y) >>
+         MAPBLOCKSHIFT;
+}
+
+/* Returns NULL for out-of-range cells */
+static inline D2KBlockmapThingCell* d2k_blockmap_things_cell(
+    D2KBlockmapThings *things,
+    int block_x,
+    int block_y) {
+  if (block_x < 0 || block_y < 0 ||
+      (size_t)block_x >= things->width || (size_t)block_y >= things->height) {
+    return NULL;
+  }
+
+  return array_index_fast(
+    &things->cells,
+    ((size_t)block_y * things->width) + (size_t)block_x
+  );
+}
+
+static inline D2KMapObjectHandle* d2k_blockmap_thing_cell_handles(
+    D2KBlockmapThingCell *cell) {
+  if (cell->spilled) {
+    return cell->spilled;
+  }
+
+  return cell->handles;
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,179 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_INSTANCE_H__
+#define D2K_MAP_INSTANCE_H__
+
+#include "d2k/map.h"
+#include "d2k/map_linedefs.h"
+#include "d2k/map_sectors.h"
+#include "d2k/map_sidedefs.h"
+
+/*
+ * A map instance is one match's view of a loaded D2KMap, which it never
+ * writes to.  Sectors, linedefs and sidedefs are split into pages of
+ * D2K_MAP_INSTANCE_PAGE_SIZE elements; a page stays shared with the map
+ * until the instance first writes to something on it, at which point only
+ * that page is copied.  Starting a match is therefore just allocating the
+ * (small) page tables, and resetting one frees whatever pages it cloned.
+ *
+ * Pointers stored inside map objects (linedef->front_sector and so on)
+ * always point into the shared map.  Re-resolve them through the instance
+ * (d2k_map_instance_sector_of and friends) to see this match's values.
+ */
+#define D2K_MAP_INSTANCE_PAGE_SHIFT 6
+#define D2K_MAP_INSTANCE_PAGE_SIZE  (1 << D2K_MAP_INSTANCE_PAGE_SHIFT)
+#define D2K_MAP_INSTANCE_PAGE_MASK  (D2K_MAP_INSTANCE_PAGE_SIZE - 1)
+
+typedef struct D2KMapInstancePagesStruct {
+  Array  *shared;
+  size_t  element_size;
+  Array   pages;
+  size_t  copied_page_count;
+} D2KMapInstancePages;
+
+typedef struct D2KMapInstanceStruct {
+  D2KMap              *map;
+  D2KMapInstancePages  sectors;
+  D2KMapInstancePages  linedefs;
+  D2KMapInstancePages  sidedefs;
+} D2KMapInstance;
+
+bool d2k_map_instance_init(D2KMapInstance *instance, D2KMap *map,
+                                                     Status *status);
+void d2k_map_instance_free(D2KMapInstance *instance);
+
+/* Drops every cloned page, returning the instance to the map's state */
+void d2k_map_instance_reset(D2KMapInstance *instance);
+
+size_t d2k_map_instance_copied_page_count(D2KMapInstance *instance);
+
+/*
+ * The paging on its own, for other tables that want a copy-on-write view of
+ * a shared Array.  Resetting drops every cloned page.
+ */
+bool d2k_map_instance_pages_init(D2KMapInstancePages *pages,
+                                 Array *shared,
+                                 size_t element_size,
+                                 Status *status);
+void d2k_map_instance_pages_reset(D2KMapInstancePages *pages);
+void d2k_map_instance_pages_free(D2KMapInstancePages *pages);
+
+/*
+ * Makes the page holding element `index` private to this instance, copying
+ * it from the shared map if this is the first write to it.
+ */
+bool d2k_map_instance_pages_clone(D2KMapInstancePages *pages, size_t index,
+                                                              void **element,
+                                                              Status *status);
+
+static inline const void* d2k_map_instance_pages_get(
+    D2KMapInstancePages *pages,
+    size_t index) {
+  char *page = *(char **)array_index_fast(
+    &pages->pages,
+    index >> D2K_MAP_INSTANCE_PAGE_SHIFT
+  );
+
+  if (!page) {
+    return array_index_fast(pages->shared, index);
+  }
+
+  return page + ((index & D2K_MAP_INSTANCE_PAGE_MASK) * pages->element_size);
+}
+
+static inline const D2KSector* d2k_map_instance_sector(
+    D2KMapInstance *instance,
+    size_t index) {
+  return d2k_map_instance_pages_get(&instance->sectors, index);
+}
+
+static inline const D2KLinedef* d2k_map_instance_linedef(
+    D2KMapInstance *instance,
+    size_t index) {
+  return d2k_map_instance_pages_get(&instance->linedefs, index);
+}
+
+static inline const D2KSidedef* d2k_map_instance_sidedef(
+    D2KMapInstance *instance,
+    size_t index) {
+  return d2k_map_instance_pages_get(&instance->sidedefs, index);
+}
+
+static inline bool d2k_map_instance_edit_sector(D2KMapInstance *instance,
+                                                size_t index,
+                                                D2KSector **sector,
+                                                Status *status) {
+  return d2k_map_instance_pages_clone(
+    &instance->sectors, index, (void **)sector, status
+  );
+}
+
+static inline bool d2k_map_instance_edit_linedef(D2KMapInstance *instance,
+                                                 size_t index,
+                                                 D2KLinedef **linedef,
+                                                 Status *status) {
+  return d2k_map_instance_pages_clone(
+    &instance->linedefs, index, (void **)linedef, status
+  );
+}
+
+static inline bool d2k_map_instance_edit_sidedef(D2KMapInstance *instance,
+                                                 size_t index,
+                                                 D2KSidedef **sidedef,
+                                                 Status *status) {
+  return d2k_map_instance_pages_clone(
+    &instance->sidedefs, index, (void **)sidedef, status
+  );
+}
+
+/*
+ * Translate a pointer into the shared map into this instance's copy.  The
+ * null sector has no copy; it's returned as is.
+ */
+static inline const D2KSector* d2k_map_instance_sector_of(
+    D2KMapInstance *instance,
+    const D2KSector *shared_sector) {
+  if (d2k_map_sector_is_null(shared_sector)) {
+    return shared_sector;
+  }
+
+  return d2k_map_instance_sector(instance, shared_sector->id);
+}
+
+static inline const D2KLinedef* d2k_map_instance_linedef_of(
+    D2KMapInstance *instance,
+    const D2KLinedef *shared_linedef) {
+  return d2k_map_instance_linedef(instance, shared_linedef->id);
+}
+
+static inline const D2KSidedef* d2k_map_instance_sidedef_of(
+    D2KMapInstance *instance,
+    const D2KSidedef *shared_sidedef) {
+  const D2KSidedef *first = array_index_fast(&instance->map->sidedefs, 0);
+
+  return d2k_map_instance_sidedef(instance, shared_sidedef - first);
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
@@ -30,12 +30,14 @@ enum {
   D2K_MAP_LINEDEFS_MALFORMED_LUMP = 1,
   D2K_MAP_LINEDEFS_INVALID_LINEDEF_START_VERTEX_INDEX,
   D2K_MAP_LINEDEFS_INVALID_LINEDEF_END_VERTEX_INDEX,
-  D2K_MAP_LINEDEFS_INVALID_LINEDEF_TAGGED_SECTOR_INDEX,
   D2K_MAP_LINEDEFS_INVALID_LINEDEF_FRONT_SIDEDEF_INDEX,
   D2K_MAP_LINEDEFS_INVALID_LINEDEF_BACK_SIDEDEF_INDEX,
   D2K_MAP_SEGS_TWO_SIDED_SEG_MISSING_OTHER_SIDE,
 };
 
+/* A linedef's back sidedef index when it only has a front side */
+#define D2K_MAP_NO_SIDEDEF 0xFFFF
+
 typedef enum {
   D2K_LINEDEF_FLAG_BLOCKING        = (1 << 0),
   D2K_LINEDEF_FLAG_BLOCK_MONSTERS  = (1 << 1),
@@ -74,6 +76,7 @@ typedef struct D2KLinedefStruct {
   float                        texel_length;
   uint16_t                     flags;
   int16_t                      special;
+  int32_t                      tag;
   struct D2KSectorStruct      *tagged_sector;
   struct D2KSidedefStruct     *front_side;
   struct D2KSidedefStruct     *back_side;
@@ -81,12 +84,10 @@ typedef struct D2KLinedefStruct {
   D2KLinedefSlopeType          slope;
   struct D2KSectorStruct      *front_sector;
   struct D2KSectorStruct      *back_sector;
-  int                          valid_count;
   void                        *special_data;
   int                          tran_lump;
   int                          first_tag;
   int                          next_tag;
-  int                          r_valid_count;
   D2KLinedefRenderFlags        r_flags;
   D2KSoundOrigin               sound_origin;
 } D2KLinedef;
@@ -94,6 +95,12 @@ typedef struct D2KLinedefStruct {
 bool d2k_map_loader_load_linedefs(struct D2KMapLoaderStruct *map_loader,
                                   Status *status);
 
+/*
+ * Fills in everything derived from a linedef's vertexes: deltas, length,
+ * slope, bounding box and sound origin.  Also resets `tran_lump`.
+ */
+void d2k_map_linedef_set_geometry(D2KLinedef *linedef);
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
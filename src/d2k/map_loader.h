@@ -23,6 +23,7 @@
 #ifndef D2K_MAP_LOADER_H__
 #define D2K_MAP_LOADER_H__
 
+#include "d2k/lump_name_cache.h"
 #include "d2k/map.h"
 #include "d2k/map_nodes.h"
 #include "d2k/wad.h"
@@ -45,6 +46,7 @@ enum {
   D2K_MAP_MISSING_GL_NODES_LUMP,
   D2K_MAP_JUMBLED_LUMPS,
   D2K_MAP_MULTIPLE_NODES_VERSIONS,
+  D2K_MAP_MISSING_ENDMAP_LUMP,
 };
 
 typedef struct D2KMapLoaderStruct {
@@ -55,6 +57,9 @@ typedef struct D2KMapLoaderStruct {
   D2KLump            *udmf_start_map_lump;
   D2KLump            *udmf_end_map_lump;
   D2KMapNodesVersion  nodes_version;
+  D2KLumpNameCache    texture_name_cache;
+  D2KLumpNameCache    flat_name_cache;
+  Array              *repairs;
 } D2KMapLoader;
 
 bool d2k_map_loader_load_map(D2KMapLoader *map_loader,
@@ -63,6 +68,29 @@ bool d2k_map_loader_load_map(D2KMapLoader *map_loader,
                              const char *map_name,
                              Status *status);
 
+/*
+ * Like d2k_map_loader_load_map, but applies PrBoom+'s fixups where it would
+ * fail, appending a D2KMapProblem to `repairs` for each one:
+ * - segs with out-of-range vertexes use their linedef's vertexes
+ * - 2-sided segs missing the other side get the map's null sector (see
+ *   d2k_map_get_null_sector) as their back sector
+ * - out-of-range subsector children of nodes point at subsector 0
+ */
+bool d2k_map_loader_repair_map(D2KMapLoader *map_loader,
+                               D2KMap *map,
+                               D2KLumpDirectory *lump_directory,
+                               const char *map_name,
+                               Array *repairs,
+                               Status *status);
+bool d2k_map_loader_lookup_texture(D2KMapLoader *map_loader,
+                                   const char *raw_name,
+                                   size_t *texture_index,
+                                   Status *status);
+bool d2k_map_loader_lookup_flat(D2KMapLoader *map_loader,
+                                const char *raw_name,
+                                size_t *flat_index,
+                                Status *status);
+
 static inline
 size_t d2k_map_loader_vanilla_lump_offset(D2KMapLoader *map_loader) {
   return map_loader->map_lumps[D2K_VANILLA_MAP_LUMP_MAP]->index;
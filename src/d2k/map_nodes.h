@@ -27,6 +27,9 @@
 
 #define D2K_MAP_NODE_FLAGS_SUBSECTOR 0x80000000
 
+struct D2KMapStruct;
+struct D2KSubsectorStruct;
+
 enum {
   D2K_MAP_NODES_MALFORMED_LUMP = 1,
   D2K_MAP_NODES_MULTIPLE_TYPES_FOUND,
@@ -71,6 +74,47 @@ bool d2k_map_loader_detect_nodes_version(struct D2KMapLoaderStruct *map_loader,
 bool d2k_map_loader_load_nodes(struct D2KMapLoaderStruct *map_loader,
                                Status *status);
 
+/* R_PointOnSide: 0 for the front (right) side of the partition, 1 for back */
+static inline int d2k_map_node_point_on_side(const D2KMapNode *node,
+                                             D2KFixedPoint x,
+                                             D2KFixedPoint y) {
+  if (!node->dx) {
+    return x <= node->x ? node->dy > 0 : node->dy < 0;
+  }
+
+  if (!node->dy) {
+    return y <= node->y ? node->dx < 0 : node->dx > 0;
+  }
+
+  x -= node->x;
+  y -= node->y;
+
+  /* Signs alone decide it when the operands disagree */
+  if ((node->dy ^ node->dx ^ x ^ y) < 0) {
+    return (node->dy ^ x) < 0;
+  }
+
+  return d2k_fixed_mul(y, node->dx >> FRACBITS) >=
+         d2k_fixed_mul(node->dy >> FRACBITS, x);
+}
+
+static inline bool d2k_map_node_child_is_subsector(int child) {
+  return (child & D2K_MAP_NODE_FLAGS_SUBSECTOR) != 0;
+}
+
+/* A child of -1 (no nodes at all) refers to subsector 0 */
+static inline size_t d2k_map_node_child_subsector(int child) {
+  if (child == -1) {
+    return 0;
+  }
+
+  return (size_t)(child & ~D2K_MAP_NODE_FLAGS_SUBSECTOR);
+}
+
+struct D2KSubsectorStruct* d2k_map_point_in_subsector(struct D2KMapStruct *map,
+                                                      D2KFixedPoint x,
+                                                      D2KFixedPoint y);
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
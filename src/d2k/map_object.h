@@ -23,6 +23,7 @@
 #ifndef D2K_MAP_OBJECT_H__
 #define D2K_MAP_OBJECT_H__
 
+#include "d2k/angle.h"
 #include "d2k/sprite.h"
 #include "d2k/thinker.h"
 #include "d2k/map_object_info.h"
@@ -32,6 +33,15 @@
 
 struct D2KPlayer;
 
+/*
+ * Map objects refer to each other through slab handles rather than
+ * pointers; see map_object_slab.h.  A handle to a removed object simply
+ * stops resolving.
+ */
+typedef uint32_t D2KMapObjectHandle;
+
+#define D2K_MAP_OBJECT_HANDLE_NONE 0
+
 typedef struct D2KMapObjectStruct {
     D2KThinker                     thinker;
     D2KFixedPoint                  x;
@@ -42,8 +52,6 @@ typedef struct D2KMapObjectStruct {
     D2KAngle                       angle;
     D2KSpriteNum                   sprite;
     int                            frame;
-    struct D2KMapObjectStruct     *bnext;
-    struct D2KMapObjectStruct    **bprev;
     struct D2KSubSectorStruct     *sub_sector;
     D2KFixedPoint                  floorz;
     D2KFixedPoint                  ceilingz;
@@ -64,7 +72,7 @@ typedef struct D2KMapObjectStruct {
     short                          movedir;
     short                          movecount;
     short                          strafecount;
-    struct D2KMapObjectStruct     *target;
+    D2KMapObjectHandle             target;
     short                          reactiontime;
     short                          threshold;
     short                          pursuecount;
@@ -72,8 +80,8 @@ typedef struct D2KMapObjectStruct {
     struct D2KPlayer              *player;
     short                          lastlook;
     D2KMapThing                    spawnpoint;
-    struct D2KMapObjectStruct     *tracer;
-    struct D2KMapObjectStruct     *lastenemy;
+    D2KMapObjectHandle             tracer;
+    D2KMapObjectHandle             lastenemy;
     int                            friction;
     int                            move_factor;
     struct D2KMapSectorNodeStruct *touching_sectorlist;
@@ -82,6 +90,7 @@ typedef struct D2KMapObjectStruct {
     D2KFixedPoint                  prev_z;
     D2KAngle                       pitch;
     int                            index;
+    D2KMapObjectHandle             handle;
     short                          patch_width;
     int                            iden_nums;
     D2KFixedPoint                  pad;
@@ -0,0 +1,147 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_OBJECT_SLAB_H__
+#define D2K_MAP_OBJECT_SLAB_H__
+
+#include "d2k/map_object.h"
+
+/*
+ * Map object storage.  Objects live in fixed chunks that never move, and
+ * free slots are threaded onto an intrusive list, so spawning and removing
+ * are O(1) and only allocate when every chunk is full.
+ *
+ * Each slot has a generation that's bumped when its object is removed.  A
+ * handle packs the slot index with the generation it was issued under, so
+ * resolving a handle to a removed (or since reused) slot returns NULL
+ * instead of a dangling pointer.  Handle 0 is never issued.  Generations
+ * never wrap: a slot removed at D2K_MAP_OBJECT_HANDLE_GENERATION_MAX is
+ * retired, and its memory isn't reused until the slab is freed.
+ */
+
+#define D2K_MAP_OBJECT_SLAB_CHUNK_SIZE      1024
+#define D2K_MAP_OBJECT_HANDLE_INDEX_BITS    20
+#define D2K_MAP_OBJECT_HANDLE_INDEX_MASK \
+  ((1u << D2K_MAP_OBJECT_HANDLE_INDEX_BITS) - 1)
+#define D2K_MAP_OBJECT_HANDLE_GENERATION_MAX \
+  ((1u << (32 - D2K_MAP_OBJECT_HANDLE_INDEX_BITS)) - 1)
+#define D2K_MAP_OBJECT_SLAB_MAX_OBJECTS \
+  (D2K_MAP_OBJECT_HANDLE_INDEX_MASK + 1)
+
+#define D2K_MAP_OBJECT_SLAB_NO_SLOT UINT32_MAX
+
+enum {
+  D2K_MAP_OBJECT_SLAB_FULL = 1,
+};
+
+typedef struct D2KMapObjectSlotStruct {
+  uint16_t generation;
+  bool     live;
+  uint32_t next_free;
+} D2KMapObjectSlot;
+
+typedef struct D2KMapObjectSlabStruct {
+  Array    chunks;
+  Array    slots;
+  uint32_t free_head;
+  size_t   live_count;
+} D2KMapObjectSlab;
+
+/* Preallocates room for `capacity` objects */
+bool d2k_map_object_slab_init(D2KMapObjectSlab *slab, size_t capacity,
+                                                      Status *status);
+void d2k_map_object_slab_free(D2KMapObjectSlab *slab);
+
+/*
+ * Returns a zeroed object whose `handle` field is already set.  Fails with
+ * D2K_MAP_OBJECT_SLAB_FULL past D2K_MAP_OBJECT_SLAB_MAX_OBJECTS.
+ */
+bool d2k_map_object_slab_spawn(D2KMapObjectSlab *slab,
+                               D2KMapObject **map_object,
+                               Status *status);
+
+/* Removing an already-removed object (a stale handle) does nothing */
+void d2k_map_object_slab_remove(D2KMapObjectSlab *slab,
+                                D2KMapObjectHandle handle);
+
+static inline uint32_t d2k_map_object_handle_index(D2KMapObjectHandle handle) {
+  return handle & D2K_MAP_OBJECT_HANDLE_INDEX_MASK;
+}
+
+static inline uint32_t d2k_map_object_handle_generation(
+    D2KMapObjectHandle handle) {
+  return handle >> D2K_MAP_OBJECT_HANDLE_INDEX_BITS;
+}
+
+static inline D2KMapObject* d2k_map_object_slab_slot_object(
+    D2KMapObjectSlab *slab,
+    uint32_t index) {
+  D2KMapObject *chunk = *(D2KMapObject **)array_index_fast(
+    &slab->chunks,
+    index / D2K_MAP_OBJECT_SLAB_CHUNK_SIZE
+  );
+
+  return &chunk[index % D2K_MAP_OBJECT_SLAB_CHUNK_SIZE];
+}
+
+/* Returns NULL for D2K_MAP_OBJECT_HANDLE_NONE and for stale handles */
+static inline D2KMapObject* d2k_map_object_slab_get(
+    D2KMapObjectSlab *slab,
+    D2KMapObjectHandle handle) {
+  uint32_t index = d2k_map_object_handle_index(handle);
+  D2KMapObjectSlot *slot;
+
+  if (index >= slab->slots.len) {
+    return NULL;
+  }
+
+  slot = array_index_fast(&slab->slots, index);
+
+  if ((!slot->live) ||
+      (slot->generation != d2k_map_object_handle_generation(handle))) {
+    return NULL;
+  }
+
+  return d2k_map_object_slab_slot_object(slab, index);
+}
+
+/*
+ * Walks live objects in slot order: start `index` at 0, and it returns NULL
+ * when there are no more.
+ */
+static inline D2KMapObject* d2k_map_object_slab_next(D2KMapObjectSlab *slab,
+                                                     uint32_t *index) {
+  while (*index < slab->slots.len) {
+    uint32_t i = (*index)++;
+    D2KMapObjectSlot *slot = array_index_fast(&slab->slots, i);
+
+    if (slot->live) {
+      return d2k_map_object_slab_slot_object(slab, i);
+    }
+  }
+
+  return NULL;
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
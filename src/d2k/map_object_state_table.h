@@ -0,0 +1,135 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_OBJECT_STATE_TABLE_H__
+#define D2K_MAP_OBJECT_STATE_TABLE_H__
+
+#include "d2k/map_object_state.h"
+
+/*
+ * A read-only, compiled copy of the state table, split by how often each
+ * field is read.  What every actor needs every tic (tics, next state and
+ * action) is packed into 8-byte rows; sprite, frame and the misc fields go
+ * in a separate array that only state changes and the renderer touch.
+ * Actions are stored as indices into a deduplicated table, 0 meaning none.
+ *
+ * Actors' tic counters and current states live in parallel arrays owned by
+ * the caller, so the batch advance streams through two flat arrays and only
+ * does real work for the few actors changing state this tic.
+ */
+
+#define D2K_MAP_OBJECT_STATE_TABLE_MAX_STATES UINT16_MAX
+
+enum {
+  D2K_MAP_OBJECT_STATE_TABLE_TOO_MANY_STATES = 1,
+  D2K_MAP_OBJECT_STATE_TABLE_INVALID_NEXT_STATE,
+};
+
+typedef struct D2KMapObjectStateHotStruct {
+  int32_t  tics;
+  uint16_t next_state;
+  uint16_t action;
+} D2KMapObjectStateHot;
+
+typedef struct D2KMapObjectStateColdStruct {
+  D2KSpriteNum sprite;
+  int32_t      frame;
+  int32_t      misc1;
+  int32_t      misc2;
+} D2KMapObjectStateCold;
+
+/* `advancing` is the actor the batch advance is dispatching, plus one */
+typedef struct D2KMapObjectStateTableStruct {
+  Array  hot;
+  Array  cold;
+  Array  actions;
+  size_t advancing;
+} D2KMapObjectStateTable;
+
+/*
+ * Called as actor `actor` enters `state`, for states with an action and for
+ * the null state (where vanilla removes the actor).  Return false when the
+ * actor's gone, to stop advancing it.
+ */
+typedef bool (*D2KMapObjectStateHandler)(size_t actor,
+                                         uint32_t state,
+                                         D2KActionFunction action,
+                                         void *data);
+
+bool d2k_map_object_state_table_init(D2KMapObjectStateTable *table,
+                                     const D2KMapObjectState *states,
+                                     size_t state_count,
+                                     Status *status);
+void d2k_map_object_state_table_free(D2KMapObjectStateTable *table);
+
+/*
+ * P_SetMobjState: enters `state` and keeps following zero-tic states,
+ * calling `handler` as it goes.  Returns false if the actor hit the null
+ * state or `handler` returned false, and also if `state` isn't in the table,
+ * in which case the actor is left as it was.
+ */
+bool d2k_map_object_state_table_set_state(D2KMapObjectStateTable *table,
+                                          int32_t *tics,
+                                          uint32_t *states,
+                                          size_t actor,
+                                          uint32_t state,
+                                          D2KMapObjectStateHandler handler,
+                                          void *data);
+
+/*
+ * P_MobjThinker's state half for `count` actors at once: counts every
+ * actor's tics down (-1 meaning forever), then moves the ones that reached
+ * zero on to their next state.  Vanilla counts down and acts one thinker at
+ * a time, so when an action sets the state of an actor further on, that
+ * actor's new tics are counted down straight away, as its own thinker would
+ * have done later in the tic.
+ */
+void d2k_map_object_state_table_advance(D2KMapObjectStateTable *table,
+                                        int32_t *tics,
+                                        uint32_t *states,
+                                        size_t count,
+                                        D2KMapObjectStateHandler handler,
+                                        void *data);
+
+static inline D2KMapObjectStateHot* d2k_map_object_state_table_hot(
+    D2KMapObjectStateTable *table,
+    uint32_t state) {
+  return array_index_fast(&table->hot, state);
+}
+
+static inline D2KMapObjectStateCold* d2k_map_object_state_table_cold(
+    D2KMapObjectStateTable *table,
+    uint32_t state) {
+  return array_index_fast(&table->cold, state);
+}
+
+static inline D2KActionFunction d2k_map_object_state_table_action(
+    D2KMapObjectStateTable *table,
+    uint32_t state) {
+  D2KMapObjectStateHot *hot = d2k_map_object_state_table_hot(table, state);
+
+  return *(D2KActionFunction *)array_index_fast(&table->actions, hot->action);
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
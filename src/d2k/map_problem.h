@@ -23,27 +23,140 @@
 #ifndef D2K_MAP_PROBLEM_H__
 #define D2K_MAP_PROBLEM_H__
 
+#include "d2k/map.h"
+
+/*
+ * A problem found while validating a map.  `lump` is the lump it was found
+ * in and `record` the index of the offending record within that lump (the
+ * block index for blockmap problems, 0 for problems with a whole lump).
+ * Problems without extra detail leave `as` zeroed.
+ */
+
+typedef enum {
+  D2K_MAP_PROBLEM_NONE,
+  D2K_MAP_PROBLEM_MISSING_LUMP,
+  D2K_MAP_PROBLEM_JUMBLED_LUMPS,
+  D2K_MAP_PROBLEM_MALFORMED_LUMP,
+  D2K_MAP_PROBLEM_UDMF_SYNTAX_ERROR,
+  D2K_MAP_PROBLEM_INVALID_LINEDEF_START_VERTEX_INDEX,
+  D2K_MAP_PROBLEM_INVALID_LINEDEF_END_VERTEX_INDEX,
+  D2K_MAP_PROBLEM_INVALID_LINEDEF_FRONT_SIDEDEF_INDEX,
+  D2K_MAP_PROBLEM_INVALID_LINEDEF_BACK_SIDEDEF_INDEX,
+  D2K_MAP_PROBLEM_TWO_SIDED_LINEDEF_MISSING_BACK_SIDE,
+  D2K_MAP_PROBLEM_INVALID_SIDEDEF_SECTOR_INDEX,
+  D2K_MAP_PROBLEM_INVALID_SEG_START_VERTEX_INDEX,
+  D2K_MAP_PROBLEM_INVALID_SEG_END_VERTEX_INDEX,
+  D2K_MAP_PROBLEM_INVALID_SEG_LINEDEF_INDEX,
+  D2K_MAP_PROBLEM_INVALID_SEG_LINE_SIDE,
+  D2K_MAP_PROBLEM_TWO_SIDED_SEG_MISSING_OTHER_SIDE,
+  D2K_MAP_PROBLEM_OUT_OF_RANGE_SEG_LIST,
+  D2K_MAP_PROBLEM_INVALID_NODE_CHILD_INDEX,
+  D2K_MAP_PROBLEM_TRUNCATED_BLOCKMAP_HEADER,
+  D2K_MAP_PROBLEM_NEGATIVE_BLOCKMAP_WIDTH,
+  D2K_MAP_PROBLEM_NEGATIVE_BLOCKMAP_HEIGHT,
+  D2K_MAP_PROBLEM_TRUNCATED_BLOCKMAP_LINE_LIST_DIRECTORY,
+  D2K_MAP_PROBLEM_INVALID_OFFSET_IN_BLOCKMAP_DIRECTORY,
+  D2K_MAP_PROBLEM_UNTERMINATED_BLOCKMAP_LINE_LIST,
+  D2K_MAP_PROBLEM_INVALID_BLOCKMAP_LINEDEF_INDEX,
+  D2K_MAP_PROBLEM_TRUNCATED_REJECT,
+  D2K_MAP_PROBLEM_TYPE_MAX,
+} D2KMapProblemType;
+
+/* The lump's size isn't a multiple of its record size */
+typedef struct D2KMapProblemMalformedLumpStruct {
+  size_t lump_size;
+  size_t record_size;
+} D2KMapProblemMalformedLump;
+
+/* `offset` is where parsing stopped, `code` the D2K_MAP_UDMF_* error */
+typedef struct D2KMapProblemUDMFSyntaxErrorStruct {
+  size_t offset;
+  int    code;
+} D2KMapProblemUDMFSyntaxError;
+
+/*
+ * `index` isn't one of the `count` records it refers to.  It's signed since
+ * UDMF indices can be negative.
+ */
+typedef struct D2KMapProblemInvalidIndexStruct {
+  int64_t index;
+  size_t  count;
+} D2KMapProblemInvalidIndex;
+
+typedef struct D2KMapProblemInvalidSegLineSideStruct {
+  int16_t side;
+} D2KMapProblemInvalidSegLineSide;
+
+typedef struct D2KMapProblemOutOfRangeSegListStruct {
+  size_t first_seg;
+  size_t seg_count;
+  size_t total_seg_count;
+} D2KMapProblemOutOfRangeSegList;
+
+typedef struct D2KMapProblemInvalidNodeChildIndexStruct {
+  size_t side;
+  bool   subsector;
+  size_t index;
+  size_t count;
+} D2KMapProblemInvalidNodeChildIndex;
+
 typedef struct D2KMapProblemTruncatedBlockmapHeaderStruct {
+  size_t lump_size;
 } D2KMapProblemTruncatedBlockmapHeader;
 
-typedef struct D2KMapProblemNegativeBlockmapHeightStruct{
+typedef struct D2KMapProblemNegativeBlockmapHeightStruct {
   int16_t blockmap_height;
 } D2KMapProblemNegativeBlockmapHeight;
 
-typedef struct D2KMapProblemNegativeBlockmapWidthStruct{
+typedef struct D2KMapProblemNegativeBlockmapWidthStruct {
   int16_t blockmap_width;
 } D2KMapProblemNegativeBlockmapWidth;
 
-typedef struct D2KMapProblemStruct{
-} D2KMapProblem;
+typedef struct D2KMapProblemTruncatedBlockmapLineListDirectoryStruct {
+  size_t lump_size;
+  size_t block_count;
+} D2KMapProblemTruncatedBlockmapLineListDirectory;
+
+/* Offsets are in 16-bit words from the start of the lump, as stored */
+typedef struct D2KMapProblemBlockmapLineListStruct {
+  size_t offset;
+} D2KMapProblemBlockmapLineList;
+
+typedef struct D2KMapProblemTruncatedRejectStruct {
+  size_t lump_size;
+  size_t expected_size;
+} D2KMapProblemTruncatedReject;
 
 typedef struct D2KMapProblemStruct {
-  int type;
+  D2KMapProblemType type;
+  D2KMapLump        lump;
+  size_t            record;
   union {
-    D2KMapProblemTruncatedBlockmapHeader truncated_blockmap_header;
+    D2KMapProblemMalformedLump                      malformed_lump;
+    D2KMapProblemUDMFSyntaxError                    udmf_syntax_error;
+    D2KMapProblemInvalidIndex                       invalid_index;
+    D2KMapProblemInvalidSegLineSide                 invalid_seg_line_side;
+    D2KMapProblemOutOfRangeSegList                  out_of_range_seg_list;
+    D2KMapProblemInvalidNodeChildIndex              invalid_node_child_index;
+    D2KMapProblemTruncatedBlockmapHeader            truncated_blockmap_header;
+    D2KMapProblemNegativeBlockmapHeight             negative_blockmap_height;
+    D2KMapProblemNegativeBlockmapWidth              negative_blockmap_width;
+    D2KMapProblemTruncatedBlockmapLineListDirectory
+      truncated_blockmap_line_list_directory;
+    D2KMapProblemBlockmapLineList                   blockmap_line_list;
+    D2KMapProblemTruncatedReject                    truncated_reject;
   } as;
 } D2KMapProblem;
 
+/*
+ * Appends a zeroed problem of `type` to `problems`; `problem` (if not NULL)
+ * is pointed at it so the caller can fill in the details.
+ */
+bool d2k_map_problem_add(Array *problems, D2KMapProblemType type,
+                                         D2KMapLump lump,
+                                         size_t record,
+                                         D2KMapProblem **problem,
+                                         Status *status);
 
 #endif
 
@@ -0,0 +1,61 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_REJECT_H__
+#define D2K_MAP_REJECT_H__
+
+#include "d2k/map.h"
+
+struct D2KMapLoaderStruct;
+
+/*
+ * REJECT is a sector_count x sector_count bit matrix; a set bit at
+ * (looker, target) means the target can never be seen from the looker's
+ * sector.  Short lumps are zero-padded on load, so lookups never go out of
+ * bounds.
+ */
+
+bool d2k_map_loader_load_reject(struct D2KMapLoaderStruct *map_loader,
+                                Status *status);
+
+static inline size_t d2k_map_reject_bit(D2KMap *map, size_t looker_sector,
+                                                     size_t target_sector) {
+  return (looker_sector * map->sectors.len) + target_sector;
+}
+
+static inline bool d2k_map_reject_bit_set(D2KMap *map, size_t bit) {
+  uint8_t *byte = array_index_fast(&map->reject, bit >> 3);
+
+  return ((*byte) & (1 << (bit & 7))) != 0;
+}
+
+static inline bool d2k_map_reject_blocks(D2KMap *map, size_t looker_sector,
+                                                      size_t target_sector) {
+  return d2k_map_reject_bit_set(
+    map,
+    d2k_map_reject_bit(map, looker_sector, target_sector)
+  );
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
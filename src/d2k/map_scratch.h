@@ -0,0 +1,62 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_SCRATCH_H__
+#define D2K_MAP_SCRATCH_H__
+
+#include "d2k/angle.h"
+#include "d2k/map.h"
+#include "d2k/stamp_table.h"
+
+/*
+ * Everything a running game scribbles on while walking map geometry, kept
+ * in tables indexed by linedef/sector/vertex ID so walks don't write to the
+ * D2KMap itself.  Each simulation (and each thread within one) owns its own
+ * D2KMapScratch; any number of them can share one map.
+ */
+typedef struct D2KMapScratchStruct {
+  D2KMap        *map;
+  D2KStampTable  lines;
+  D2KStampTable  render_lines;
+  D2KStampTable  sectors;
+  Array          vertex_view_angles;
+  Array          vertex_angle_times;
+} D2KMapScratch;
+
+bool d2k_map_scratch_init(D2KMapScratch *scratch, D2KMap *map,
+                                                  Status *status);
+void d2k_map_scratch_free(D2KMapScratch *scratch);
+
+static inline D2KAngle* d2k_map_scratch_vertex_view_angle(
+    D2KMapScratch *scratch,
+    size_t vertex_index) {
+  return array_index_fast(&scratch->vertex_view_angles, vertex_index);
+}
+
+static inline int* d2k_map_scratch_vertex_angle_time(D2KMapScratch *scratch,
+                                                     size_t vertex_index) {
+  return array_index_fast(&scratch->vertex_angle_times, vertex_index);
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
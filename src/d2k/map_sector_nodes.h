@@ -0,0 +1,94 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_SECTOR_NODES_H__
+#define D2K_MAP_SECTOR_NODES_H__
+
+#include "d2k/map.h"
+
+struct D2KMapObjectStruct;
+
+/*
+ * Boom's touching_sectorlist/touching_thinglist: which sectors each map
+ * object overlaps, and which objects overlap each sector, as one node per
+ * (object, sector) pair threaded onto both lists.
+ *
+ * Nodes come from chunks that are never freed until the pool is, and spent
+ * nodes go onto a free list, so relinking an object doesn't allocate once
+ * the pool has warmed up.  The per-sector list heads live here rather than
+ * on D2KSector, so linking doesn't write to the map.
+ *
+ * Relinking is incremental, as in Boom's P_CreateSecNodeList: `begin`
+ * marks the object's current nodes, `touch` re-marks (or adds) each sector
+ * it still overlaps, and `end` drops the rest.  Sectors the object stays in
+ * are never unlinked and relinked.
+ */
+
+#define D2K_MAP_SECTOR_NODES_CHUNK_SIZE 512
+
+typedef struct D2KMapSectorNodesStruct {
+  D2KMap           *map;
+  Array             chunks;
+  Array             sector_heads;
+  D2KMapSectorNode *free_nodes;
+  size_t            live_count;
+} D2KMapSectorNodes;
+
+bool d2k_map_sector_nodes_init(D2KMapSectorNodes *nodes, D2KMap *map,
+                                                         Status *status);
+void d2k_map_sector_nodes_free(D2KMapSectorNodes *nodes);
+
+/*
+ * Recycles every node at once and resizes the sector heads for `map`; for
+ * map changes.  Objects still pointing at their old lists must be discarded
+ * too.
+ */
+bool d2k_map_sector_nodes_reset(D2KMapSectorNodes *nodes, D2KMap *map,
+                                                          Status *status);
+
+void d2k_map_sector_nodes_begin(struct D2KMapObjectStruct *map_object);
+bool d2k_map_sector_nodes_touch(D2KMapSectorNodes *nodes,
+                                struct D2KMapObjectStruct *map_object,
+                                struct D2KSectorStruct *sector,
+                                Status *status);
+void d2k_map_sector_nodes_end(D2KMapSectorNodes *nodes,
+                              struct D2KMapObjectStruct *map_object);
+
+/* P_DelSeclist: unlinks an object from every sector, e.g. on removal */
+void d2k_map_sector_nodes_unlink_all(D2KMapSectorNodes *nodes,
+                                     struct D2KMapObjectStruct *map_object);
+
+/*
+ * First node in a sector's list of objects.  As in Boom, the `*_thing_*`
+ * links run through an object's sectors and the `*_sector_*` links through
+ * a sector's objects, so follow `next_sector_map_sector_node`.
+ */
+static inline D2KMapSectorNode* d2k_map_sector_nodes_sector_things(
+    D2KMapSectorNodes *nodes,
+    size_t sector_id) {
+  return *(D2KMapSectorNode **)array_index_fast(&nodes->sector_heads,
+                                                sector_id);
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
@@ -25,8 +25,10 @@
 #define D2K_MAP_SECTORS_H__
 
 #include "d2k/fixed_math.h"
+#include "d2k/map.h"
 #include "d2k/sound_origin.h"
 
+struct D2KLinedefStruct;
 struct D2KMapObjectStruct;
 struct D2KMapSectorNodeStruct;
 
@@ -34,6 +36,8 @@ enum {
   D2K_MAP_SECTORS_MALFORMED_LUMP = 1,
 };
 
+#define D2K_MAP_NULL_SECTOR_ID UINT32_MAX
+
 typedef struct D2KSectorStruct {
   uint32_t                        id;
   uint32_t                        flags;
@@ -46,7 +50,6 @@ typedef struct D2KSectorStruct {
   int                             blockbox[4];
   int                             bbox[4];
   D2KSoundOrigin                  sound_origin;
-  int                             valid_count;
   struct D2KMapObjectStruct      *things;
   int                             friction;
   int                             move_factor;
@@ -61,7 +64,8 @@ typedef struct D2KSectorStruct {
   int                             mid_map;
   int                             top_map;
   struct D2KMapSectorNodeStruct  *touching_thinglist;
-  PArray                          lines;
+  size_t                          first_line;
+  size_t                          line_count;
   int                             sky;
   D2KFixedPoint                   floor_x_offset;
   D2KFixedPoint                   floor_y_offset;
@@ -84,6 +88,35 @@ typedef struct D2KSectorStruct {
 
 bool d2k_map_loader_load_sectors(struct D2KMapLoaderStruct *map_loader,
                                  Status *status);
+bool d2k_map_loader_group_lines(struct D2KMapLoaderStruct *map_loader,
+                                Status *status);
+
+/*
+ * PrBoom+'s GetSectorAtNullAddress: vanilla reads a 2-sided seg's missing
+ * back sector from address 0, which PrBoom+ emulates with a zeroed sector.
+ * It's allocated on first use and owned by the map; it isn't in
+ * map->sectors, and its id is D2K_MAP_NULL_SECTOR_ID.
+ */
+bool d2k_map_get_null_sector(D2KMap *map, D2KSector **sector, Status *status);
+
+/*
+ * The null sector's id isn't an index into map->sectors, so anything that
+ * indexes a per-sector table by id has to check for it first.
+ */
+static inline bool d2k_map_sector_is_null(const D2KSector *sector) {
+  return sector->id == D2K_MAP_NULL_SECTOR_ID;
+}
+
+/*
+ * A sector's lines are a span of `line_count` entries in `map->sector_lines`
+ * starting at `first_line`.
+ */
+static inline struct D2KLinedefStruct** d2k_map_sector_lines(
+    D2KMap *map,
+    D2KSector *sector) {
+  return (struct D2KLinedefStruct **)array_index_fast(&map->sector_lines,
+                                                      sector->first_line);
+}
 
 #endif
 
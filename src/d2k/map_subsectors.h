@@ -28,17 +28,28 @@
 enum {
   D2K_MAP_SUBSECTORS_MALFORMED_LUMP = 1,
   D2K_MAP_SUBSECTORS_OUT_OF_RANGE_SEG_LIST,
+  D2K_MAP_SUBSECTORS_NO_SECTOR,
 };
 
 typedef struct D2KSubsectorStruct {
   struct D2KSectorStruct *sector;
   size_t                  seg_count;
   size_t                  first_seg;
+  size_t                  first_ssline;
+  size_t                  ssline_count;
 } D2KSubsector;
 
 bool d2k_map_loader_load_subsectors(struct D2KMapLoaderStruct *map_loader,
                                     Status *status);
 
+/*
+ * Resolves each subsector's sector from its first seg with a sidedef, and
+ * fills map->sslines with the linedef geometry of every non-mini seg, grouped
+ * by subsector.  Must run after segs are loaded.
+ */
+bool d2k_map_loader_link_subsectors(struct D2KMapLoaderStruct *map_loader,
+                                    Status *status);
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
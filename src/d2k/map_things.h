@@ -23,10 +23,51 @@
 #ifndef D2K_MAP_THINGS_H__
 #define D2K_MAP_THINGS_H__
 
+#include "d2k/map_object_info.h"
+
 enum {
   D2K_MAP_THINGS_MALFORMED_LUMP = 1,
+  D2K_MAP_THINGS_TOO_MANY_TYPES,
+  D2K_MAP_THINGS_TOO_MANY_THINGS,
 };
 
+#define D2K_MAP_THING_OPTION_EASY             1
+#define D2K_MAP_THING_OPTION_NORMAL           2
+#define D2K_MAP_THING_OPTION_HARD             4
+#define D2K_MAP_THING_OPTION_AMBUSH           8
+#define D2K_MAP_THING_OPTION_NOT_SINGLE      16
+#define D2K_MAP_THING_OPTION_NOT_DEATHMATCH  32
+#define D2K_MAP_THING_OPTION_NOT_COOP        64
+#define D2K_MAP_THING_OPTION_FRIEND         128
+#define D2K_MAP_THING_OPTION_RESERVED       256
+
+/*
+ * Boom reserves 256, so a thing with it set comes from an editor that filled
+ * in bits vanilla ignored.  As in PrBoom, those things keep only these.
+ */
+#define D2K_MAP_THING_VANILLA_OPTIONS (D2K_MAP_THING_OPTION_EASY   | \
+                                       D2K_MAP_THING_OPTION_NORMAL | \
+                                       D2K_MAP_THING_OPTION_HARD   | \
+                                       D2K_MAP_THING_OPTION_AMBUSH | \
+                                       D2K_MAP_THING_OPTION_NOT_SINGLE)
+
+#define D2K_MAP_THING_DEATHMATCH_START 11
+
+/* Map object type of things no info claims, including player starts */
+#define D2K_MAP_THING_NO_TYPE UINT16_MAX
+
+/*
+ * A thing's spawn class is its skill bits plus its three Boom "not in this
+ * mode" bits, so there are 64 of them.
+ */
+#define D2K_MAP_THING_CLASS_COUNT 64
+
+typedef enum {
+  D2K_MAP_THING_PLAY_MODE_SINGLE_PLAYER,
+  D2K_MAP_THING_PLAY_MODE_COOPERATIVE,
+  D2K_MAP_THING_PLAY_MODE_DEATHMATCH,
+} D2KMapThingPlayMode;
+
 typedef struct D2KMapThingStruct {
   int16_t x;
   int16_t y;
@@ -35,9 +76,127 @@ typedef struct D2KMapThingStruct {
   int16_t options;
 } D2KMapThing;
 
+/* Dense doomednum -> map object type lookup, built once per info table */
+typedef struct D2KMapThingTypesStruct {
+  Array  types;
+  size_t type_count;
+} D2KMapThingTypes;
+
+/*
+ * A map's things, resolved against a D2KMapThingTypes and bucketed by type
+ * and spawn class.
+ *
+ * Things have to spawn in lump order, since spawning calls P_Random and
+ * links objects into the blockmap and thinker list; walking the class
+ * buckets one after another would desync demos.  So each thing's type and
+ * class sit in arrays parallel to `map->things`, and a spawn pass is one
+ * linear scan testing each class against a 64-bit mask.  The class buckets
+ * are just counts, enough to size a slab before spawning.
+ *
+ * The type buckets hold indexes into `map->things`, in lump order, for
+ * lookups like "every boss target" or "every player start" (the latter via
+ * the D2K_MAP_THING_NO_TYPE bucket, since doomednums 1-4 and 11 aren't in
+ * any info).
+ */
+typedef struct D2KMapThingTableStruct {
+  struct D2KMapStruct *map;
+  Array                types;
+  Array                classes;
+  Array                type_indexes;
+  Array                type_starts;
+  size_t               type_count;
+  size_t               class_counts[D2K_MAP_THING_CLASS_COUNT];
+} D2KMapThingTable;
+
+/* Return false to stop iterating */
+typedef bool (*D2KMapThingVisitor)(const D2KMapThing *thing,
+                                   uint16_t map_object_type,
+                                   void *data);
+
 bool d2k_map_loader_load_things(struct D2KMapLoaderStruct *map_loader,
                                 Status *status);
 
+/*
+ * Where several infos share a doomednum the first wins, as in vanilla's
+ * P_SpawnMapThing.  Infos with a doomednum of 0 or below aren't spawnable.
+ */
+bool d2k_map_thing_types_init(D2KMapThingTypes *types,
+                              const D2KMapObjectInfo *infos,
+                              size_t info_count,
+                              Status *status);
+void d2k_map_thing_types_free(D2KMapThingTypes *types);
+
+bool d2k_map_thing_table_init(D2KMapThingTable *table,
+                              struct D2KMapStruct *map,
+                              D2KMapThingTypes *types,
+                              Status *status);
+void d2k_map_thing_table_free(D2KMapThingTable *table);
+
+/*
+ * The classes that spawn on `skill` (vanilla's skill_t, 0 for "I'm too young
+ * to die" through 4 for nightmare) in `play_mode`.  Player and deathmatch
+ * starts always match, as vanilla records them before checking skill.
+ * Per-type rules like MF_NOTDMATCH are left to the spawner.
+ */
+uint64_t d2k_map_thing_spawn_mask(int skill, D2KMapThingPlayMode play_mode);
+
+/* How many things a spawn pass with `mask` will visit */
+size_t d2k_map_thing_table_spawn_count(D2KMapThingTable *table,
+                                       uint64_t mask);
+
+/*
+ * Visits the things whose class is in `mask`, in lump order, and returns
+ * false if `visitor` did.
+ */
+bool d2k_map_thing_table_spawn(D2KMapThingTable *table,
+                               uint64_t mask,
+                               D2KMapThingVisitor visitor,
+                               void *data);
+
+static inline uint16_t d2k_map_thing_types_lookup(D2KMapThingTypes *types,
+                                                  int16_t doomednum) {
+  if (doomednum < 0 || (size_t)doomednum >= types->types.len) {
+    return D2K_MAP_THING_NO_TYPE;
+  }
+
+  return *(uint16_t *)array_index_fast(&types->types, (size_t)doomednum);
+}
+
+static inline uint8_t d2k_map_thing_class(int16_t options) {
+  return (uint8_t)((options & 7) | ((options >> 1) & 0x38));
+}
+
+/*
+ * Indexes into `map->things` of every thing of `map_object_type`, or of
+ * every unresolved thing for D2K_MAP_THING_NO_TYPE.
+ */
+static inline const uint32_t* d2k_map_thing_table_type(
+    D2KMapThingTable *table,
+    uint16_t map_object_type,
+    size_t *count) {
+  size_t bucket = map_object_type;
+  size_t start;
+  size_t end;
+
+  if (map_object_type == D2K_MAP_THING_NO_TYPE) {
+    bucket = table->type_count;
+  }
+  else if (bucket >= table->type_count) {
+    *count = 0;
+    return NULL;
+  }
+
+  start = *(size_t *)array_index_fast(&table->type_starts, bucket);
+  end = *(size_t *)array_index_fast(&table->type_starts, bucket + 1);
+  *count = end - start;
+
+  if (*count == 0) {
+    return NULL;
+  }
+
+  return array_index_fast(&table->type_indexes, start);
+}
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
@@ -0,0 +1,238 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_UDMF_H__
+#define D2K_MAP_UDMF_H__
+
+#include "d2k/fixed_math.h"
+#include "d2k/fixed_vertex.h"
+#include "d2k/map_things.h"
+
+/*
+ * d2k_udmf_parse_parallel's automatic thread count is one per this much
+ * TEXTMAP, up to the number of online CPUs and D2K_UDMF_MAX_THREADS.
+ */
+#define D2K_UDMF_PARALLEL_CHUNK_SIZE (1024 * 1024)
+#define D2K_UDMF_MAX_THREADS         16
+
+struct D2KLumpStruct;
+struct D2KMapLoaderStruct;
+
+enum {
+  D2K_MAP_UDMF_SYNTAX_ERROR = 1,
+  D2K_MAP_UDMF_UNTERMINATED_STRING,
+  D2K_MAP_UDMF_UNTERMINATED_COMMENT,
+  D2K_MAP_UDMF_INVALID_VALUE,
+  D2K_MAP_UDMF_MISSING_FIELD,
+  D2K_MAP_UDMF_INVALID_VERTEX_INDEX,
+  D2K_MAP_UDMF_INVALID_SIDEDEF_INDEX,
+  D2K_MAP_UDMF_INVALID_SECTOR_INDEX,
+  D2K_MAP_UDMF_UNSUPPORTED_NAMESPACE,
+};
+
+typedef enum {
+  D2K_UDMF_TOKEN_END,
+  D2K_UDMF_TOKEN_IDENTIFIER,
+  D2K_UDMF_TOKEN_INTEGER,
+  D2K_UDMF_TOKEN_FLOAT,
+  D2K_UDMF_TOKEN_STRING,
+  D2K_UDMF_TOKEN_OPEN_BRACE,
+  D2K_UDMF_TOKEN_CLOSE_BRACE,
+  D2K_UDMF_TOKEN_EQUALS,
+  D2K_UDMF_TOKEN_SEMICOLON,
+} D2KUDMFTokenType;
+
+/*
+ * Tokens point into the TEXTMAP data rather than copying out of it.  A
+ * string token's text excludes its quotes and still has its escapes.  An
+ * identifier token's `key` is its D2KUDMFKey.
+ */
+typedef struct D2KUDMFTokenStruct {
+  D2KUDMFTokenType  type;
+  int               key;
+  const char       *text;
+  size_t            len;
+} D2KUDMFToken;
+
+typedef struct D2KUDMFLexerStruct {
+  const char *data;
+  size_t      len;
+  size_t      offset;
+} D2KUDMFLexer;
+
+/*
+ * Every block and field name the loader understands.  Identifiers are
+ * interned to one of these as they're lexed, so decoding a field is a
+ * switch rather than a string compare; anything else is
+ * D2K_UDMF_KEY_UNKNOWN and is skipped.
+ */
+typedef enum {
+  D2K_UDMF_KEY_UNKNOWN,
+  D2K_UDMF_KEY_AMBUSH,
+  D2K_UDMF_KEY_ANGLE,
+  D2K_UDMF_KEY_BLOCKING,
+  D2K_UDMF_KEY_BLOCKMONSTERS,
+  D2K_UDMF_KEY_BLOCKSOUND,
+  D2K_UDMF_KEY_COOP,
+  D2K_UDMF_KEY_DM,
+  D2K_UDMF_KEY_DONTDRAW,
+  D2K_UDMF_KEY_DONTPEGBOTTOM,
+  D2K_UDMF_KEY_DONTPEGTOP,
+  D2K_UDMF_KEY_FRIEND,
+  D2K_UDMF_KEY_HEIGHTCEILING,
+  D2K_UDMF_KEY_HEIGHTFLOOR,
+  D2K_UDMF_KEY_ID,
+  D2K_UDMF_KEY_LIGHTLEVEL,
+  D2K_UDMF_KEY_LINEDEF,
+  D2K_UDMF_KEY_MAPPED,
+  D2K_UDMF_KEY_NAMESPACE,
+  D2K_UDMF_KEY_OFFSETX,
+  D2K_UDMF_KEY_OFFSETY,
+  D2K_UDMF_KEY_PASSUSE,
+  D2K_UDMF_KEY_SECRET,
+  D2K_UDMF_KEY_SECTOR,
+  D2K_UDMF_KEY_SIDEBACK,
+  D2K_UDMF_KEY_SIDEDEF,
+  D2K_UDMF_KEY_SIDEFRONT,
+  D2K_UDMF_KEY_SINGLE,
+  D2K_UDMF_KEY_SKILL1,
+  D2K_UDMF_KEY_SKILL2,
+  D2K_UDMF_KEY_SKILL3,
+  D2K_UDMF_KEY_SKILL4,
+  D2K_UDMF_KEY_SKILL5,
+  D2K_UDMF_KEY_SPECIAL,
+  D2K_UDMF_KEY_TEXTUREBOTTOM,
+  D2K_UDMF_KEY_TEXTURECEILING,
+  D2K_UDMF_KEY_TEXTUREFLOOR,
+  D2K_UDMF_KEY_TEXTUREMIDDLE,
+  D2K_UDMF_KEY_TEXTURETOP,
+  D2K_UDMF_KEY_THING,
+  D2K_UDMF_KEY_TWOSIDED,
+  D2K_UDMF_KEY_TYPE,
+  D2K_UDMF_KEY_V1,
+  D2K_UDMF_KEY_V2,
+  D2K_UDMF_KEY_VERTEX,
+  D2K_UDMF_KEY_X,
+  D2K_UDMF_KEY_Y,
+  D2K_UDMF_KEY_MAX,
+} D2KUDMFKey;
+
+/*
+ * Blocks are decoded into these first, with references left as indexes and
+ * texture names left raw, since UDMF lets a linedef come before the
+ * sidedefs it uses.  d2k_map_loader_load_udmf_records then resolves them
+ * into the map.
+ */
+typedef struct D2KUDMFLinedefStruct {
+  int32_t  v1;
+  int32_t  v2;
+  int32_t  front_side;
+  int32_t  back_side;
+  uint16_t flags;
+  int16_t  special;
+  int32_t  id;
+} D2KUDMFLinedef;
+
+typedef struct D2KUDMFSidedefStruct {
+  D2KFixedPoint texture_offset;
+  D2KFixedPoint row_offset;
+  int32_t       sector;
+  char          top_texture[8];
+  char          bottom_texture[8];
+  char          mid_texture[8];
+} D2KUDMFSidedef;
+
+typedef struct D2KUDMFSectorStruct {
+  D2KFixedPoint floor_height;
+  D2KFixedPoint ceiling_height;
+  int16_t       light_level;
+  int16_t       special;
+  int16_t       tag;
+  char          floor_texture[8];
+  char          ceiling_texture[8];
+} D2KUDMFSector;
+
+typedef struct D2KUDMFRecordsStruct {
+  Array  things;
+  Array  vertexes;
+  Array  linedefs;
+  Array  sidedefs;
+  Array  sectors;
+  size_t error_offset;
+} D2KUDMFRecords;
+
+void d2k_udmf_lexer_init(D2KUDMFLexer *lexer, const char *data, size_t len);
+
+/* Yields D2K_UDMF_TOKEN_END at the end of the data, and keeps doing so */
+bool d2k_udmf_lexer_next(D2KUDMFLexer *lexer, D2KUDMFToken *token,
+                                              Status *status);
+
+/* Case-insensitive, as UDMF identifiers are */
+D2KUDMFKey d2k_udmf_key(const char *name, size_t len);
+
+void d2k_udmf_records_init(D2KUDMFRecords *records);
+void d2k_udmf_records_clear(D2KUDMFRecords *records);
+void d2k_udmf_records_free(D2KUDMFRecords *records);
+
+/*
+ * Appends the blocks in `data` to `records`.  On failure
+ * `records->error_offset` is how far into `data` parsing got.
+ */
+bool d2k_udmf_parse(D2KUDMFRecords *records, const char *data, size_t len,
+                                                               Status *status);
+
+/*
+ * d2k_udmf_parse, split across threads.  The data is cut just after a
+ * block's closing brace near each thread's share, every chunk is parsed
+ * into its own records, and those are appended in source order, so the
+ * result is exactly what d2k_udmf_parse would produce.
+ *
+ * The cut points are found without lexing from the start: a brace inside a
+ * string or block comment can fool them, but then the chunk before the cut
+ * ends mid-string or mid-comment and fails.  Any chunk failing falls back
+ * to parsing everything on the calling thread, which also keeps error
+ * offsets exact.
+ *
+ * `thread_count` 0 picks one thread per D2K_UDMF_PARALLEL_CHUNK_SIZE.
+ */
+bool d2k_udmf_parse_parallel(D2KUDMFRecords *records,
+                             const char *data,
+                             size_t len,
+                             size_t thread_count,
+                             Status *status);
+
+/*
+ * Fills the map's things, vertexes, sectors, sidedefs and linedefs from
+ * `records`, checking every reference and looking up every texture.
+ */
+bool d2k_map_loader_load_udmf_records(struct D2KMapLoaderStruct *map_loader,
+                                      D2KUDMFRecords *records,
+                                      Status *status);
+
+/* Parses TEXTMAP (in parallel if it's big) and loads the result */
+bool d2k_map_loader_load_udmf(struct D2KMapLoaderStruct *map_loader,
+                              struct D2KLumpStruct *textmap_lump,
+                              Status *status);
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
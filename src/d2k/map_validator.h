@@ -0,0 +1,71 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_MAP_VALIDATOR_H__
+#define D2K_MAP_VALIDATOR_H__
+
+#include "d2k/map.h"
+#include "d2k/map_problem.h"
+#include "d2k/wad.h"
+
+enum {
+  D2K_MAP_VALIDATOR_MAP_NOT_FOUND = 1,
+};
+
+/*
+ * The validator checks a map's lumps without loading them, appending a
+ * D2KMapProblem to `problems` (an Array of D2KMapProblem, initialized by the
+ * caller) for each index the loaders would reject or repair, instead of
+ * stopping at the first one.  It decodes records as the loaders do, and
+ * also flags 2-sided linedefs with no back side, which load but leave their
+ * segs without a back sector.  Each lump is read once; record counts for
+ * cross-lump index checks come from lump sizes, so no lump has to be parsed
+ * before another.
+ *
+ * These only fail on allocation failure, or when the map isn't there at
+ * all; a map with problems still validates successfully.  Only the Doom
+ * binary format is checked; GL and extended nodes aren't.
+ */
+
+/*
+ * `lumps` is indexed by D2KVanillaMapLump, with NULL for missing lumps.
+ * Missing NODES, SEGS and SSECTORS lumps are only reported when
+ * `has_gl_nodes` is false.
+ */
+bool d2k_map_validate_lumps(D2KLump *lumps[D2K_VANILLA_MAP_LUMP_MAX],
+                            bool has_gl_nodes,
+                            Array *problems,
+                            Status *status);
+
+/* Parses a TEXTMAP lump and checks the indices in its records */
+bool d2k_map_validate_udmf(D2KLump *textmap_lump, Array *problems,
+                                                  Status *status);
+
+/* Finds `map_name`'s lumps in `lump_directory` and validates them */
+bool d2k_map_validate(D2KLumpDirectory *lump_directory,
+                      const char *map_name,
+                      Array *problems,
+                      Status *status);
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
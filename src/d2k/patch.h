@@ -23,12 +23,91 @@
 #ifndef D2K_PATCH_H__
 #define D2K_PATCH_H__
 
+struct D2KLumpStruct;
+
+enum {
+  D2K_PATCH_MALFORMED_HEADER = 1,
+  D2K_PATCH_MALFORMED_COLUMN,
+};
+
 typedef struct D2KPatchStruct {
   int origin_x;
   int origin_y;
   int patch;
 } D2KPatch;
 
+/*
+ * A decoded Doom picture ("patch") lump.  Posts are stored in column order
+ * with tall-patch (DeePsea) relative offsets already resolved, and point back
+ * into the lump's data, so decoding doesn't copy any pixels.
+ */
+typedef struct D2KPatchPostStruct {
+  uint32_t top;
+  uint32_t length;
+  size_t   offset;
+} D2KPatchPost;
+
+typedef struct D2KPatchPostsStruct {
+  int16_t        width;
+  int16_t        height;
+  int16_t        left_offset;
+  int16_t        top_offset;
+  const uint8_t *data;
+  Array          columns; /* size_t first post index; width + 1 entries */
+  Array          posts;
+} D2KPatchPosts;
+
+/*
+ * A dense, column-major rendering of a patch.  `mask` is 0xFF where a post
+ * covers the pixel and 0x00 elsewhere, so it can be used directly as a blend
+ * mask.  `height` covers every post, which can exceed the header's height
+ * for tall patches.
+ */
+typedef struct D2KPatchBitmapStruct {
+  int      width;
+  int      height;
+  int      left_offset;
+  int      top_offset;
+  uint8_t *pixels;
+  uint8_t *mask;
+} D2KPatchBitmap;
+
+bool d2k_patch_posts_init_from_lump(D2KPatchPosts *patch_posts,
+                                    struct D2KLumpStruct *lump,
+                                    Status *status);
+void d2k_patch_posts_free(D2KPatchPosts *patch_posts);
+bool d2k_patch_bitmap_init_from_posts(D2KPatchBitmap *patch_bitmap,
+                                      D2KPatchPosts *patch_posts,
+                                      Status *status);
+bool d2k_patch_bitmap_init_from_lump(D2KPatchBitmap *patch_bitmap,
+                                     struct D2KLumpStruct *lump,
+                                     Status *status);
+void d2k_patch_bitmap_free(D2KPatchBitmap *patch_bitmap);
+
+/*
+ * Draws a patch bitmap into a column-major destination at (x, y), clipped to
+ * the destination.  Only masked pixels are copied, and the destination mask
+ * (if given) is OR'd with the patch's mask.
+ */
+void d2k_patch_bitmap_blit(const D2KPatchBitmap *patch_bitmap,
+                           uint8_t *dest_pixels,
+                           uint8_t *dest_mask,
+                           int dest_width,
+                           int dest_height,
+                           int x,
+                           int y);
+
+static inline size_t d2k_patch_posts_column_start(D2KPatchPosts *patch_posts,
+                                                  int column) {
+  return *(size_t *)array_index_fast(&patch_posts->columns, (size_t)column);
+}
+
+static inline size_t d2k_patch_posts_column_end(D2KPatchPosts *patch_posts,
+                                                int column) {
+  return *(size_t *)array_index_fast(&patch_posts->columns,
+                                     (size_t)column + 1);
+}
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
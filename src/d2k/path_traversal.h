@@ -0,0 +1,101 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_PATH_TRAVERSAL_H__
+#define D2K_PATH_TRAVERSAL_H__
+
+#include "d2k/divline.h"
+#include "d2k/fixed_math.h"
+#include "d2k/map.h"
+#include "d2k/stamp_table.h"
+
+struct D2KLinedefStruct;
+struct D2KMapObjectStruct;
+
+typedef enum {
+  D2K_PATH_TRAVERSE_ADD_LINES = (1 << 0),
+  D2K_PATH_TRAVERSE_EARLY_OUT = (1 << 1),
+} D2KPathTraverseFlags;
+
+typedef enum {
+  D2K_INTERCEPT_LINE,
+  D2K_INTERCEPT_THING,
+} D2KInterceptType;
+
+typedef struct D2KInterceptStruct {
+  D2KFixedPoint      frac;
+  D2KInterceptType   type;
+  union {
+    struct D2KLinedefStruct   *line;
+    struct D2KMapObjectStruct *thing;
+  } d;
+} D2KIntercept;
+
+/*
+ * Blockmap trace state for one map.  Keep one per thread: everything a trace
+ * needs is sized up front in `d2k_path_traversal_init`, so tracing itself
+ * never allocates.  After a trace `intercepts` holds what it hit, sorted by
+ * `frac` (0 at the start of the trace, FRACUNIT at the end).
+ */
+typedef struct D2KPathTraversalStruct {
+  D2KMap        *map;
+  Array          intercepts;
+  D2KStampTable  checked_lines;
+  D2KDivline     trace;
+} D2KPathTraversal;
+
+/* Return false to stop the traversal */
+typedef bool (*D2KPathTraverser)(D2KPathTraversal *traversal,
+                                 D2KIntercept *intercept,
+                                 void *data);
+
+bool d2k_path_traversal_init(D2KPathTraversal *traversal, D2KMap *map,
+                                                          Status *status);
+void d2k_path_traversal_free(D2KPathTraversal *traversal);
+bool d2k_path_traversal_collect(D2KPathTraversal *traversal,
+                                D2KFixedPoint x1,
+                                D2KFixedPoint y1,
+                                D2KFixedPoint x2,
+                                D2KFixedPoint y2,
+                                int flags);
+bool d2k_path_traverse(D2KPathTraversal *traversal, D2KFixedPoint x1,
+                                                    D2KFixedPoint y1,
+                                                    D2KFixedPoint x2,
+                                                    D2KFixedPoint y2,
+                                                    int flags,
+                                                    D2KPathTraverser traverser,
+                                                    void *data);
+
+static inline size_t d2k_path_traversal_intercept_count(
+    D2KPathTraversal *traversal) {
+  return traversal->intercepts.len;
+}
+
+static inline D2KIntercept* d2k_path_traversal_intercept(
+    D2KPathTraversal *traversal,
+    size_t index) {
+  return array_index_fast(&traversal->intercepts, index);
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
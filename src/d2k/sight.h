@@ -0,0 +1,77 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_SIGHT_H__
+#define D2K_SIGHT_H__
+
+#include "d2k/divline.h"
+#include "d2k/fixed_math.h"
+#include "d2k/map.h"
+#include "d2k/stamp_table.h"
+
+struct D2KSubsectorStruct;
+
+/*
+ * Just the parts of a map object a sight check looks at.  `subsector` is
+ * usually already known; otherwise use `d2k_map_point_in_subsector`.
+ */
+typedef struct D2KSightActorStruct {
+  D2KFixedPoint              x;
+  D2KFixedPoint              y;
+  D2KFixedPoint              z;
+  D2KFixedPoint              height;
+  struct D2KSubsectorStruct *subsector;
+} D2KSightActor;
+
+/*
+ * Line-of-sight state for one map.  Lines already checked during a trace are
+ * marked in `checked_lines` rather than in the map itself, and the
+ * target's side of every node visited is cached in `node_sides` (tagged with
+ * `target_stamp`) so a batch of checks against one target only computes each
+ * of those once.
+ */
+typedef struct D2KSightStruct {
+  D2KMap        *map;
+  D2KStampTable  checked_lines;
+  Array          node_sides;
+  uint32_t       target_stamp;
+  D2KFixedPoint  z_start;
+  D2KFixedPoint  top_slope;
+  D2KFixedPoint  bottom_slope;
+  D2KDivline     trace;
+  D2KFixedPoint  target_x;
+  D2KFixedPoint  target_y;
+  D2KFixedPoint  bbox[4];
+} D2KSight;
+
+bool d2k_sight_init(D2KSight *sight, D2KMap *map, Status *status);
+void d2k_sight_free(D2KSight *sight);
+bool d2k_sight_check(D2KSight *sight, const D2KSightActor *looker,
+                                      const D2KSightActor *target);
+void d2k_sight_check_many(D2KSight *sight, const D2KSightActor *lookers,
+                                           size_t looker_count,
+                                           const D2KSightActor *target,
+                                           bool *results);
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
@@ -171,6 +171,11 @@ typedef enum {
   D2K_SPRITE_NUM_MAX,
 } D2KSpriteNum;
 
+/* A sprite's 4-character lump name prefix, e.g. "TROO" */
+typedef struct D2KSpriteNameStruct {
+  char name[5];
+} D2KSpriteName;
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
@@ -0,0 +1,94 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef D2K_STAMP_TABLE_H__
+#define D2K_STAMP_TABLE_H__
+
+/*
+ * A "seen this pass?" mark per object ID, kept outside the objects
+ * themselves.  Starting a pass bumps the current stamp instead of clearing
+ * anything; only when the stamp wraps does the table get zeroed.  This is
+ * what vanilla's `validcount` fields did, minus writing into shared map data.
+ */
+
+typedef struct D2KStampTableStruct {
+  Array    stamps;
+  uint32_t current;
+} D2KStampTable;
+
+static inline bool d2k_stamp_table_init(D2KStampTable *table, size_t count,
+                                                              Status *status) {
+  array_init(&table->stamps, sizeof(uint32_t));
+  table->current = 0;
+
+  if (!array_set_size(&table->stamps, count, status)) {
+    return false;
+  }
+
+  if (count) {
+    memset(array_index_fast(&table->stamps, 0), 0, count * sizeof(uint32_t));
+  }
+
+  return status_ok(status);
+}
+
+static inline void d2k_stamp_table_free(D2KStampTable *table) {
+  array_free(&table->stamps);
+  table->current = 0;
+}
+
+static inline void d2k_stamp_table_next_pass(D2KStampTable *table) {
+  table->current++;
+
+  if (!table->current) {
+    if (table->stamps.len) {
+      memset(array_index_fast(&table->stamps, 0), 0,
+             table->stamps.len * sizeof(uint32_t));
+    }
+
+    table->current = 1;
+  }
+}
+
+static inline bool d2k_stamp_table_is_marked(D2KStampTable *table,
+                                             size_t id) {
+  uint32_t *stamp = array_index_fast(&table->stamps, id);
+
+  return *stamp == table->current;
+}
+
+/* Marks `id` for this pass; returns false if it already was */
+static inline bool d2k_stamp_table_mark(D2KStampTable *table, size_t id) {
+  uint32_t *stamp = array_index_fast(&table->stamps, id);
+
+  if (*stamp == table->current) {
+    return false;
+  }
+
+  *stamp = table->current;
+
+  return true;
+}
+
+#endif
+
+/* vi: set et ts=2 sw=2: */
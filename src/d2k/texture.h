@@ -25,16 +25,98 @@
 
 #include "d2k/patch.h"
 
+struct D2KLumpDirectoryStruct;
+
+enum {
+  D2K_TEXTURE_MISSING_PNAMES_LUMP = 1,
+  D2K_TEXTURE_MISSING_TEXTURE1_LUMP,
+  D2K_TEXTURE_MALFORMED_PNAMES_LUMP,
+  D2K_TEXTURE_MALFORMED_TEXTURE_LUMP,
+  D2K_TEXTURE_INVALID_PATCH_INDEX,
+  D2K_TEXTURE_NOT_FOUND,
+};
+
+/*
+ * Composite textures aren't built until something asks for their pixels, and
+ * only `cache_budget` bytes worth of them are kept around; the least recently
+ * used composites are thrown out first.  Headless users that only need
+ * dimensions never pay for compositing at all.  Decoded patches are shared
+ * between textures and count against the same budget; they're dropped before
+ * any composite is.
+ */
+#define D2K_TEXTURE_CACHE_DEFAULT_BUDGET (16 * 1024 * 1024)
+
+#define D2K_TEXTURE_CACHE_NONE SIZE_MAX
+
 typedef struct D2KTextureStruct {
   size_t   index;
-  char     name[8];
+  char     name[9];
+  bool     masked;
   uint32_t width_mask;
   short    width;
   short    height;
-  short    patch_count;
-  D2KPatch patches[1];
+  Array    patches;
 } D2KTexture;
 
+typedef struct D2KTextureCompositeStruct {
+  uint8_t *pixels; /* column-major, width * height */
+  uint8_t *mask;   /* column-major, non-zero where a patch drew a pixel */
+  size_t   size;
+  size_t   lru_prev;
+  size_t   lru_next;
+} D2KTextureComposite;
+
+typedef struct D2KTextureTableStruct {
+  struct D2KLumpDirectoryStruct *lump_directory;
+  Array                          patch_lumps;
+  Array                          patch_bitmaps;
+  Array                          textures;
+  Table                          lookup;
+  Array                          composites;
+  size_t                         cache_budget;
+  size_t                         cache_size;
+  size_t                         lru_head;
+  size_t                         lru_tail;
+} D2KTextureTable;
+
+bool d2k_texture_table_init(D2KTextureTable *texture_table,
+                            struct D2KLumpDirectoryStruct *lump_directory,
+                            Status *status);
+void d2k_texture_table_free(D2KTextureTable *texture_table);
+void d2k_texture_table_set_cache_budget(D2KTextureTable *texture_table,
+                                        size_t cache_budget);
+void d2k_texture_table_flush_cache(D2KTextureTable *texture_table);
+bool d2k_texture_table_lookup(D2KTextureTable *texture_table,
+                              const char *texture_name,
+                              D2KTexture **texture,
+                              Status *status);
+
+/*
+ * Returns the composite for a texture, building it if it isn't cached.  The
+ * returned composite (and any column pointers taken from it) are only valid
+ * until the next call that can build a composite, since that may evict it.
+ */
+bool d2k_texture_table_get_composite(D2KTextureTable *texture_table,
+                                     size_t texture_index,
+                                     D2KTextureComposite **composite,
+                                     Status *status);
+bool d2k_texture_table_get_column(D2KTextureTable *texture_table,
+                                  size_t texture_index,
+                                  int column,
+                                  const uint8_t **pixels,
+                                  const uint8_t **mask,
+                                  Status *status);
+
+static inline size_t d2k_texture_table_count(D2KTextureTable *texture_table) {
+  return texture_table->textures.len;
+}
+
+static inline D2KTexture* d2k_texture_table_index_fast(
+    D2KTextureTable *texture_table,
+    size_t texture_index) {
+  return array_index_fast(&texture_table->textures, texture_index);
+}
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
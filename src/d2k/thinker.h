@@ -33,6 +33,10 @@ typedef void (*D2KActionFunctionP1)(void *);
 typedef void (*D2KActionFunctionP2)(void *, void *);
 #endif
 
+enum {
+  D2K_THINKER_INVALID_CLASS = 1,
+};
+
 typedef struct D2KThinkerStruct {
   struct  D2KThinkerStruct *prev;
   struct  D2KThinkerStruct *next;
@@ -40,8 +44,125 @@ typedef struct D2KThinkerStruct {
   struct  D2KThinkerStruct *cnext;
   struct  D2KThinkerStruct *cprev;
   unsigned int references;
+  size_t                    pool_class;
+  size_t                    pool_slot;
 } D2KThinker;
 
+/*
+ * Thinker runtime
+ *
+ * Thinkers of each class (map objects, movers, lights, ...) live in their
+ * own pool: chunks of D2K_THINKER_POOL_CHUNK_SIZE same-sized elements, each
+ * starting with a D2KThinker.  Chunks never move, so thinker pointers stay
+ * valid, and running or scanning a class walks its chunks in memory order
+ * rather than chasing list links.
+ *
+ * Removal is deferred: a removed thinker is skipped from then on, but its
+ * slot isn't reused until d2k_thinker_runtime_collect finds it with no
+ * references left.  Thinkers run class by class in slot order; one spawned
+ * during a run into a recycled slot behind the cursor first runs next tic.
+ */
+
+#define D2K_THINKER_POOL_CHUNK_SIZE 256
+
+typedef enum {
+  D2K_THINKER_SLOT_FREE = 0,
+  D2K_THINKER_SLOT_LIVE,
+  D2K_THINKER_SLOT_REMOVED,
+} D2KThinkerSlotState;
+
+typedef struct D2KThinkerPoolChunkStruct {
+  uint8_t  states[D2K_THINKER_POOL_CHUNK_SIZE];
+  char    *elements;
+} D2KThinkerPoolChunk;
+
+typedef struct D2KThinkerPoolStruct {
+  size_t element_size;
+  Array  chunks;
+  Array  free_slots;
+  size_t slot_count;
+  size_t live_count;
+  size_t removed_count;
+} D2KThinkerPool;
+
+typedef struct D2KThinkerRuntimeStruct {
+  Array pools;
+} D2KThinkerRuntime;
+
+typedef struct D2KThinkerIteratorStruct {
+  D2KThinkerPool *pool;
+  size_t          slot;
+} D2KThinkerIterator;
+
+void d2k_thinker_runtime_init(D2KThinkerRuntime *runtime);
+void d2k_thinker_runtime_free(D2KThinkerRuntime *runtime);
+
+/*
+ * Registers a thinker class whose elements are `element_size` bytes (at
+ * least sizeof(D2KThinker), which they must start with).
+ */
+bool d2k_thinker_runtime_add_class(D2KThinkerRuntime *runtime,
+                                   size_t element_size,
+                                   size_t *class_id,
+                                   Status *status);
+
+/* Returns a zeroed thinker of the given class */
+bool d2k_thinker_runtime_spawn(D2KThinkerRuntime *runtime, size_t class_id,
+                                                           void **thinker,
+                                                           Status *status);
+
+void d2k_thinker_runtime_remove(D2KThinkerRuntime *runtime,
+                                D2KThinker *thinker);
+
+/* Calls every live thinker's function, class by class */
+void d2k_thinker_runtime_run(D2KThinkerRuntime *runtime);
+
+/* Recycles removed thinkers nothing references anymore */
+bool d2k_thinker_runtime_collect(D2KThinkerRuntime *runtime, Status *status);
+
+size_t d2k_thinker_runtime_live_count(D2KThinkerRuntime *runtime,
+                                      size_t class_id);
+
+static inline bool d2k_thinker_is_removed(D2KThinkerRuntime *runtime,
+                                          D2KThinker *thinker) {
+  D2KThinkerPool *pool = array_index_fast(&runtime->pools,
+                                          thinker->pool_class);
+  D2KThinkerPoolChunk *chunk = *(D2KThinkerPoolChunk **)array_index_fast(
+    &pool->chunks,
+    thinker->pool_slot / D2K_THINKER_POOL_CHUNK_SIZE
+  );
+
+  return chunk->states[thinker->pool_slot % D2K_THINKER_POOL_CHUNK_SIZE] !=
+         D2K_THINKER_SLOT_LIVE;
+}
+
+static inline void d2k_thinker_iterator_init(D2KThinkerIterator *iterator,
+                                             D2KThinkerRuntime *runtime,
+                                             size_t class_id) {
+  iterator->pool = array_index_fast(&runtime->pools, class_id);
+  iterator->slot = 0;
+}
+
+/* Returns the next live thinker of the class, or NULL when done */
+static inline void* d2k_thinker_iterator_next(D2KThinkerIterator *iterator) {
+  D2KThinkerPool *pool = iterator->pool;
+
+  while (iterator->slot < pool->slot_count) {
+    size_t slot = iterator->slot++;
+    size_t index = slot % D2K_THINKER_POOL_CHUNK_SIZE;
+    D2KThinkerPoolChunk *chunk = *(D2KThinkerPoolChunk **)array_index_fast(
+      &pool->chunks,
+      slot / D2K_THINKER_POOL_CHUNK_SIZE
+    );
+
+    if (chunk->states[index] == D2K_THINKER_SLOT_LIVE) {
+      return chunk->elements + (index * pool->element_size);
+    }
+  }
+
+  return NULL;
+}
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
@@ -24,6 +24,7 @@
 #define D2K_WAD_H__
 
 struct D2KTextureStruct;
+struct D2KTextureTableStruct;
 
 enum {
   D2K_WAD_TOO_SMALL = 1,
@@ -51,10 +52,15 @@ typedef enum {
   D2K_WAD_SOURCE_LUMP,
 } D2KWadSource;
 
+/*
+ * `hash` is d2k_hash (seed 0) over the whole file, computed when the WAD is
+ * loaded, so it identifies the WAD's content wherever it came from.
+ */
 typedef struct D2KWadStruct {
   D2KWadSource source;
   Buffer       data;
   Array        lumps;
+  uint64_t     hash;
 } D2KWad;
 
 typedef struct D2KLumpStruct {
@@ -67,8 +73,9 @@ typedef struct D2KLumpStruct {
 } D2KLump;
 
 typedef struct D2KLumpDirectoryStruct {
-  PArray lumps;
-  Table  lookups[2];
+  PArray                        lumps;
+  Table                         lookups[2];
+  struct D2KTextureTableStruct *texture_table;
 } D2KLumpDirectory;
 
 bool d2k_wad_init_from_path(D2KWad *wad, D2KWadSource source, Path *path,
@@ -98,6 +105,33 @@ bool d2k_lump_directory_lookup_texture(D2KLumpDirectory *lump_directory,
                                        struct D2KTextureStruct **texture,
                                        Status *status);
 
+/*
+ * Lump data is little-endian regardless of host; these read fields straight
+ * out of a lump's bytes without going through an aligned temporary.
+ */
+static inline uint16_t d2k_lump_data_uint16(const char *data, size_t offset) {
+  const uint8_t *bytes = (const uint8_t *)data + offset;
+
+  return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
+
+static inline int16_t d2k_lump_data_int16(const char *data, size_t offset) {
+  return (int16_t)d2k_lump_data_uint16(data, offset);
+}
+
+static inline uint32_t d2k_lump_data_uint32(const char *data, size_t offset) {
+  const uint8_t *bytes = (const uint8_t *)data + offset;
+
+  return ((uint32_t)bytes[0])       |
+         ((uint32_t)bytes[1] <<  8) |
+         ((uint32_t)bytes[2] << 16) |
+         ((uint32_t)bytes[3] << 24);
+}
+
+static inline int32_t d2k_lump_data_int32(const char *data, size_t offset) {
+  return (int32_t)d2k_lump_data_uint32(data, offset);
+}
+
 static inline bool d2k_lump_directory_index(D2KLumpDirectory *lump_directory,
                                             size_t index,
                                             D2KLump **lump,
@@ -0,0 +1,813 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "d2k/dehacked.h"
+#include "d2k/hash.h"
+
+#define invalid_thing_number(status) status_error( \
+  status,                                          \
+  "d2k_dehacked",                                  \
+  D2K_DEHACKED_INVALID_THING_NUMBER,               \
+  "thing number out of range"                      \
+)
+
+#define invalid_frame_number(status) status_error( \
+  status,                                          \
+  "d2k_dehacked",                                  \
+  D2K_DEHACKED_INVALID_FRAME_NUMBER,               \
+  "frame number out of range"                      \
+)
+
+#define invalid_value(status) status_error( \
+  status,                                   \
+  "d2k_dehacked",                           \
+  D2K_DEHACKED_INVALID_VALUE,               \
+  "invalid numeric value"                   \
+)
+
+#define unknown_action(status) status_error( \
+  status,                                    \
+  "d2k_dehacked",                            \
+  D2K_DEHACKED_UNKNOWN_ACTION,               \
+  "unknown code pointer name"                \
+)
+
+#define unknown_sprite(status) status_error( \
+  status,                                    \
+  "d2k_dehacked",                            \
+  D2K_DEHACKED_UNKNOWN_SPRITE,               \
+  "unknown sprite name"                      \
+)
+
+#define invalid_sprite_number(status) status_error( \
+  status,                                           \
+  "d2k_dehacked",                                   \
+  D2K_DEHACKED_INVALID_SPRITE_NUMBER,               \
+  "sprite number out of range"                      \
+)
+
+#define truncated_text(status) status_error(  \
+  status,                                     \
+  "d2k_dehacked",                             \
+  D2K_DEHACKED_TRUNCATED_TEXT,                \
+  "text block runs past the end of the patch" \
+)
+
+#define MAX_LINE_LENGTH 512
+
+typedef enum {
+  BLOCK_NONE,
+  BLOCK_THING,
+  BLOCK_FRAME,
+  BLOCK_POINTER,
+  BLOCK_CODEPTR,
+  BLOCK_SPRITES,
+  BLOCK_SKIP,
+} BlockType;
+
+typedef struct {
+  D2KDehackedTables *tables;
+  const char        *patch;
+  size_t             patch_size;
+  size_t             position;
+  BlockType          block;
+  size_t             index;
+} Parser;
+
+typedef struct {
+  uint64_t           hash;
+  char              *patch;
+  size_t             patch_size;
+  D2KDehackedTables  tables;
+} CacheEntry;
+
+/* `frame` marks the fields that hold a state number */
+static const struct {
+  const char *name;
+  size_t      offset;
+  bool        frame;
+} thing_fields[] = {
+  { "ID #",               offsetof(D2KMapObjectInfo, doomednum),     false },
+  { "Initial frame",      offsetof(D2KMapObjectInfo, spawn_state),   true  },
+  { "Hit points",         offsetof(D2KMapObjectInfo, spawn_health),  false },
+  { "First moving frame", offsetof(D2KMapObjectInfo, see_state),     true  },
+  { "Alert sound",        offsetof(D2KMapObjectInfo, see_sound),     false },
+  { "Reaction time",      offsetof(D2KMapObjectInfo, reaction_time), false },
+  { "Attack sound",       offsetof(D2KMapObjectInfo, attack_sound),  false },
+  { "Injury frame",       offsetof(D2KMapObjectInfo, pain_state),    true  },
+  { "Pain chance",        offsetof(D2KMapObjectInfo, pain_chance),   false },
+  { "Pain sound",         offsetof(D2KMapObjectInfo, pain_sound),    false },
+  { "Close attack frame", offsetof(D2KMapObjectInfo, melee_state),   true  },
+  { "Far attack frame",   offsetof(D2KMapObjectInfo, missile_state), true  },
+  { "Death frame",        offsetof(D2KMapObjectInfo, death_state),   true  },
+  { "Exploding frame",    offsetof(D2KMapObjectInfo, xdeath_state),  true  },
+  { "Death sound",        offsetof(D2KMapObjectInfo, death_sound),   false },
+  { "Speed",              offsetof(D2KMapObjectInfo, speed),         false },
+  { "Width",              offsetof(D2KMapObjectInfo, radius),        false },
+  { "Height",             offsetof(D2KMapObjectInfo, height),        false },
+  { "Mass",               offsetof(D2KMapObjectInfo, mass),          false },
+  { "Missile damage",     offsetof(D2KMapObjectInfo, damage),        false },
+  { "Action sound",       offsetof(D2KMapObjectInfo, active_sound),  false },
+  { "Respawn frame",      offsetof(D2KMapObjectInfo, raise_state),   true  },
+};
+
+/* BEX thing flag mnemonics, as in PrBoom's deh_mobjflags */
+static const struct {
+  const char *name;
+  uint64_t    bits;
+} flag_names[] = {
+  { "SPECIAL",      UINT64_C(1) << 0  },
+  { "SOLID",        UINT64_C(1) << 1  },
+  { "SHOOTABLE",    UINT64_C(1) << 2  },
+  { "NOSECTOR",     UINT64_C(1) << 3  },
+  { "NOBLOCKMAP",   UINT64_C(1) << 4  },
+  { "AMBUSH",       UINT64_C(1) << 5  },
+  { "JUSTHIT",      UINT64_C(1) << 6  },
+  { "JUSTATTACKED", UINT64_C(1) << 7  },
+  { "SPAWNCEILING", UINT64_C(1) << 8  },
+  { "NOGRAVITY",    UINT64_C(1) << 9  },
+  { "DROPOFF",      UINT64_C(1) << 10 },
+  { "PICKUP",       UINT64_C(1) << 11 },
+  { "NOCLIP",       UINT64_C(1) << 12 },
+  { "SLIDE",        UINT64_C(1) << 13 },
+  { "FLOAT",        UINT64_C(1) << 14 },
+  { "TELEPORT",     UINT64_C(1) << 15 },
+  { "MISSILE",      UINT64_C(1) << 16 },
+  { "DROPPED",      UINT64_C(1) << 17 },
+  { "SHADOW",       UINT64_C(1) << 18 },
+  { "NOBLOOD",      UINT64_C(1) << 19 },
+  { "CORPSE",       UINT64_C(1) << 20 },
+  { "INFLOAT",      UINT64_C(1) << 21 },
+  { "COUNTKILL",    UINT64_C(1) << 22 },
+  { "COUNTITEM",    UINT64_C(1) << 23 },
+  { "SKULLFLY",     UINT64_C(1) << 24 },
+  { "NOTDMATCH",    UINT64_C(1) << 25 },
+  { "TRANSLATION",  UINT64_C(3) << 26 },
+  { "TRANSLATION1", UINT64_C(1) << 26 },
+  { "TRANSLATION2", UINT64_C(1) << 27 },
+  { "TOUCHY",       UINT64_C(1) << 28 },
+  { "BOUNCES",      UINT64_C(1) << 29 },
+  { "FRIEND",       UINT64_C(1) << 30 },
+  { "TRANSLUCENT",  UINT64_C(1) << 31 },
+};
+
+static bool names_match(const char *a, const char *b) {
+  while (*a && *b) {
+    if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) {
+      return false;
+    }
+
+    a++;
+    b++;
+  }
+
+  return (!(*a)) && (!(*b));
+}
+
+static bool starts_with(const char *s, const char *prefix) {
+  while (*prefix) {
+    if (tolower((unsigned char)*s) != tolower((unsigned char)*prefix)) {
+      return false;
+    }
+
+    s++;
+    prefix++;
+  }
+
+  return true;
+}
+
+static char* trim(char *s) {
+  char *end;
+
+  while (isspace((unsigned char)*s)) {
+    s++;
+  }
+
+  end = s + strlen(s);
+
+  while (end > s && isspace((unsigned char)end[-1])) {
+    end--;
+  }
+
+  *end = '\0';
+
+  return s;
+}
+
+static bool parse_int(const char *s, int32_t *value) {
+  char *end = NULL;
+  long n;
+
+  if (!(*s)) {
+    return false;
+  }
+
+  n = strtol(s, &end, 10);
+
+  if (*end) {
+    return false;
+  }
+
+  *value = (int32_t)n;
+
+  return true;
+}
+
+/* Copies the next line into `line`; longer lines are truncated */
+static bool next_line(Parser *parser, char *line) {
+  size_t length = 0;
+
+  if (parser->position >= parser->patch_size) {
+    return false;
+  }
+
+  while (parser->position < parser->patch_size) {
+    char c = parser->patch[parser->position++];
+
+    if (c == '\n') {
+      break;
+    }
+
+    if (length < MAX_LINE_LENGTH - 1) {
+      line[length++] = c;
+    }
+  }
+
+  line[length] = '\0';
+
+  return true;
+}
+
+/*
+ * Unknown mnemonics are counted in `unknown_flag_count` and skipped, as
+ * PrBoom warns about them and carries on.
+ */
+static bool parse_flags(Parser *parser, char *value, uint64_t *flags,
+                                                     Status *status) {
+  char *token = value;
+  int32_t bits;
+
+  if (parse_int(value, &bits)) {
+    *flags = (uint32_t)bits;
+    return status_ok(status);
+  }
+
+  *flags = 0;
+
+  /* BEX mnemonics: "SOLID+SHOOTABLE", separated by any of "+|, " */
+  while (*token) {
+    char *end = token + strcspn(token, "+|, \t");
+    bool last = !(*end);
+    size_t i;
+
+    *end = '\0';
+
+    if (!(*token)) {
+      token = end + 1;
+      continue;
+    }
+
+    if (starts_with(token, "MF_")) {
+      token += 3;
+    }
+
+    for (i = 0; i < sizeof(flag_names) / sizeof(flag_names[0]); i++) {
+      if (names_match(token, flag_names[i].name)) {
+        break;
+      }
+    }
+
+    if (i == sizeof(flag_names) / sizeof(flag_names[0])) {
+      parser->tables->unknown_flag_count++;
+    }
+    else {
+      *flags |= flag_names[i].bits;
+    }
+
+    if (last) {
+      break;
+    }
+
+    token = end + 1;
+  }
+
+  return status_ok(status);
+}
+
+static bool parse_frame_number(Parser *parser, const char *s, size_t *index,
+                                                              Status *status) {
+  int32_t n;
+
+  if (!parse_int(s, &n)) {
+    return invalid_value(status);
+  }
+
+  if (n < 0 || (size_t)n >= parser->tables->states.shared->len) {
+    return invalid_frame_number(status);
+  }
+
+  *index = (size_t)n;
+
+  return status_ok(status);
+}
+
+static bool set_thing_field(Parser *parser, const char *key, char *value,
+                                                             Status *status) {
+  D2KMapObjectInfo *info = NULL;
+  uint64_t flags;
+  int32_t n;
+
+  if (names_match(key, "Bits")) {
+    if (!(parse_flags(parser, value, &flags, status) &&
+          d2k_map_instance_pages_clone(&parser->tables->infos, parser->index,
+                                                               (void **)&info,
+                                                               status))) {
+      return false;
+    }
+
+    info->flags = flags;
+
+    return status_ok(status);
+  }
+
+  for (size_t i = 0; i < sizeof(thing_fields) / sizeof(thing_fields[0]); i++) {
+    if (!names_match(key, thing_fields[i].name)) {
+      continue;
+    }
+
+    if (!parse_int(value, &n)) {
+      return invalid_value(status);
+    }
+
+    if (thing_fields[i].frame &&
+        (n < 0 || (size_t)n >= parser->tables->states.shared->len)) {
+      return invalid_frame_number(status);
+    }
+
+    if (!d2k_map_instance_pages_clone(&parser->tables->infos, parser->index,
+                                                               (void **)&info,
+                                                               status)) {
+      return false;
+    }
+
+    *(int *)(((char *)info) + thing_fields[i].offset) = n;
+    break;
+  }
+
+  return status_ok(status);
+}
+
+static bool set_frame_field(Parser *parser, const char *key,
+                                            const char *value,
+                                            Status *status) {
+  static const char *frame_fields[] = {
+    "Sprite number", "Sprite subnumber", "Duration", "Next frame",
+    "Unknown 1", "Unknown 2",
+  };
+  D2KMapObjectState *state = NULL;
+  bool known = false;
+  int32_t n;
+
+  for (size_t i = 0; i < sizeof(frame_fields) / sizeof(frame_fields[0]); i++) {
+    if (names_match(key, frame_fields[i])) {
+      known = true;
+      break;
+    }
+  }
+
+  if (!known) {
+    return status_ok(status);
+  }
+
+  if (!parse_int(value, &n)) {
+    return invalid_value(status);
+  }
+
+  if (names_match(key, "Next frame") &&
+      (n < 0 || (size_t)n >= parser->tables->states.shared->len)) {
+    return invalid_frame_number(status);
+  }
+
+  if (names_match(key, "Sprite number") &&
+      (n < 0 || (size_t)n >= parser->tables->sprite_names.shared->len)) {
+    return invalid_sprite_number(status);
+  }
+
+  if (!d2k_map_instance_pages_clone(&parser->tables->states, parser->index,
+                                                              (void **)&state,
+                                                              status)) {
+    return false;
+  }
+
+  if (names_match(key, "Sprite number")) {
+    state->sprite = (D2KSpriteNum)n;
+  }
+  else if (names_match(key, "Sprite subnumber")) {
+    state->frame = n;
+  }
+  else if (names_match(key, "Duration")) {
+    state->tics = n;
+  }
+  else if (names_match(key, "Next frame")) {
+    state->next_state = (D2KMapObjectStateNum)n;
+  }
+  else if (names_match(key, "Unknown 1")) {
+    state->misc1 = n;
+  }
+  else if (names_match(key, "Unknown 2")) {
+    state->misc2 = n;
+  }
+
+  return status_ok(status);
+}
+
+static bool set_action(Parser *parser, size_t index, D2KActionFunction action,
+                                                     Status *status) {
+  D2KMapObjectState *state = NULL;
+
+  if (!d2k_map_instance_pages_clone(&parser->tables->states, index,
+                                                             (void **)&state,
+                                                             status)) {
+    return false;
+  }
+
+  state->action = action;
+
+  return status_ok(status);
+}
+
+/* Pointer blocks copy the unpatched action of another frame */
+static bool set_pointer_field(Parser *parser, const char *key,
+                                              const char *value,
+                                              Status *status) {
+  const D2KMapObjectState *source;
+  size_t source_index;
+
+  if (!names_match(key, "Codep Frame")) {
+    return status_ok(status);
+  }
+
+  if (!parse_frame_number(parser, value, &source_index, status)) {
+    return false;
+  }
+
+  source = array_index_fast(parser->tables->base->states, source_index);
+
+  return set_action(parser, parser->index, source->action, status);
+}
+
+/* [CODEPTR]: FRAME 123 = Chase */
+static bool set_code_pointer(Parser *parser, char *key,
+                                             const char *value,
+                                             Status *status) {
+  D2KDehackedBase *base = parser->tables->base;
+  size_t index;
+
+  if (!starts_with(key, "FRAME")) {
+    return status_ok(status);
+  }
+
+  if (!parse_frame_number(parser, trim(key + 5), &index, status)) {
+    return false;
+  }
+
+  if (names_match(value, "NULL")) {
+    return set_action(parser, index, NULL, status);
+  }
+
+  if (starts_with(value, "A_")) {
+    value += 2;
+  }
+
+  for (size_t i = 0; i < base->action_count; i++) {
+    if (names_match(value, base->actions[i].name)) {
+      return set_action(parser, index, base->actions[i].action, status);
+    }
+  }
+
+  return unknown_action(status);
+}
+
+/* [SPRITES]: TROO = BOSS */
+static bool set_sprite_name(Parser *parser, const char *key,
+                                            const char *value,
+                                            Status *status) {
+  D2KMapInstancePages *names = &parser->tables->sprite_names;
+
+  for (size_t i = 0; i < names->shared->len; i++) {
+    const D2KSpriteName *current = d2k_map_instance_pages_get(names, i);
+    D2KSpriteName *sprite_name = NULL;
+
+    if (!names_match(key, current->name)) {
+      continue;
+    }
+
+    if (!d2k_map_instance_pages_clone(names, i, (void **)&sprite_name,
+                                                status)) {
+      return false;
+    }
+
+    for (size_t c = 0; c < 4; c++) {
+      sprite_name->name[c] = value[c] ?
+        (char)toupper((unsigned char)value[c]) :
+        '\0';
+
+      if (!value[c]) {
+        break;
+      }
+    }
+
+    sprite_name->name[4] = '\0';
+
+    return status_ok(status);
+  }
+
+  return unknown_sprite(status);
+}
+
+static bool parse_field(Parser *parser, char *line, char *equals,
+                                                    Status *status) {
+  char *key;
+  char *value;
+
+  *equals = '\0';
+  key = trim(line);
+  value = trim(equals + 1);
+
+  switch (parser->block) {
+    case BLOCK_THING:
+      return set_thing_field(parser, key, value, status);
+    case BLOCK_FRAME:
+      return set_frame_field(parser, key, value, status);
+    case BLOCK_POINTER:
+      return set_pointer_field(parser, key, value, status);
+    case BLOCK_CODEPTR:
+      return set_code_pointer(parser, key, value, status);
+    case BLOCK_SPRITES:
+      return set_sprite_name(parser, key, value, status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool parse_block_header(Parser *parser, char *line, Status *status) {
+  int32_t n;
+
+  parser->block = BLOCK_SKIP;
+
+  if (starts_with(line, "Thing ")) {
+    char *number = trim(line + 6);
+    char *end = number;
+
+    /* "Thing 12 (Imp)": the name is just a comment */
+    while (*end && !isspace((unsigned char)*end)) {
+      end++;
+    }
+
+    *end = '\0';
+
+    if (!parse_int(number, &n)) {
+      return invalid_value(status);
+    }
+
+    if (n < 1 || (size_t)n > parser->tables->infos.shared->len) {
+      return invalid_thing_number(status);
+    }
+
+    parser->block = BLOCK_THING;
+    parser->index = (size_t)(n - 1);
+  }
+  else if (starts_with(line, "Frame ")) {
+    if (!parse_frame_number(parser, trim(line + 6), &parser->index, status)) {
+      return false;
+    }
+
+    parser->block = BLOCK_FRAME;
+  }
+  else if (starts_with(line, "Pointer ")) {
+    /* "Pointer 72 (Frame 204)": the frame number is the one that counts */
+    char *frame = strchr(line, '(');
+    char *end = frame ? strchr(frame, ')') : NULL;
+
+    if (!frame || !end || !starts_with(frame + 1, "Frame ")) {
+      return invalid_value(status);
+    }
+
+    *end = '\0';
+
+    if (!parse_frame_number(parser, trim(frame + 7), &parser->index,
+                                                     status)) {
+      return false;
+    }
+
+    parser->block = BLOCK_POINTER;
+  }
+  else if (starts_with(line, "Text ")) {
+    /* The old and new strings follow verbatim, newlines and all */
+    int32_t old_length;
+    int32_t new_length;
+
+    if (sscanf(line + 5, "%d %d", &old_length, &new_length) != 2 ||
+        old_length < 0 || new_length < 0) {
+      return invalid_value(status);
+    }
+
+    if ((size_t)old_length + (size_t)new_length >
+        parser->patch_size - parser->position) {
+      return truncated_text(status);
+    }
+
+    parser->position += (size_t)old_length + (size_t)new_length;
+  }
+
+  return status_ok(status);
+}
+
+static void parse_section_header(Parser *parser, char *line) {
+  if (starts_with(line, "[CODEPTR]")) {
+    parser->block = BLOCK_CODEPTR;
+  }
+  else if (starts_with(line, "[SPRITES]")) {
+    parser->block = BLOCK_SPRITES;
+  }
+  else {
+    parser->block = BLOCK_SKIP;
+  }
+}
+
+uint64_t d2k_dehacked_hash(const char *patch, size_t patch_size) {
+  return d2k_hash(patch, patch_size, 0);
+}
+
+bool d2k_dehacked_tables_init(D2KDehackedTables *tables,
+                              D2KDehackedBase *base,
+                              Status *status) {
+  memset(tables, 0, sizeof(D2KDehackedTables));
+
+  tables->base = base;
+
+  if (!(d2k_map_instance_pages_init(&tables->states, base->states,
+                                    sizeof(D2KMapObjectState),
+                                    status) &&
+        d2k_map_instance_pages_init(&tables->infos, base->infos,
+                                    sizeof(D2KMapObjectInfo),
+                                    status) &&
+        d2k_map_instance_pages_init(&tables->sprite_names, base->sprite_names,
+                                    sizeof(D2KSpriteName),
+                                    status))) {
+    d2k_dehacked_tables_free(tables);
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_dehacked_tables_free(D2KDehackedTables *tables) {
+  d2k_map_instance_pages_free(&tables->states);
+  d2k_map_instance_pages_free(&tables->infos);
+  d2k_map_instance_pages_free(&tables->sprite_names);
+  tables->base = NULL;
+}
+
+bool d2k_dehacked_tables_apply(D2KDehackedTables *tables,
+                               const char *patch,
+                               size_t patch_size,
+                               Status *status) {
+  Parser parser;
+  char buf[MAX_LINE_LENGTH];
+
+  parser.tables = tables;
+  parser.patch = patch;
+  parser.patch_size = patch_size;
+  parser.position = 0;
+  parser.block = BLOCK_NONE;
+  parser.index = 0;
+
+  while (next_line(&parser, buf)) {
+    char *line = trim(buf);
+    char *equals;
+
+    if ((!(*line)) || (*line == '#')) {
+      continue;
+    }
+
+    if (*line == '[') {
+      parse_section_header(&parser, line);
+      continue;
+    }
+
+    equals = strchr(line, '=');
+
+    if (equals) {
+      if (!parse_field(&parser, line, equals, status)) {
+        return false;
+      }
+    }
+    else if (!parse_block_header(&parser, line, status)) {
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+void d2k_dehacked_cache_init(D2KDehackedCache *cache, D2KDehackedBase *base) {
+  cache->base = *base;
+  array_init(&cache->entries, sizeof(CacheEntry *));
+}
+
+static void free_entry(CacheEntry *entry) {
+  d2k_dehacked_tables_free(&entry->tables);
+  d2k_free(entry->patch);
+  d2k_free(entry);
+}
+
+void d2k_dehacked_cache_free(D2KDehackedCache *cache) {
+  for (size_t i = 0; i < cache->entries.len; i++) {
+    free_entry(*(CacheEntry **)array_index_fast(&cache->entries, i));
+  }
+
+  array_free(&cache->entries);
+}
+
+bool d2k_dehacked_cache_get(D2KDehackedCache *cache,
+                            const char *patch,
+                            size_t patch_size,
+                            D2KDehackedTables **tables,
+                            Status *status) {
+  uint64_t hash = d2k_dehacked_hash(patch, patch_size);
+  CacheEntry *entry = NULL;
+  CacheEntry **slot = NULL;
+
+  for (size_t i = 0; i < cache->entries.len; i++) {
+    entry = *(CacheEntry **)array_index_fast(&cache->entries, i);
+
+    /* Compare the bytes too; a hash collision mustn't hand out a wrong mod */
+    if (entry->hash == hash && entry->patch_size == patch_size &&
+        memcmp(entry->patch, patch, patch_size) == 0) {
+      *tables = &entry->tables;
+      return status_ok(status);
+    }
+  }
+
+  if (!d2k_calloc((void **)&entry, 1, sizeof(CacheEntry), status)) {
+    return false;
+  }
+
+  entry->hash = hash;
+  entry->patch_size = patch_size;
+
+  /* One spare byte so an empty patch still gets an allocation */
+  if (!d2k_malloc((void **)&entry->patch, patch_size + 1, 1, status)) {
+    d2k_free(entry);
+    return false;
+  }
+
+  memcpy(entry->patch, patch, patch_size);
+
+  if (!d2k_dehacked_tables_init(&entry->tables, &cache->base, status)) {
+    d2k_free(entry->patch);
+    d2k_free(entry);
+    return false;
+  }
+
+  if (!(d2k_dehacked_tables_apply(&entry->tables, patch, patch_size,
+                                                         status) &&
+        array_append(&cache->entries, (void **)&slot, status))) {
+    free_entry(entry);
+    return false;
+  }
+
+  *slot = entry;
+  *tables = &entry->tables;
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,1000 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include <pthread.h>
+
+#include "d2k/fixed_math.h"
+#include "d2k/angle.h"
+#include "d2k/fixed_batch.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define D2K_FIXED_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define D2K_FIXED_BATCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+#define unsupported_impl(status) status_error( \
+  status,                                      \
+  "d2k_fixed_batch",                           \
+  D2K_FIXED_BATCH_UNSUPPORTED_IMPL,            \
+  "fixed-point batch implementation not supported on this CPU"  \
+)
+
+#define self_test_failed(status) status_error( \
+  status,                                      \
+  "d2k_fixed_batch",                           \
+  D2K_FIXED_BATCH_SELF_TEST_FAILED,            \
+  "fixed-point batch kernel differs from scalar code" \
+)
+
+#define SELF_TEST_COUNT 4099
+
+typedef struct D2KFixedBatchKernelsStruct {
+  void (*mul)(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                  const D2KFixedPoint *b,
+                                  size_t count);
+  void (*div)(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                  const D2KFixedPoint *b,
+                                  size_t count);
+  void (*dot)(D2KFixedPoint *out, const D2KFixedPoint *ax,
+                                  const D2KFixedPoint *ay,
+                                  const D2KFixedPoint *bx,
+                                  const D2KFixedPoint *by,
+                                  size_t count);
+  void (*approx_distance)(D2KFixedPoint *out, const D2KFixedPoint *dx,
+                                              const D2KFixedPoint *dy,
+                                              size_t count);
+  void (*point_to_angle)(D2KAngle *out, const D2KAngle *tantoangle,
+                                        const D2KFixedPoint *dx,
+                                        const D2KFixedPoint *dy,
+                                        size_t count);
+} D2KFixedBatchKernels;
+
+static const char *impl_names[D2K_FIXED_BATCH_IMPL_MAX] = {
+  "scalar", "SSE4.1", "AVX2", "NEON",
+};
+
+static inline D2KFixedPoint dot_one(D2KFixedPoint ax, D2KFixedPoint ay,
+                                    D2KFixedPoint bx, D2KFixedPoint by) {
+  return (D2KFixedPoint)((uint32_t)d2k_fixed_mul(ax, bx) +
+                         (uint32_t)d2k_fixed_mul(ay, by));
+}
+
+/*
+ * Scalar kernels; also used for the tails the vector kernels leave behind.
+ */
+
+static void scalar_mul(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                           const D2KFixedPoint *b,
+                                           size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = d2k_fixed_mul(a[i], b[i]);
+  }
+}
+
+static void scalar_div(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                           const D2KFixedPoint *b,
+                                           size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = d2k_fixed_div(a[i], b[i]);
+  }
+}
+
+static void scalar_dot(D2KFixedPoint *out, const D2KFixedPoint *ax,
+                                           const D2KFixedPoint *ay,
+                                           const D2KFixedPoint *bx,
+                                           const D2KFixedPoint *by,
+                                           size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = dot_one(ax[i], ay[i], bx[i], by[i]);
+  }
+}
+
+static void scalar_approx_distance(D2KFixedPoint *out,
+                                   const D2KFixedPoint *dx,
+                                   const D2KFixedPoint *dy,
+                                   size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = d2k_fixed_approx_distance(dx[i], dy[i]);
+  }
+}
+
+static void scalar_point_to_angle(D2KAngle *out, const D2KAngle *tantoangle,
+                                                 const D2KFixedPoint *dx,
+                                                 const D2KFixedPoint *dy,
+                                                 size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = d2k_point_to_angle(tantoangle, dx[i], dy[i]);
+  }
+}
+
+static const D2KFixedBatchKernels scalar_kernels = {
+  scalar_mul,
+  scalar_div,
+  scalar_dot,
+  scalar_approx_distance,
+  scalar_point_to_angle,
+};
+
+/*
+ * Division uses the same double-precision quotient as d2k_fixed_div; blocks
+ * with an a == INT_MIN lane go to the scalar code instead.
+ *
+ * Point-to-angle folds R_PointToAngle's eight octant branches into
+ * per-lane selects.  With |dx| and |dy| in hand, each octant's result is
+ * base + t or base - 1 - t (that is, base + ~t) where t is the tantoangle
+ * entry; the -t octant is 1 + ~t.  The flip is (|dx| <= |dy|) ^ (dx < 0) ^
+ * (dy < 0).  SlopeDiv's (num << 3) / (den >> 8) is done in double, which is
+ * exact for 32-bit operands.
+ */
+
+#ifdef D2K_FIXED_BATCH_X86
+
+__attribute__((target("sse4.1")))
+static inline __m128i sse41_mul4(__m128i a, __m128i b) {
+  __m128i even = _mm_mul_epi32(a, b);
+  __m128i odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+  /* Bits 16..47 of each product, moved into its 32-bit lane */
+  even = _mm_srli_epi64(even, FRACBITS);
+  odd = _mm_slli_epi64(odd, 32 - FRACBITS);
+
+  return _mm_blend_epi16(even, odd, 0xCC);
+}
+
+__attribute__((target("sse4.1")))
+static void sse41_mul(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                          const D2KFixedPoint *b,
+                                          size_t count) {
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+    __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+
+    _mm_storeu_si128((__m128i *)(out + i), sse41_mul4(va, vb));
+  }
+
+  scalar_mul(out + i, a + i, b + i, count - i);
+}
+
+__attribute__((target("sse4.1")))
+static void sse41_div(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                          const D2KFixedPoint *b,
+                                          size_t count) {
+  const __m128d unit = _mm_set1_pd((double)FRACUNIT);
+  const __m128i int_min = _mm_set1_epi32(INT_MIN);
+  const __m128i int_max = _mm_set1_epi32(INT_MAX);
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+    __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+
+    /*
+     * Checked before anything is stored, as out may alias a or b: the
+     * scalar divide reads each lane's operands before writing it.
+     */
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(va, int_min))) {
+      scalar_div(out + i, a + i, b + i, 4);
+      continue;
+    }
+
+    __m128i va_hi = _mm_shuffle_epi32(va, 0xEE);
+    __m128i vb_hi = _mm_shuffle_epi32(vb, 0xEE);
+    __m128i in_range = _mm_cmpgt_epi32(
+      _mm_abs_epi32(vb), _mm_srai_epi32(_mm_abs_epi32(va), 14)
+    );
+    __m128i saturated = _mm_xor_si128(
+      _mm_srai_epi32(_mm_xor_si128(va, vb), 31), int_max
+    );
+    __m128d q_lo = _mm_div_pd(_mm_mul_pd(_mm_cvtepi32_pd(va), unit),
+                              _mm_cvtepi32_pd(vb));
+    __m128d q_hi = _mm_div_pd(_mm_mul_pd(_mm_cvtepi32_pd(va_hi), unit),
+                              _mm_cvtepi32_pd(vb_hi));
+    __m128i q = _mm_unpacklo_epi64(_mm_cvttpd_epi32(q_lo),
+                                   _mm_cvttpd_epi32(q_hi));
+
+    q = _mm_blendv_epi8(saturated, q, in_range);
+
+    _mm_storeu_si128((__m128i *)(out + i), q);
+  }
+
+  scalar_div(out + i, a + i, b + i, count - i);
+}
+
+__attribute__((target("sse4.1")))
+static void sse41_dot(D2KFixedPoint *out, const D2KFixedPoint *ax,
+                                          const D2KFixedPoint *ay,
+                                          const D2KFixedPoint *bx,
+                                          const D2KFixedPoint *by,
+                                          size_t count) {
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    __m128i x = sse41_mul4(_mm_loadu_si128((const __m128i *)(ax + i)),
+                           _mm_loadu_si128((const __m128i *)(bx + i)));
+    __m128i y = sse41_mul4(_mm_loadu_si128((const __m128i *)(ay + i)),
+                           _mm_loadu_si128((const __m128i *)(by + i)));
+
+    _mm_storeu_si128((__m128i *)(out + i), _mm_add_epi32(x, y));
+  }
+
+  scalar_dot(out + i, ax + i, ay + i, bx + i, by + i, count - i);
+}
+
+__attribute__((target("sse4.1")))
+static void sse41_approx_distance(D2KFixedPoint *out,
+                                  const D2KFixedPoint *dx,
+                                  const D2KFixedPoint *dy,
+                                  size_t count) {
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    __m128i x = _mm_abs_epi32(_mm_loadu_si128((const __m128i *)(dx + i)));
+    __m128i y = _mm_abs_epi32(_mm_loadu_si128((const __m128i *)(dy + i)));
+    __m128i smaller = _mm_min_epi32(x, y);
+
+    _mm_storeu_si128(
+      (__m128i *)(out + i),
+      _mm_sub_epi32(_mm_add_epi32(x, y), _mm_srai_epi32(smaller, 1))
+    );
+  }
+
+  scalar_approx_distance(out + i, dx + i, dy + i, count - i);
+}
+
+__attribute__((target("sse4.1")))
+static inline __m128d sse41_u32_to_pd(__m128i v) {
+  /* Bias into signed range, convert, then add the bias back */
+  return _mm_add_pd(
+    _mm_cvtepi32_pd(_mm_xor_si128(v, _mm_set1_epi32(INT_MIN))),
+    _mm_set1_pd(2147483648.0)
+  );
+}
+
+__attribute__((target("sse4.1")))
+static inline __m128i sse41_slope_div4(__m128i num, __m128i den) {
+  __m128i n = _mm_slli_epi32(num, 3);
+  __m128i d = _mm_srli_epi32(den, 8);
+  __m128d q_lo = _mm_div_pd(sse41_u32_to_pd(n), _mm_cvtepi32_pd(d));
+  __m128d q_hi = _mm_div_pd(sse41_u32_to_pd(_mm_shuffle_epi32(n, 0xEE)),
+                            _mm_cvtepi32_pd(_mm_shuffle_epi32(d, 0xEE)));
+  __m128i q = _mm_unpacklo_epi64(_mm_cvttpd_epi32(q_lo),
+                                 _mm_cvttpd_epi32(q_hi));
+  __m128i small = _mm_cmpeq_epi32(_mm_srli_epi32(den, 9),
+                                  _mm_setzero_si128());
+
+  q = _mm_min_epu32(q, _mm_set1_epi32(SLOPERANGE));
+
+  return _mm_blendv_epi8(q, _mm_set1_epi32(SLOPERANGE), small);
+}
+
+__attribute__((target("sse4.1")))
+static void sse41_point_to_angle(D2KAngle *out, const D2KAngle *tantoangle,
+                                                const D2KFixedPoint *dx,
+                                                const D2KFixedPoint *dy,
+                                                size_t count) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(dx + i));
+    __m128i y = _mm_loadu_si128((const __m128i *)(dy + i));
+    __m128i x_neg = _mm_cmpgt_epi32(zero, x);
+    __m128i y_neg = _mm_cmpgt_epi32(zero, y);
+    __m128i ax = _mm_abs_epi32(x);
+    __m128i ay = _mm_abs_epi32(y);
+    __m128i steep = _mm_xor_si128(_mm_cmpgt_epi32(ax, ay),
+                                  _mm_set1_epi32(-1));
+    __m128i slope = sse41_slope_div4(_mm_blendv_epi8(ay, ax, steep),
+                                     _mm_blendv_epi8(ax, ay, steep));
+    __m128i flip = _mm_xor_si128(steep, _mm_xor_si128(x_neg, y_neg));
+    __m128i base = _mm_blendv_epi8(
+      _mm_blendv_epi8(_mm_and_si128(y_neg, _mm_set1_epi32(1)),
+                      _mm_set1_epi32((int32_t)ANG180),
+                      x_neg),
+      _mm_blendv_epi8(_mm_set1_epi32(ANG90),
+                      _mm_set1_epi32((int32_t)ANG270),
+                      y_neg),
+      steep
+    );
+    __m128i t = _mm_set_epi32(
+      (int32_t)tantoangle[_mm_extract_epi32(slope, 3)],
+      (int32_t)tantoangle[_mm_extract_epi32(slope, 2)],
+      (int32_t)tantoangle[_mm_extract_epi32(slope, 1)],
+      (int32_t)tantoangle[_mm_extract_epi32(slope, 0)]
+    );
+    __m128i origin = _mm_cmpeq_epi32(_mm_or_si128(x, y), zero);
+    __m128i angle = _mm_add_epi32(base, _mm_xor_si128(t, flip));
+
+    _mm_storeu_si128((__m128i *)(out + i), _mm_andnot_si128(origin, angle));
+  }
+
+  scalar_point_to_angle(out + i, tantoangle, dx + i, dy + i, count - i);
+}
+
+static const D2KFixedBatchKernels sse41_kernels = {
+  sse41_mul,
+  sse41_div,
+  sse41_dot,
+  sse41_approx_distance,
+  sse41_point_to_angle,
+};
+
+__attribute__((target("avx2")))
+static inline __m256i avx2_mul8(__m256i a, __m256i b) {
+  __m256i even = _mm256_mul_epi32(a, b);
+  __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+                                 _mm256_srli_epi64(b, 32));
+
+  even = _mm256_srli_epi64(even, FRACBITS);
+  odd = _mm256_slli_epi64(odd, 32 - FRACBITS);
+
+  return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+__attribute__((target("avx2")))
+static void avx2_mul(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                         const D2KFixedPoint *b,
+                                         size_t count) {
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+    __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+
+    _mm256_storeu_si256((__m256i *)(out + i), avx2_mul8(va, vb));
+  }
+
+  scalar_mul(out + i, a + i, b + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void avx2_div(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                         const D2KFixedPoint *b,
+                                         size_t count) {
+  const __m256d unit = _mm256_set1_pd((double)FRACUNIT);
+  const __m256i int_min = _mm256_set1_epi32(INT_MIN);
+  const __m256i int_max = _mm256_set1_epi32(INT_MAX);
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+    __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+
+    /* Before the store, as in sse41_div */
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(va, int_min))) {
+      scalar_div(out + i, a + i, b + i, 8);
+      continue;
+    }
+
+    __m256i in_range = _mm256_cmpgt_epi32(
+      _mm256_abs_epi32(vb), _mm256_srai_epi32(_mm256_abs_epi32(va), 14)
+    );
+    __m256i saturated = _mm256_xor_si256(
+      _mm256_srai_epi32(_mm256_xor_si256(va, vb), 31), int_max
+    );
+    __m256d q_lo = _mm256_div_pd(
+      _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(va)), unit),
+      _mm256_cvtepi32_pd(_mm256_castsi256_si128(vb))
+    );
+    __m256d q_hi = _mm256_div_pd(
+      _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(va, 1)),
+                    unit),
+      _mm256_cvtepi32_pd(_mm256_extracti128_si256(vb, 1))
+    );
+    __m256i q = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm256_cvttpd_epi32(q_lo)),
+      _mm256_cvttpd_epi32(q_hi),
+      1
+    );
+
+    q = _mm256_blendv_epi8(saturated, q, in_range);
+
+    _mm256_storeu_si256((__m256i *)(out + i), q);
+  }
+
+  scalar_div(out + i, a + i, b + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void avx2_dot(D2KFixedPoint *out, const D2KFixedPoint *ax,
+                                         const D2KFixedPoint *ay,
+                                         const D2KFixedPoint *bx,
+                                         const D2KFixedPoint *by,
+                                         size_t count) {
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m256i x = avx2_mul8(_mm256_loadu_si256((const __m256i *)(ax + i)),
+                          _mm256_loadu_si256((const __m256i *)(bx + i)));
+    __m256i y = avx2_mul8(_mm256_loadu_si256((const __m256i *)(ay + i)),
+                          _mm256_loadu_si256((const __m256i *)(by + i)));
+
+    _mm256_storeu_si256((__m256i *)(out + i), _mm256_add_epi32(x, y));
+  }
+
+  scalar_dot(out + i, ax + i, ay + i, bx + i, by + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void avx2_approx_distance(D2KFixedPoint *out,
+                                 const D2KFixedPoint *dx,
+                                 const D2KFixedPoint *dy,
+                                 size_t count) {
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m256i x = _mm256_abs_epi32(
+      _mm256_loadu_si256((const __m256i *)(dx + i))
+    );
+    __m256i y = _mm256_abs_epi32(
+      _mm256_loadu_si256((const __m256i *)(dy + i))
+    );
+    __m256i smaller = _mm256_min_epi32(x, y);
+
+    _mm256_storeu_si256(
+      (__m256i *)(out + i),
+      _mm256_sub_epi32(_mm256_add_epi32(x, y), _mm256_srai_epi32(smaller, 1))
+    );
+  }
+
+  scalar_approx_distance(out + i, dx + i, dy + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static inline __m256d avx2_u32_to_pd(__m128i v) {
+  return _mm256_add_pd(
+    _mm256_cvtepi32_pd(_mm_xor_si128(v, _mm_set1_epi32(INT_MIN))),
+    _mm256_set1_pd(2147483648.0)
+  );
+}
+
+__attribute__((target("avx2")))
+static inline __m256i avx2_slope_div8(__m256i num, __m256i den) {
+  __m256i n = _mm256_slli_epi32(num, 3);
+  __m256i d = _mm256_srli_epi32(den, 8);
+  __m256d q_lo = _mm256_div_pd(
+    avx2_u32_to_pd(_mm256_castsi256_si128(n)),
+    _mm256_cvtepi32_pd(_mm256_castsi256_si128(d))
+  );
+  __m256d q_hi = _mm256_div_pd(
+    avx2_u32_to_pd(_mm256_extracti128_si256(n, 1)),
+    _mm256_cvtepi32_pd(_mm256_extracti128_si256(d, 1))
+  );
+  __m256i q = _mm256_inserti128_si256(
+    _mm256_castsi128_si256(_mm256_cvttpd_epi32(q_lo)),
+    _mm256_cvttpd_epi32(q_hi),
+    1
+  );
+  __m256i small = _mm256_cmpeq_epi32(_mm256_srli_epi32(den, 9),
+                                     _mm256_setzero_si256());
+
+  q = _mm256_min_epu32(q, _mm256_set1_epi32(SLOPERANGE));
+
+  return _mm256_blendv_epi8(q, _mm256_set1_epi32(SLOPERANGE), small);
+}
+
+__attribute__((target("avx2")))
+static void avx2_point_to_angle(D2KAngle *out, const D2KAngle *tantoangle,
+                                               const D2KFixedPoint *dx,
+                                               const D2KFixedPoint *dy,
+                                               size_t count) {
+  const __m256i zero = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(dx + i));
+    __m256i y = _mm256_loadu_si256((const __m256i *)(dy + i));
+    __m256i x_neg = _mm256_cmpgt_epi32(zero, x);
+    __m256i y_neg = _mm256_cmpgt_epi32(zero, y);
+    __m256i ax = _mm256_abs_epi32(x);
+    __m256i ay = _mm256_abs_epi32(y);
+    __m256i steep = _mm256_xor_si256(_mm256_cmpgt_epi32(ax, ay),
+                                     _mm256_set1_epi32(-1));
+    __m256i slope = avx2_slope_div8(_mm256_blendv_epi8(ay, ax, steep),
+                                    _mm256_blendv_epi8(ax, ay, steep));
+    __m256i flip = _mm256_xor_si256(steep, _mm256_xor_si256(x_neg, y_neg));
+    __m256i base = _mm256_blendv_epi8(
+      _mm256_blendv_epi8(_mm256_and_si256(y_neg, _mm256_set1_epi32(1)),
+                         _mm256_set1_epi32((int32_t)ANG180),
+                         x_neg),
+      _mm256_blendv_epi8(_mm256_set1_epi32(ANG90),
+                         _mm256_set1_epi32((int32_t)ANG270),
+                         y_neg),
+      steep
+    );
+    __m256i t = _mm256_i32gather_epi32((const int *)tantoangle, slope, 4);
+    __m256i origin = _mm256_cmpeq_epi32(_mm256_or_si256(x, y), zero);
+    __m256i angle = _mm256_add_epi32(base, _mm256_xor_si256(t, flip));
+
+    _mm256_storeu_si256((__m256i *)(out + i),
+                        _mm256_andnot_si256(origin, angle));
+  }
+
+  scalar_point_to_angle(out + i, tantoangle, dx + i, dy + i, count - i);
+}
+
+static const D2KFixedBatchKernels avx2_kernels = {
+  avx2_mul,
+  avx2_div,
+  avx2_dot,
+  avx2_approx_distance,
+  avx2_point_to_angle,
+};
+
+#endif
+
+#ifdef D2K_FIXED_BATCH_NEON
+
+static inline int32x4_t neon_mul4(int32x4_t a, int32x4_t b) {
+  int64x2_t lo = vmull_s32(vget_low_s32(a), vget_low_s32(b));
+  int64x2_t hi = vmull_s32(vget_high_s32(a), vget_high_s32(b));
+
+  return vcombine_s32(vshrn_n_s64(lo, FRACBITS), vshrn_n_s64(hi, FRACBITS));
+}
+
+static inline int32x2_t neon_div2(int32x2_t a, int32x2_t b) {
+  float64x2_t n = vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(a)), (double)FRACUNIT);
+  float64x2_t d = vcvtq_f64_s64(vmovl_s32(b));
+
+  return vmovn_s64(vcvtq_s64_f64(vdivq_f64(n, d)));
+}
+
+static void neon_mul(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                         const D2KFixedPoint *b,
+                                         size_t count) {
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    vst1q_s32(out + i, neon_mul4(vld1q_s32(a + i), vld1q_s32(b + i)));
+  }
+
+  scalar_mul(out + i, a + i, b + i, count - i);
+}
+
+static void neon_div(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                         const D2KFixedPoint *b,
+                                         size_t count) {
+  const int32x4_t int_max = vdupq_n_s32(INT_MAX);
+  const int32x4_t int_min = vdupq_n_s32(INT_MIN);
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    int32x4_t va = vld1q_s32(a + i);
+    int32x4_t vb = vld1q_s32(b + i);
+
+    /* Before the store, as in sse41_div */
+    if (vmaxvq_u32(vceqq_s32(va, int_min))) {
+      scalar_div(out + i, a + i, b + i, 4);
+      continue;
+    }
+
+    uint32x4_t in_range = vcgtq_s32(vabsq_s32(vb),
+                                    vshrq_n_s32(vabsq_s32(va), 14));
+    int32x4_t saturated = veorq_s32(vshrq_n_s32(veorq_s32(va, vb), 31),
+                                    int_max);
+    int32x4_t q = vcombine_s32(
+      neon_div2(vget_low_s32(va), vget_low_s32(vb)),
+      neon_div2(vget_high_s32(va), vget_high_s32(vb))
+    );
+
+    vst1q_s32(out + i, vbslq_s32(in_range, q, saturated));
+  }
+
+  scalar_div(out + i, a + i, b + i, count - i);
+}
+
+static void neon_dot(D2KFixedPoint *out, const D2KFixedPoint *ax,
+                                         const D2KFixedPoint *ay,
+                                         const D2KFixedPoint *bx,
+                                         const D2KFixedPoint *by,
+                                         size_t count) {
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    int32x4_t x = neon_mul4(vld1q_s32(ax + i), vld1q_s32(bx + i));
+    int32x4_t y = neon_mul4(vld1q_s32(ay + i), vld1q_s32(by + i));
+
+    vst1q_s32(out + i, vaddq_s32(x, y));
+  }
+
+  scalar_dot(out + i, ax + i, ay + i, bx + i, by + i, count - i);
+}
+
+static void neon_approx_distance(D2KFixedPoint *out,
+                                 const D2KFixedPoint *dx,
+                                 const D2KFixedPoint *dy,
+                                 size_t count) {
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    int32x4_t x = vabsq_s32(vld1q_s32(dx + i));
+    int32x4_t y = vabsq_s32(vld1q_s32(dy + i));
+    int32x4_t smaller = vminq_s32(x, y);
+
+    vst1q_s32(out + i, vsubq_s32(vaddq_s32(x, y), vshrq_n_s32(smaller, 1)));
+  }
+
+  scalar_approx_distance(out + i, dx + i, dy + i, count - i);
+}
+
+static inline uint32x2_t neon_slope_div2(uint32x2_t num, uint32x2_t den) {
+  float64x2_t n = vcvtq_f64_u64(vmovl_u32(vshl_n_u32(num, 3)));
+  float64x2_t d = vcvtq_f64_u64(vmovl_u32(vshr_n_u32(den, 8)));
+
+  return vmovn_u64(vcvtq_u64_f64(vdivq_f64(n, d)));
+}
+
+static void neon_point_to_angle(D2KAngle *out, const D2KAngle *tantoangle,
+                                               const D2KFixedPoint *dx,
+                                               const D2KFixedPoint *dy,
+                                               size_t count) {
+  const int32x4_t zero = vdupq_n_s32(0);
+  const uint32x4_t slope_range = vdupq_n_u32(SLOPERANGE);
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    int32x4_t x = vld1q_s32(dx + i);
+    int32x4_t y = vld1q_s32(dy + i);
+    uint32x4_t x_neg = vcltq_s32(x, zero);
+    uint32x4_t y_neg = vcltq_s32(y, zero);
+    int32x4_t ax = vabsq_s32(x);
+    int32x4_t ay = vabsq_s32(y);
+    uint32x4_t steep = vcleq_s32(ax, ay);
+    uint32x4_t num = vreinterpretq_u32_s32(vbslq_s32(steep, ax, ay));
+    uint32x4_t den = vreinterpretq_u32_s32(vbslq_s32(steep, ay, ax));
+    uint32x4_t slope = vcombine_u32(
+      neon_slope_div2(vget_low_u32(num), vget_low_u32(den)),
+      neon_slope_div2(vget_high_u32(num), vget_high_u32(den))
+    );
+    uint32x4_t flip = veorq_u32(steep, veorq_u32(x_neg, y_neg));
+    uint32x4_t base = vbslq_u32(
+      steep,
+      vbslq_u32(y_neg, vdupq_n_u32(ANG270), vdupq_n_u32(ANG90)),
+      vbslq_u32(x_neg, vdupq_n_u32(ANG180),
+                       vandq_u32(y_neg, vdupq_n_u32(1)))
+    );
+    uint32_t t[4];
+    uint32x4_t angle;
+
+    slope = vminq_u32(slope, slope_range);
+    slope = vbslq_u32(vcltq_u32(den, vdupq_n_u32(512)), slope_range, slope);
+
+    t[0] = tantoangle[vgetq_lane_u32(slope, 0)];
+    t[1] = tantoangle[vgetq_lane_u32(slope, 1)];
+    t[2] = tantoangle[vgetq_lane_u32(slope, 2)];
+    t[3] = tantoangle[vgetq_lane_u32(slope, 3)];
+
+    angle = vaddq_u32(base, veorq_u32(vld1q_u32(t), flip));
+    angle = vbicq_u32(angle, vceqq_s32(vorrq_s32(x, y), zero));
+
+    vst1q_u32(out + i, angle);
+  }
+
+  scalar_point_to_angle(out + i, tantoangle, dx + i, dy + i, count - i);
+}
+
+static const D2KFixedBatchKernels neon_kernels = {
+  neon_mul,
+  neon_div,
+  neon_dot,
+  neon_approx_distance,
+  neon_point_to_angle,
+};
+
+#endif
+
+static const D2KFixedBatchKernels* impl_kernels(D2KFixedBatchImpl impl) {
+  switch (impl) {
+#ifdef D2K_FIXED_BATCH_X86
+    case D2K_FIXED_BATCH_IMPL_SSE41:
+      return &sse41_kernels;
+    case D2K_FIXED_BATCH_IMPL_AVX2:
+      return &avx2_kernels;
+#endif
+#ifdef D2K_FIXED_BATCH_NEON
+    case D2K_FIXED_BATCH_IMPL_NEON:
+      return &neon_kernels;
+#endif
+    case D2K_FIXED_BATCH_IMPL_SCALAR:
+      return &scalar_kernels;
+    default:
+      return NULL;
+  }
+}
+
+static D2KFixedBatchImpl current_impl = D2K_FIXED_BATCH_IMPL_MAX;
+static const D2KFixedBatchKernels *kernels = NULL;
+
+/*
+ * Batch kernels get called from several threads at once, so detection runs
+ * exactly once; pthread_once also makes its writes visible to every caller.
+ */
+static pthread_once_t detect_once = PTHREAD_ONCE_INIT;
+
+static void detect_impl(void) {
+  D2KFixedBatchImpl impl = D2K_FIXED_BATCH_IMPL_SCALAR;
+
+  for (int i = D2K_FIXED_BATCH_IMPL_MAX - 1; i >= 0; i--) {
+    if (d2k_fixed_batch_impl_supported((D2KFixedBatchImpl)i)) {
+      impl = (D2KFixedBatchImpl)i;
+      break;
+    }
+  }
+
+  current_impl = impl;
+  kernels = impl_kernels(impl);
+}
+
+static inline const D2KFixedBatchKernels* get_kernels(void) {
+  pthread_once(&detect_once, detect_impl);
+
+  return kernels;
+}
+
+bool d2k_fixed_batch_impl_supported(D2KFixedBatchImpl impl) {
+  switch (impl) {
+    case D2K_FIXED_BATCH_IMPL_SCALAR:
+      return true;
+#ifdef D2K_FIXED_BATCH_X86
+    case D2K_FIXED_BATCH_IMPL_SSE41:
+      return __builtin_cpu_supports("sse4.1");
+    case D2K_FIXED_BATCH_IMPL_AVX2:
+      return __builtin_cpu_supports("avx2");
+#endif
+#ifdef D2K_FIXED_BATCH_NEON
+    case D2K_FIXED_BATCH_IMPL_NEON:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+const char* d2k_fixed_batch_impl_name(D2KFixedBatchImpl impl) {
+  if (impl >= D2K_FIXED_BATCH_IMPL_MAX) {
+    return "unknown";
+  }
+
+  return impl_names[impl];
+}
+
+D2KFixedBatchImpl d2k_fixed_batch_impl(void) {
+  get_kernels();
+
+  return current_impl;
+}
+
+bool d2k_fixed_batch_use_impl(D2KFixedBatchImpl impl, Status *status) {
+  if (!d2k_fixed_batch_impl_supported(impl)) {
+    return unsupported_impl(status);
+  }
+
+  /* Detect first, so that detecting later can't undo the override */
+  get_kernels();
+
+  current_impl = impl;
+  kernels = impl_kernels(impl);
+
+  return status_ok(status);
+}
+
+void d2k_fixed_batch_mul(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                             const D2KFixedPoint *b,
+                                             size_t count) {
+  get_kernels()->mul(out, a, b, count);
+}
+
+void d2k_fixed_batch_div(D2KFixedPoint *out, const D2KFixedPoint *a,
+                                             const D2KFixedPoint *b,
+                                             size_t count) {
+  get_kernels()->div(out, a, b, count);
+}
+
+void d2k_fixed_batch_dot(D2KFixedPoint *out, const D2KFixedPoint *ax,
+                                             const D2KFixedPoint *ay,
+                                             const D2KFixedPoint *bx,
+                                             const D2KFixedPoint *by,
+                                             size_t count) {
+  get_kernels()->dot(out, ax, ay, bx, by, count);
+}
+
+void d2k_fixed_batch_approx_distance(D2KFixedPoint *out,
+                                     const D2KFixedPoint *dx,
+                                     const D2KFixedPoint *dy,
+                                     size_t count) {
+  get_kernels()->approx_distance(out, dx, dy, count);
+}
+
+void d2k_fixed_batch_point_to_angle(D2KAngle *out,
+                                    const D2KAngle *tantoangle,
+                                    const D2KFixedPoint *dx,
+                                    const D2KFixedPoint *dy,
+                                    size_t count) {
+  get_kernels()->point_to_angle(out, tantoangle, dx, dy, count);
+}
+
+/*
+ * Self test
+ */
+
+static const D2KFixedPoint edge_values[] = {
+  0, 1, -1, 2, -2, FRACUNIT, -FRACUNIT, FRACUNIT - 1, -(FRACUNIT - 1),
+  FRACUNIT + 1, 1 << 14, -(1 << 14), (1 << 14) + 1, 0x7FFF, 0x8000,
+  INT_MAX, INT_MIN, INT_MIN + 1, INT_MAX - 1, 0x3FFFFFFF, -0x40000000,
+};
+
+#define EDGE_VALUE_COUNT (sizeof(edge_values) / sizeof(edge_values[0]))
+
+static uint32_t self_test_random(uint32_t *seed) {
+  *seed = (*seed * 1664525u) + 1013904223u;
+
+  return *seed;
+}
+
+/*
+ * Mixes exhaustive pairs of edge values with random values of random
+ * magnitude, so division sees both saturating and in-range quotients.
+ */
+static void fill_inputs(D2KFixedPoint *a, D2KFixedPoint *b, size_t count,
+                                                            uint32_t *seed) {
+  for (size_t i = 0; i < count; i++) {
+    if (i < EDGE_VALUE_COUNT * EDGE_VALUE_COUNT) {
+      a[i] = edge_values[i / EDGE_VALUE_COUNT];
+      b[i] = edge_values[i % EDGE_VALUE_COUNT];
+    }
+    else {
+      a[i] = (D2KFixedPoint)(self_test_random(seed) >>
+                             (self_test_random(seed) % 31));
+      b[i] = (D2KFixedPoint)(self_test_random(seed) >>
+                             (self_test_random(seed) % 31));
+      if (self_test_random(seed) & 1) {
+        a[i] = (D2KFixedPoint)(0u - (uint32_t)a[i]);
+      }
+    }
+  }
+}
+
+static bool same(const D2KFixedPoint *expected, const D2KFixedPoint *got,
+                                                size_t count) {
+  return memcmp(expected, got, count * sizeof(D2KFixedPoint)) == 0;
+}
+
+bool d2k_fixed_batch_self_test(Status *status) {
+  D2KFixedPoint *a = NULL;
+  D2KFixedPoint *b = NULL;
+  D2KFixedPoint *c = NULL;
+  D2KFixedPoint *d = NULL;
+  D2KFixedPoint *expected = NULL;
+  D2KFixedPoint *got = NULL;
+  uint32_t seed = 0x5EED;
+  bool passed = true;
+
+  if (!(d2k_calloc((void **)&a, SELF_TEST_COUNT, sizeof(D2KFixedPoint),
+                                                 status)        &&
+        d2k_calloc((void **)&b, SELF_TEST_COUNT, sizeof(D2KFixedPoint),
+                                                 status)        &&
+        d2k_calloc((void **)&c, SELF_TEST_COUNT, sizeof(D2KFixedPoint),
+                                                 status)        &&
+        d2k_calloc((void **)&d, SELF_TEST_COUNT, sizeof(D2KFixedPoint),
+                                                 status)        &&
+        d2k_calloc((void **)&expected, SELF_TEST_COUNT,
+                                       sizeof(D2KFixedPoint),
+                                       status)                  &&
+        d2k_calloc((void **)&got, SELF_TEST_COUNT, sizeof(D2KFixedPoint),
+                                                   status))) {
+    d2k_free(a);
+    d2k_free(b);
+    d2k_free(c);
+    d2k_free(d);
+    d2k_free(expected);
+    return false;
+  }
+
+  fill_inputs(a, b, SELF_TEST_COUNT, &seed);
+  fill_inputs(c, d, SELF_TEST_COUNT, &seed);
+
+  for (int i = 0; passed && i < D2K_FIXED_BATCH_IMPL_MAX; i++) {
+    const D2KFixedBatchKernels *k;
+
+    if (!d2k_fixed_batch_impl_supported((D2KFixedBatchImpl)i)) {
+      continue;
+    }
+
+    k = impl_kernels((D2KFixedBatchImpl)i);
+
+    /* Odd lengths and offsets exercise the scalar tails too */
+    for (size_t start = 0; passed && start < 3; start++) {
+      size_t count = SELF_TEST_COUNT - start;
+
+      scalar_mul(expected, a + start, b + start, count);
+      k->mul(got, a + start, b + start, count);
+      passed = same(expected, got, count);
+
+      if (passed) {
+        scalar_div(expected, a + start, b + start, count);
+        k->div(got, a + start, b + start, count);
+        passed = same(expected, got, count);
+      }
+
+      /* In place, over either operand */
+      if (passed) {
+        memcpy(got, a + start, count * sizeof(D2KFixedPoint));
+        k->div(got, got, b + start, count);
+        passed = same(expected, got, count);
+      }
+
+      if (passed) {
+        memcpy(got, b + start, count * sizeof(D2KFixedPoint));
+        k->div(got, a + start, got, count);
+        passed = same(expected, got, count);
+      }
+
+      if (passed) {
+        scalar_dot(expected, a + start, b + start, c + start, d + start,
+                                                              count);
+        k->dot(got, a + start, b + start, c + start, d + start, count);
+        passed = same(expected, got, count);
+      }
+
+      if (passed) {
+        scalar_approx_distance(expected, a + start, b + start, count);
+        k->approx_distance(got, a + start, b + start, count);
+        passed = same(expected, got, count);
+      }
+
+      if (passed) {
+        scalar_point_to_angle((D2KAngle *)expected, d2k_tantoangle,
+                                                    a + start,
+                                                    b + start,
+                                                    count);
+        k->point_to_angle((D2KAngle *)got, d2k_tantoangle, a + start,
+                                                           b + start,
+                                                           count);
+        passed = same(expected, got, count);
+      }
+    }
+  }
+
+  d2k_free(a);
+  d2k_free(b);
+  d2k_free(c);
+  d2k_free(d);
+  d2k_free(expected);
+  d2k_free(got);
+
+  if (!passed) {
+    return self_test_failed(status);
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,192 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/hash.h"
+
+#define PRIME64_1 UINT64_C(0x9E3779B185EBCA87)
+#define PRIME64_2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define PRIME64_3 UINT64_C(0x165667B19E3779F9)
+#define PRIME64_4 UINT64_C(0x85EBCA77C2B2AE63)
+#define PRIME64_5 UINT64_C(0x27D4EB2F165667C5)
+
+static inline uint64_t rotl64(uint64_t value, unsigned int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+/* Input is little-endian regardless of host, like lump data */
+static inline uint64_t read64(const uint8_t *data) {
+  uint64_t value;
+
+  memcpy(&value, data, sizeof(uint64_t));
+
+  return cble64(value);
+}
+
+static inline uint32_t read32(const uint8_t *data) {
+  uint32_t value;
+
+  memcpy(&value, data, sizeof(uint32_t));
+
+  return cble32(value);
+}
+
+static inline uint64_t round64(uint64_t lane, uint64_t input) {
+  lane += input * PRIME64_2;
+  lane = rotl64(lane, 31);
+
+  return lane * PRIME64_1;
+}
+
+static inline uint64_t merge_round(uint64_t hash, uint64_t lane) {
+  hash ^= round64(0, lane);
+
+  return (hash * PRIME64_1) + PRIME64_4;
+}
+
+/* Consumes as many whole stripes as `len` holds; returns the bytes used */
+static size_t consume_stripes(uint64_t lanes[4], const uint8_t *data,
+                                                 size_t len) {
+  uint64_t v1 = lanes[0];
+  uint64_t v2 = lanes[1];
+  uint64_t v3 = lanes[2];
+  uint64_t v4 = lanes[3];
+  size_t offset = 0;
+
+  for (; (len - offset) >= D2K_HASH_STRIPE_SIZE;
+         offset += D2K_HASH_STRIPE_SIZE) {
+    v1 = round64(v1, read64(data + offset));
+    v2 = round64(v2, read64(data + offset + 8));
+    v3 = round64(v3, read64(data + offset + 16));
+    v4 = round64(v4, read64(data + offset + 24));
+  }
+
+  lanes[0] = v1;
+  lanes[1] = v2;
+  lanes[2] = v3;
+  lanes[3] = v4;
+
+  return offset;
+}
+
+void d2k_hash_init(D2KHash *hash, uint64_t seed) {
+  hash->total_len = 0;
+  hash->lanes[0] = seed + PRIME64_1 + PRIME64_2;
+  hash->lanes[1] = seed + PRIME64_2;
+  hash->lanes[2] = seed;
+  hash->lanes[3] = seed - PRIME64_1;
+  hash->seed = seed;
+  hash->buffer_len = 0;
+}
+
+void d2k_hash_update(D2KHash *hash, const void *data, size_t len) {
+  const uint8_t *bytes = data;
+
+  hash->total_len += len;
+
+  if (hash->buffer_len) {
+    size_t fill = D2K_HASH_STRIPE_SIZE - hash->buffer_len;
+
+    if (len < fill) {
+      memcpy(hash->buffer + hash->buffer_len, bytes, len);
+      hash->buffer_len += len;
+      return;
+    }
+
+    memcpy(hash->buffer + hash->buffer_len, bytes, fill);
+    consume_stripes(hash->lanes, hash->buffer, D2K_HASH_STRIPE_SIZE);
+    hash->buffer_len = 0;
+    bytes += fill;
+    len -= fill;
+  }
+
+  if (len >= D2K_HASH_STRIPE_SIZE) {
+    size_t used = consume_stripes(hash->lanes, bytes, len);
+
+    bytes += used;
+    len -= used;
+  }
+
+  if (len) {
+    memcpy(hash->buffer, bytes, len);
+    hash->buffer_len = len;
+  }
+}
+
+uint64_t d2k_hash_final(const D2KHash *hash) {
+  const uint8_t *tail = hash->buffer;
+  size_t len = hash->buffer_len;
+  uint64_t result;
+
+  if (hash->total_len >= D2K_HASH_STRIPE_SIZE) {
+    result = rotl64(hash->lanes[0],  1) +
+             rotl64(hash->lanes[1],  7) +
+             rotl64(hash->lanes[2], 12) +
+             rotl64(hash->lanes[3], 18);
+    result = merge_round(result, hash->lanes[0]);
+    result = merge_round(result, hash->lanes[1]);
+    result = merge_round(result, hash->lanes[2]);
+    result = merge_round(result, hash->lanes[3]);
+  }
+  else {
+    result = hash->seed + PRIME64_5;
+  }
+
+  result += hash->total_len;
+
+  for (; len >= 8; tail += 8, len -= 8) {
+    result ^= round64(0, read64(tail));
+    result = (rotl64(result, 27) * PRIME64_1) + PRIME64_4;
+  }
+
+  if (len >= 4) {
+    result ^= ((uint64_t)read32(tail)) * PRIME64_1;
+    result = (rotl64(result, 23) * PRIME64_2) + PRIME64_3;
+    tail += 4;
+    len -= 4;
+  }
+
+  for (; len > 0; tail++, len--) {
+    result ^= (*tail) * PRIME64_5;
+    result = rotl64(result, 11) * PRIME64_1;
+  }
+
+  result ^= result >> 33;
+  result *= PRIME64_2;
+  result ^= result >> 29;
+  result *= PRIME64_3;
+  result ^= result >> 32;
+
+  return result;
+}
+
+uint64_t d2k_hash(const void *data, size_t len, uint64_t seed) {
+  D2KHash hash;
+
+  d2k_hash_init(&hash, seed);
+  d2k_hash_update(&hash, data, len);
+
+  return d2k_hash_final(&hash);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -23,6 +23,7 @@
 #include "d2k/internal.h"
 #include "d2k/map_blockmap.h"
 #include "d2k/fixed_vertex.h"
+#include "d2k/hash.h"
 #include "d2k/map.h"
 #include "d2k/map_linedefs.h"
 #include "d2k/map_nodes.h"
@@ -30,6 +31,7 @@
 #include "d2k/map_segs.h"
 #include "d2k/map_sidedefs.h"
 #include "d2k/map_subsectors.h"
+#include "d2k/map_things.h"
 #include "d2k/wad.h"
 
 #define map_not_found(status) status_error( \
@@ -147,6 +149,7 @@
 void d2k_map_init(D2KMap *map) {
   memset(map->wad_name, 0, sizeof(map->wad_name));
   memset(map->gl_wad_name, 0, sizeof(map->gl_wad_name));
+  array_init(&map->things, sizeof(D2KMapThing));
   array_init(&map->vertexes, sizeof(D2KFixedVertex));
   array_init(&map->segs, sizeof(D2KSeg));
   array_init(&map->sectors, sizeof(D2KSector));
@@ -154,13 +157,18 @@ void d2k_map_init(D2KMap *map) {
   array_init(&map->nodes, sizeof(D2KMapNode));
   array_init(&map->linedefs, sizeof(D2KLinedef));
   array_init(&map->sidedefs, sizeof(D2KSidedef));
+  array_init(&map->sector_lines, sizeof(D2KLinedef *));
   array_init(&map->sslines, sizeof(D2KSegLine));
+  array_init(&map->reject, sizeof(uint8_t));
   d2k_blockmap_init(&map->blockmap);
+  map->null_sector = NULL;
+  map->hash = 0;
 }
 
 void d2k_map_clear(D2KMap *map) {
   memset(map->wad_name, 0, sizeof(map->wad_name));
   memset(map->gl_wad_name, 0, sizeof(map->gl_wad_name));
+  array_clear(&map->things);
   array_clear(&map->vertexes);
   array_clear(&map->segs);
   array_clear(&map->sectors);
@@ -168,8 +176,99 @@ void d2k_map_clear(D2KMap *map) {
   array_clear(&map->nodes);
   array_clear(&map->linedefs);
   array_clear(&map->sidedefs);
+  array_clear(&map->sector_lines);
   array_clear(&map->sslines);
+  array_clear(&map->reject);
   d2k_blockmap_clear(&map->blockmap);
+  d2k_free(map->null_sector);
+  map->null_sector = NULL;
+  map->hash = 0;
+}
+
+void d2k_map_init_sector_tag_lists(D2KMap *map) {
+  size_t sector_count = map->sectors.len;
+
+  for (size_t i = 0; i < sector_count; i++) {
+    D2KSector *sector = array_index_fast(&map->sectors, i);
+
+    sector->first_tag = -1;
+  }
+
+  /* Backwards, so each chain runs from the lowest-numbered sector up */
+  for (size_t i = sector_count; i-- > 0;) {
+    D2KSector *sector = array_index_fast(&map->sectors, i);
+    D2KSector *head = array_index_fast(
+      &map->sectors,
+      (unsigned int)sector->tag % sector_count
+    );
+
+    sector->next_tag = head->first_tag;
+    head->first_tag = (int)i;
+  }
+}
+
+D2KSector* d2k_map_find_tagged_sector(D2KMap *map, int tag) {
+  D2KSector *head;
+  int i;
+
+  if (map->sectors.len == 0) {
+    return NULL;
+  }
+
+  head = array_index_fast(&map->sectors, (unsigned int)tag % map->sectors.len);
+
+  for (i = head->first_tag; i >= 0;) {
+    D2KSector *sector = array_index_fast(&map->sectors, (size_t)i);
+
+    if (sector->tag == tag) {
+      return sector;
+    }
+
+    i = sector->next_tag;
+  }
+
+  return NULL;
+}
+
+static void hash_lump(D2KHash *hash, D2KLump *lump) {
+  uint8_t size[8];
+  uint64_t len = lump->data.len;
+
+  for (size_t i = 0; i < sizeof(size); i++) {
+    size[i] = (uint8_t)(len >> (i * 8));
+  }
+
+  d2k_hash_update(hash, lump->name, 8);
+  d2k_hash_update(hash, size, sizeof(size));
+  d2k_hash_update(hash, lump->data.data, lump->data.len);
+}
+
+uint64_t d2k_map_hash_lumps(D2KLump **lumps, size_t lump_count) {
+  D2KHash hash;
+
+  d2k_hash_init(&hash, 0);
+
+  for (size_t i = 0; i < lump_count; i++) {
+    if (lumps[i]) {
+      hash_lump(&hash, lumps[i]);
+    }
+  }
+
+  return d2k_hash_final(&hash);
+}
+
+uint64_t d2k_map_hash_lump_range(D2KLumpDirectory *lump_directory,
+                                 size_t start,
+                                 size_t end) {
+  D2KHash hash;
+
+  d2k_hash_init(&hash, 0);
+
+  for (size_t i = start; i < end; i++) {
+    hash_lump(&hash, parray_index_fast(&lump_directory->lumps, i));
+  }
+
+  return d2k_hash_final(&hash);
 }
 
 /* vi: set et ts=2 sw=2: */
@@ -63,8 +63,6 @@
   "invalid offset in line list directory"                          \
 )
 
-#define VANILLA_BLOCKMAP_HEADER_SIZE 8
-
 /* places to shift rel position for cell num */
 #define BLKSHIFT 7
 
@@ -391,7 +389,7 @@ bool d2k_blockmap_build(D2KBlockmap *bmap, Array *vertexes, Array *linedefs,
 
 bool d2k_blockmap_load_from_lump(D2KBlockmap *bmap, D2KLump *lump,
                                                     Status *status) {
-  char blockmap_header_data[VANILLA_BLOCKMAP_HEADER_SIZE];
+  char blockmap_header_data[D2K_VANILLA_BLOCKMAP_HEADER_SIZE];
   int16_t bmaporgx;
   int16_t bmaporgy;
   int16_t bmapwidth;
@@ -405,7 +403,7 @@ bool d2k_blockmap_load_from_lump(D2KBlockmap *bmap, D2KLump *lump,
     return truncated_blockmap_header(status);
   }
 
-  slice_read_fast(&lump->data, 0, VANILLA_BLOCKMAP_HEADER_SIZE,
+  slice_read_fast(&lump->data, 0, D2K_VANILLA_BLOCKMAP_HEADER_SIZE,
                                   (void *)blockmap_header_data);
 
   bmaporgx   = LUMP_DATA_SHORT_TO_SHORT(blockmap_header_data, 0);
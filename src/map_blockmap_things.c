@@ -0,0 +1,365 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/map_blockmap_things.h"
+
+/* Cell index plus one, or 0 when (x, y) is outside the blockmap */
+static uint32_t get_block_cell(D2KBlockmapThings *things, D2KFixedPoint x,
+                                                          D2KFixedPoint y) {
+  int block_x = d2k_blockmap_things_block_x(things, x);
+  int block_y = d2k_blockmap_things_block_y(things, y);
+
+  if (!d2k_blockmap_things_cell(things, block_x, block_y)) {
+    return 0;
+  }
+
+  return (uint32_t)(((size_t)block_y * things->width) + (size_t)block_x + 1);
+}
+
+static bool get_link(D2KBlockmapThings *things, D2KMapObjectHandle handle,
+                                                D2KBlockmapThingLink **link,
+                                                Status *status) {
+  uint32_t index = d2k_map_object_handle_index(handle);
+
+  if (index >= things->links.len) {
+    if (!array_ensure_capacity(&things->links, index + 1, status)) {
+      return false;
+    }
+
+    while (things->links.len <= index) {
+      D2KBlockmapThingLink *new_link = array_append_fast(&things->links);
+
+      new_link->cell = 0;
+      new_link->position = 0;
+    }
+  }
+
+  *link = array_index_fast(&things->links, index);
+
+  return status_ok(status);
+}
+
+static bool grow_cell(D2KBlockmapThingCell *cell, Status *status) {
+  uint32_t capacity = cell->capacity * 2;
+
+  if (cell->spilled) {
+    if (!d2k_realloc((void **)&cell->spilled, capacity,
+                                              sizeof(D2KMapObjectHandle),
+                                              status)) {
+      return false;
+    }
+  }
+  else {
+    if (!d2k_malloc((void **)&cell->spilled, capacity,
+                                             sizeof(D2KMapObjectHandle),
+                                             status)) {
+      return false;
+    }
+
+    memcpy(cell->spilled, cell->handles, cell->count *
+                                         sizeof(D2KMapObjectHandle));
+  }
+
+  cell->capacity = capacity;
+
+  return status_ok(status);
+}
+
+static bool link_to_cell(D2KBlockmapThings *things, D2KBlockmapThingLink *link,
+                                                    uint32_t block_cell,
+                                                    D2KMapObjectHandle handle,
+                                                    Status *status) {
+  D2KBlockmapThingCell *cell = array_index_fast(&things->cells,
+                                                block_cell - 1);
+
+  if (cell->count == cell->capacity) {
+    if (!grow_cell(cell, status)) {
+      return false;
+    }
+  }
+
+  d2k_blockmap_thing_cell_handles(cell)[cell->count] = handle;
+  link->cell = block_cell;
+  link->position = cell->count;
+  cell->count++;
+
+  return status_ok(status);
+}
+
+static void unlink_from_cell(D2KBlockmapThings *things,
+                             D2KBlockmapThingLink *link) {
+  D2KBlockmapThingCell *cell = array_index_fast(&things->cells,
+                                                link->cell - 1);
+  D2KMapObjectHandle *handles = d2k_blockmap_thing_cell_handles(cell);
+
+  /*
+   * Shifting would move handles the walk hasn't reached behind it, so leave
+   * a hole instead and compact once the walk is done.
+   */
+  if (cell->iterating) {
+    handles[link->position] = D2K_MAP_OBJECT_HANDLE_NONE;
+    cell->holes++;
+    link->cell = 0;
+    return;
+  }
+
+  /* Shift rather than swap, so the cell stays in link order like vanilla's */
+  for (uint32_t i = link->position + 1; i < cell->count; i++) {
+    D2KBlockmapThingLink *moved = array_index_fast(
+      &things->links,
+      d2k_map_object_handle_index(handles[i])
+    );
+
+    handles[i - 1] = handles[i];
+    moved->position = i - 1;
+  }
+
+  cell->count--;
+  link->cell = 0;
+}
+
+static void compact_cell(D2KBlockmapThings *things,
+                         D2KBlockmapThingCell *cell) {
+  D2KMapObjectHandle *handles = d2k_blockmap_thing_cell_handles(cell);
+  uint32_t count = 0;
+
+  for (uint32_t i = 0; i < cell->count; i++) {
+    D2KBlockmapThingLink *link;
+
+    if (handles[i] == D2K_MAP_OBJECT_HANDLE_NONE) {
+      continue;
+    }
+
+    link = array_index_fast(&things->links,
+                            d2k_map_object_handle_index(handles[i]));
+    handles[count] = handles[i];
+    link->position = count;
+    count++;
+  }
+
+  cell->count = count;
+  cell->holes = 0;
+}
+
+bool d2k_blockmap_things_init(D2KBlockmapThings *things,
+                              D2KBlockmap *blockmap,
+                              Status *status) {
+  size_t cell_count = blockmap->width * blockmap->height;
+
+  things->width = blockmap->width;
+  things->height = blockmap->height;
+  things->origin_x = blockmap->origin_x;
+  things->origin_y = blockmap->origin_y;
+  array_init(&things->cells, sizeof(D2KBlockmapThingCell));
+  array_init(&things->links, sizeof(D2KBlockmapThingLink));
+
+  if (!array_ensure_capacity(&things->cells, cell_count, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < cell_count; i++) {
+    D2KBlockmapThingCell *cell = array_append_fast(&things->cells);
+
+    cell->count = 0;
+    cell->capacity = D2K_BLOCKMAP_THINGS_INLINE_HANDLES;
+    cell->iterating = 0;
+    cell->holes = 0;
+    cell->spilled = NULL;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_blockmap_things_free(D2KBlockmapThings *things) {
+  for (size_t i = 0; i < things->cells.len; i++) {
+    D2KBlockmapThingCell *cell = array_index_fast(&things->cells, i);
+
+    if (cell->spilled) {
+      d2k_free(cell->spilled);
+    }
+  }
+
+  array_free(&things->cells);
+  array_free(&things->links);
+  things->width = 0;
+  things->height = 0;
+}
+
+bool d2k_blockmap_things_link(D2KBlockmapThings *things,
+                              D2KMapObject *map_object,
+                              Status *status) {
+  uint32_t block_cell = get_block_cell(things, map_object->x, map_object->y);
+  D2KBlockmapThingLink *link = NULL;
+
+  if (!get_link(things, map_object->handle, &link, status)) {
+    return false;
+  }
+
+  if (link->cell) {
+    unlink_from_cell(things, link);
+  }
+
+  if (!block_cell) {
+    return status_ok(status);
+  }
+
+  return link_to_cell(things, link, block_cell, map_object->handle, status);
+}
+
+void d2k_blockmap_things_unlink(D2KBlockmapThings *things,
+                                D2KMapObject *map_object) {
+  uint32_t index = d2k_map_object_handle_index(map_object->handle);
+  D2KBlockmapThingLink *link = NULL;
+
+  if (index >= things->links.len) {
+    return;
+  }
+
+  link = array_index_fast(&things->links, index);
+
+  if (link->cell) {
+    unlink_from_cell(things, link);
+  }
+}
+
+bool d2k_blockmap_things_relink(D2KBlockmapThings *things,
+                                D2KMapObject *map_object,
+                                Status *status) {
+  uint32_t block_cell = get_block_cell(things, map_object->x, map_object->y);
+  D2KBlockmapThingLink *link = NULL;
+
+  if (!get_link(things, map_object->handle, &link, status)) {
+    return false;
+  }
+
+  /* Already the newest in the cell it's staying in */
+  if (block_cell && block_cell == link->cell) {
+    D2KBlockmapThingCell *cell = array_index_fast(&things->cells,
+                                                  block_cell - 1);
+
+    if (link->position == cell->count - 1) {
+      return status_ok(status);
+    }
+  }
+
+  return d2k_blockmap_things_link(things, map_object, status);
+}
+
+bool d2k_blockmap_things_iterate(D2KBlockmapThings *things,
+                                 D2KMapObjectSlab *slab,
+                                 int block_x,
+                                 int block_y,
+                                 D2KBlockmapThingVisitor visitor,
+                                 void *data) {
+  D2KBlockmapThingCell *cell = d2k_blockmap_things_cell(
+    things,
+    block_x,
+    block_y
+  );
+  bool keep_going = true;
+  uint32_t i;
+
+  if (!cell) {
+    return true;
+  }
+
+  /*
+   * Links append, so walking backwards is newest first like vanilla's
+   * head-inserted lists, and anything linked into this cell mid-walk is
+   * skipped.  Unlinking leaves holes while the walk is on (see
+   * unlink_from_cell), so every handle stays where it was and nothing is
+   * visited twice.  The handle array is re-fetched each time because linking
+   * can move it.
+   */
+  cell->iterating++;
+  i = cell->count;
+
+  while (i--) {
+    D2KMapObject *map_object = d2k_map_object_slab_get(
+      slab,
+      d2k_blockmap_thing_cell_handles(cell)[i]
+    );
+
+    /* Holes, and objects removed without being unlinked */
+    if (!map_object) {
+      continue;
+    }
+
+    if (!visitor(map_object, data)) {
+      keep_going = false;
+      break;
+    }
+  }
+
+  cell->iterating--;
+
+  if ((!cell->iterating) && cell->holes) {
+    compact_cell(things, cell);
+  }
+
+  return keep_going;
+}
+
+bool d2k_blockmap_things_iterate_box(D2KBlockmapThings *things,
+                                     D2KMapObjectSlab *slab,
+                                     D2KFixedPoint left,
+                                     D2KFixedPoint bottom,
+                                     D2KFixedPoint right,
+                                     D2KFixedPoint top,
+                                     D2KBlockmapThingVisitor visitor,
+                                     void *data) {
+  int xl = d2k_blockmap_things_block_x(things, left);
+  int xh = d2k_blockmap_things_block_x(things, right);
+  int yl = d2k_blockmap_things_block_y(things, bottom);
+  int yh = d2k_blockmap_things_block_y(things, top);
+
+  /* Cells outside the blockmap are empty anyway; don't walk them */
+  if (xl < 0) {
+    xl = 0;
+  }
+
+  if (yl < 0) {
+    yl = 0;
+  }
+
+  if (xh >= (int)things->width) {
+    xh = (int)things->width - 1;
+  }
+
+  if (yh >= (int)things->height) {
+    yh = (int)things->height - 1;
+  }
+
+  for (int bx = xl; bx <= xh; bx++) {
+    for (int by = yl; by <= yh; by++) {
+      if (!d2k_blockmap_things_iterate(things, slab, bx, by, visitor, data)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,147 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/map.h"
+#include "d2k/map_instance.h"
+#include "d2k/map_linedefs.h"
+#include "d2k/map_sectors.h"
+#include "d2k/map_sidedefs.h"
+
+bool d2k_map_instance_pages_init(D2KMapInstancePages *pages,
+                                 Array *shared,
+                                 size_t element_size,
+                                 Status *status) {
+  size_t page_count = (shared->len + D2K_MAP_INSTANCE_PAGE_MASK) >>
+                      D2K_MAP_INSTANCE_PAGE_SHIFT;
+
+  pages->shared = shared;
+  pages->element_size = element_size;
+  pages->copied_page_count = 0;
+
+  array_init(&pages->pages, sizeof(void *));
+
+  if (!array_set_size(&pages->pages, page_count, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < page_count; i++) {
+    *(void **)array_index_fast(&pages->pages, i) = NULL;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_instance_pages_reset(D2KMapInstancePages *pages) {
+  if (!pages->copied_page_count) {
+    return;
+  }
+
+  for (size_t i = 0; i < pages->pages.len; i++) {
+    void **page = array_index_fast(&pages->pages, i);
+
+    if (*page) {
+      d2k_free(*page);
+      *page = NULL;
+    }
+  }
+
+  pages->copied_page_count = 0;
+}
+
+void d2k_map_instance_pages_free(D2KMapInstancePages *pages) {
+  d2k_map_instance_pages_reset(pages);
+  array_free(&pages->pages);
+  pages->shared = NULL;
+}
+
+bool d2k_map_instance_pages_clone(D2KMapInstancePages *pages, size_t index,
+                                                              void **element,
+                                                              Status *status) {
+  size_t page_index = index >> D2K_MAP_INSTANCE_PAGE_SHIFT;
+  size_t first = page_index << D2K_MAP_INSTANCE_PAGE_SHIFT;
+  void **page = array_index_fast(&pages->pages, page_index);
+
+  if (!(*page)) {
+    size_t count = pages->shared->len - first;
+
+    if (count > D2K_MAP_INSTANCE_PAGE_SIZE) {
+      count = D2K_MAP_INSTANCE_PAGE_SIZE;
+    }
+
+    if (!d2k_memdup(page, array_index_fast(pages->shared, first),
+                          count * pages->element_size,
+                          status)) {
+      return false;
+    }
+
+    pages->copied_page_count++;
+  }
+
+  *element = ((char *)*page) + ((index - first) * pages->element_size);
+
+  return status_ok(status);
+}
+
+bool d2k_map_instance_init(D2KMapInstance *instance, D2KMap *map,
+                                                     Status *status) {
+  memset(instance, 0, sizeof(D2KMapInstance));
+
+  instance->map = map;
+
+  if (!(d2k_map_instance_pages_init(&instance->sectors, &map->sectors,
+                                                       sizeof(D2KSector),
+                                                       status)  &&
+        d2k_map_instance_pages_init(&instance->linedefs, &map->linedefs,
+                                                         sizeof(D2KLinedef),
+                                                         status) &&
+        d2k_map_instance_pages_init(&instance->sidedefs, &map->sidedefs,
+                                                         sizeof(D2KSidedef),
+                                                         status))) {
+    d2k_map_instance_free(instance);
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_instance_free(D2KMapInstance *instance) {
+  d2k_map_instance_pages_free(&instance->sectors);
+  d2k_map_instance_pages_free(&instance->linedefs);
+  d2k_map_instance_pages_free(&instance->sidedefs);
+  instance->map = NULL;
+}
+
+void d2k_map_instance_reset(D2KMapInstance *instance) {
+  d2k_map_instance_pages_reset(&instance->sectors);
+  d2k_map_instance_pages_reset(&instance->linedefs);
+  d2k_map_instance_pages_reset(&instance->sidedefs);
+}
+
+size_t d2k_map_instance_copied_page_count(D2KMapInstance *instance) {
+  return instance->sectors.copied_page_count  +
+         instance->linedefs.copied_page_count +
+         instance->sidedefs.copied_page_count;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -26,9 +26,14 @@
 #include "d2k/map_linedefs.h"
 #include "d2k/map_loader.h"
 #include "d2k/map_nodes.h"
+#include "d2k/map_reject.h"
 #include "d2k/map_sectors.h"
 #include "d2k/map_sidedefs.h"
+#include "d2k/map_subsectors.h"
+#include "d2k/map_things.h"
+#include "d2k/map_udmf.h"
 #include "d2k/map_vertexes.h"
+#include "d2k/texture.h"
 #include "d2k/wad.h"
 
 #define map_not_found(status) status_error( \
@@ -150,6 +155,13 @@
   "map has multiple nodes versions"                   \
 )
 
+#define map_missing_endmap_lump(status) status_error( \
+  status,                                             \
+  "d2k_map",                                          \
+  D2K_MAP_MISSING_ENDMAP_LUMP,                        \
+  "map is missing ENDMAP lump"                        \
+)
+
 const char *d2k_map_lump_vanilla_names[D2K_VANILLA_MAP_LUMP_MAX] = {
   "",
   "THINGS",
@@ -289,37 +301,148 @@ static bool load_binary_map(D2KMapLoader *map_loader, Status *status) {
     }
   }
 
+  if (!load_vanilla_lumps(map_loader, status)) {
+    return false;
+  }
+
+  map_loader->map->hash = d2k_map_hash_lumps(
+    &map_loader->map_lumps[D2K_VANILLA_MAP_LUMP_MAP + 1],
+    D2K_VANILLA_MAP_LUMP_MAX - (D2K_VANILLA_MAP_LUMP_MAP + 1)
+  );
+
   return (
-    load_vanilla_lumps(map_loader, status)                  &&
     d2k_map_loader_detect_nodes_version(map_loader, status) &&
     d2k_map_loader_load_vertexes(map_loader, status)        &&
     d2k_map_loader_load_sectors(map_loader, status)         &&
+    d2k_map_loader_load_reject(map_loader, status)          &&
     d2k_map_loader_load_sidedefs(map_loader, status)        &&
     d2k_map_loader_load_linedefs(map_loader, status)        &&
     // d2k_map_loader_load_sidedefs2(map_loader, status)       &&
     // d2k_map_loader_load_linedefs2(map_loader, status)       &&
     d2k_map_loader_load_blockmap(map_loader, status)        &&
-    d2k_map_loader_load_nodes(map_loader, status)
+    d2k_map_loader_load_nodes(map_loader, status)           &&
+    d2k_map_loader_link_subsectors(map_loader, status)      &&
+    d2k_map_loader_group_lines(map_loader, status)          &&
+    d2k_map_loader_load_things(map_loader, status)
   );
 }
 
 static bool load_udmf_map(D2KMapLoader *map_loader, Status *status) {
-  (void)map_loader;
-  (void)status;
+  size_t start = d2k_map_loader_vanilla_lump_offset(map_loader) + 1;
+  size_t end = start + 1;
+
+  if (!d2k_lump_directory_index(
+        map_loader->lump_directory,
+        start,
+        &map_loader->udmf_start_map_lump,
+        status)) {
+    return false;
+  }
+
+  /* Everything up to ENDMAP belongs to the map: ZNODES, REJECT, BEHAVIOR... */
+  while (true) {
+    if (end >= map_loader->lump_directory->lumps.len) {
+      return map_missing_endmap_lump(status);
+    }
+
+    map_loader->udmf_end_map_lump = parray_index_fast(
+      &map_loader->lump_directory->lumps,
+      end
+    );
+
+    if (strcmp(map_loader->udmf_end_map_lump->name, "ENDMAP") == 0) {
+      break;
+    }
+
+    end++;
+  }
+
+  map_loader->map->hash = d2k_map_hash_lump_range(
+    map_loader->lump_directory,
+    start,
+    end
+  );
+
+  return d2k_map_loader_load_udmf(
+    map_loader,
+    map_loader->udmf_start_map_lump,
+    status
+  );
+}
+
+bool d2k_map_loader_lookup_texture(D2KMapLoader *map_loader,
+                                   const char *raw_name,
+                                   size_t *texture_index,
+                                   Status *status) {
+  uint64_t key = d2k_lump_name_cache_key(raw_name);
+  D2KTexture *texture = NULL;
+  char texture_name[9];
+
+  if (d2k_lump_name_cache_get(&map_loader->texture_name_cache, key,
+                                                               texture_index)) {
+    return status_ok(status);
+  }
+
+  d2k_lump_name_cache_key_to_name(key, texture_name);
+
+  if (!d2k_lump_directory_lookup_texture(map_loader->lump_directory,
+                                         texture_name,
+                                         &texture,
+                                         status)) {
+    return false;
+  }
+
+  *texture_index = texture->index;
+
+  d2k_lump_name_cache_put(&map_loader->texture_name_cache, key,
+                                                           *texture_index);
 
   return status_ok(status);
 }
 
-bool d2k_map_loader_load_map(D2KMapLoader *map_loader,
-                             D2KMap *map,
-                             D2KLumpDirectory *lump_directory,
-                             const char *map_name,
-                             Status *status) {
+bool d2k_map_loader_lookup_flat(D2KMapLoader *map_loader,
+                                const char *raw_name,
+                                size_t *flat_index,
+                                Status *status) {
+  uint64_t key = d2k_lump_name_cache_key(raw_name);
+  D2KLump *flat_lump = NULL;
+  char flat_name[9];
+
+  if (d2k_lump_name_cache_get(&map_loader->flat_name_cache, key, flat_index)) {
+    return status_ok(status);
+  }
+
+  d2k_lump_name_cache_key_to_name(key, flat_name);
+
+  if (!d2k_lump_directory_lookup_ns(map_loader->lump_directory,
+                                    flat_name,
+                                    D2K_LUMP_NAMESPACE_FLATS,
+                                    &flat_lump,
+                                    status)) {
+    return false;
+  }
+
+  *flat_index = flat_lump->index;
+
+  d2k_lump_name_cache_put(&map_loader->flat_name_cache, key, *flat_index);
+
+  return status_ok(status);
+}
+
+static bool load_map(D2KMapLoader *map_loader,
+                     D2KMap *map,
+                     D2KLumpDirectory *lump_directory,
+                     const char *map_name,
+                     Array *repairs,
+                     Status *status) {
   bool first_lump_is_textmap = false;
 
   map_loader->map = map;
+  map_loader->repairs = repairs;
   map_loader->lump_directory = lump_directory;
   map_loader->nodes_version = D2K_MAP_NODES_VERSION_VANILLA;
+  d2k_lump_name_cache_init(&map_loader->texture_name_cache);
+  d2k_lump_name_cache_init(&map_loader->flat_name_cache);
 
   if (!d2k_lump_directory_lookup(
         lump_directory,
@@ -352,4 +475,22 @@ bool d2k_map_loader_load_map(D2KMapLoader *map_loader,
   return load_binary_map(map_loader, status);
 }
 
+bool d2k_map_loader_load_map(D2KMapLoader *map_loader,
+                             D2KMap *map,
+                             D2KLumpDirectory *lump_directory,
+                             const char *map_name,
+                             Status *status) {
+  return load_map(map_loader, map, lump_directory, map_name, NULL, status);
+}
+
+bool d2k_map_loader_repair_map(D2KMapLoader *map_loader,
+                               D2KMap *map,
+                               D2KLumpDirectory *lump_directory,
+                               const char *map_name,
+                               Array *repairs,
+                               Status *status) {
+  return load_map(map_loader, map, lump_directory, map_name, repairs,
+                                                             status);
+}
+
 /* vi: set et ts=2 sw=2: */
@@ -24,6 +24,7 @@
 #include "d2k/map.h"
 #include "d2k/map_loader.h"
 #include "d2k/map_nodes.h"
+#include "d2k/map_problem.h"
 #include "d2k/map_segs.h"
 #include "d2k/map_subsectors.h"
 #include "d2k/wad.h"
@@ -100,8 +101,6 @@
     "ZDoom extended compressed GL UDMF nodes not implemented"              \
   )
 
-#define VANILLA_NODE_SIZE 28
-
 typedef struct D2KMapNodeVersionHeaderInfoStruct {
   D2KMapLump         lump;
   const char        *version_header;
@@ -133,11 +132,41 @@ static inline bool lump_starts_with(D2KLump *lump,
   return slice_equals_data_at(&lump->data, 0, data, len, starts_with, status);
 }
 
+/* PrBoom+ points out-of-range subsector children at subsector 0 */
+static bool repair_child_index(D2KMapLoader *map_loader, size_t node_index,
+                                                         size_t side,
+                                                         size_t child,
+                                                         Status *status) {
+  D2KMapProblem *problem = NULL;
+
+  if (!map_loader->repairs) {
+    return invalid_child_index(status);
+  }
+
+  if (!d2k_map_problem_add(map_loader->repairs,
+                           D2K_MAP_PROBLEM_INVALID_NODE_CHILD_INDEX,
+                           D2K_MAP_LUMP_NODES,
+                           node_index,
+                           &problem,
+                           status)) {
+    return false;
+  }
+
+  problem->as.invalid_node_child_index.side = side;
+  problem->as.invalid_node_child_index.subsector = true;
+  problem->as.invalid_node_child_index.index = child;
+  problem->as.invalid_node_child_index.count =
+    map_loader->map->subsectors.len;
+
+  return status_ok(status);
+}
+
 static bool load_nodes(D2KMapLoader *map_loader, Status *status) {
   D2KLump *nodes_lump = map_loader->map_lumps[D2K_MAP_LUMP_NODES];
-  size_t nodes_count = nodes_lump->data.len / VANILLA_NODE_SIZE;
+  size_t nodes_count = nodes_lump->data.len / D2K_VANILLA_NODE_SIZE;
+  size_t subsector_count = map_loader->map->subsectors.len;
 
-  if ((nodes_lump->data.len % VANILLA_NODE_SIZE) != 0) {
+  if ((nodes_lump->data.len % D2K_VANILLA_NODE_SIZE) != 0) {
     return malformed_nodes_lump(status);
   }
 
@@ -147,11 +176,11 @@ static bool load_nodes(D2KMapLoader *map_loader, Status *status) {
 
   for (size_t i = 0; i < nodes_count; i++) {
     D2KMapNode *node = array_append_fast(&map_loader->map->nodes);
-    char node_data[VANILLA_NODE_SIZE];
+    char node_data[D2K_VANILLA_NODE_SIZE];
     uint16_t children[2];
 
-    slice_read_fast(&nodes_lump->data, i * VANILLA_NODE_SIZE,
-                                       VANILLA_NODE_SIZE,
+    slice_read_fast(&nodes_lump->data, i * D2K_VANILLA_NODE_SIZE,
+                                       D2K_VANILLA_NODE_SIZE,
                                        (void *)node_data);
 
     node->x  = LUMP_DATA_SHORT_TO_FIXED(node_data, 0);
@@ -160,7 +189,8 @@ static bool load_nodes(D2KMapLoader *map_loader, Status *status) {
     node->dy = LUMP_DATA_SHORT_TO_FIXED(node_data, 6);
     for (size_t j = 0; j < 2; j++) {
       for (size_t k = 0; k < 4; k++) {
-        node->bbox[j][k] = LUMP_DATA_SHORT_TO_FIXED(node_data, (j * 4) + k);
+        node->bbox[j][k] = LUMP_DATA_SHORT_TO_FIXED(node_data,
+                                                    8 + (j * 8) + (k * 2));
       }
     }
     children[0] = LUMP_DATA_SHORT_TO_USHORT(node_data, 24);
@@ -177,9 +207,13 @@ static bool load_nodes(D2KMapLoader *map_loader, Status *status) {
 
         node->children[j] = new_child_value;
 
-        if ((size_t)node->children[j] >= map_loader->map->nodes.len) {
-          /* PrBoom+ sets this to 0 */
-          return invalid_child_index(status);
+        if ((size_t)node->children[j] >= subsector_count) {
+          if (!repair_child_index(map_loader, i, j, node->children[j],
+                                                    status)) {
+            return false;
+          }
+
+          node->children[j] = 0;
         }
 
         node->children[j] |= D2K_MAP_NODE_FLAGS_SUBSECTOR;
@@ -432,4 +466,24 @@ bool d2k_map_loader_load_nodes(D2KMapLoader *map_loader, Status *status) {
   return unknown_nodes_version(status);
 }
 
+D2KSubsector* d2k_map_point_in_subsector(D2KMap *map, D2KFixedPoint x,
+                                                      D2KFixedPoint y) {
+  int child;
+
+  if (!map->nodes.len) {
+    return array_index_fast(&map->subsectors, 0);
+  }
+
+  child = (int)(map->nodes.len - 1);
+
+  while (!d2k_map_node_child_is_subsector(child)) {
+    D2KMapNode *node = array_index_fast(&map->nodes, child);
+
+    child = node->children[d2k_map_node_point_on_side(node, x, y)];
+  }
+
+  return array_index_fast(&map->subsectors,
+                          d2k_map_node_child_subsector(child));
+}
+
 /* vi: set et ts=2 sw=2: */
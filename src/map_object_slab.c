@@ -0,0 +1,163 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/map_object.h"
+#include "d2k/map_object_slab.h"
+
+#define slab_full(status) status_error( \
+  status,                               \
+  "d2k_map_object_slab",                \
+  D2K_MAP_OBJECT_SLAB_FULL,             \
+  "too many map objects"                \
+)
+
+static bool add_chunk(D2KMapObjectSlab *slab, Status *status) {
+  D2KMapObject *chunk = NULL;
+  D2KMapObject **entry = NULL;
+  uint32_t first = (uint32_t)slab->slots.len;
+
+  if (slab->slots.len >= D2K_MAP_OBJECT_SLAB_MAX_OBJECTS) {
+    return slab_full(status);
+  }
+
+  if (!array_ensure_capacity(&slab->slots,
+                             slab->slots.len + D2K_MAP_OBJECT_SLAB_CHUNK_SIZE,
+                             status)) {
+    return false;
+  }
+
+  if (!d2k_calloc((void **)&chunk, D2K_MAP_OBJECT_SLAB_CHUNK_SIZE,
+                                   sizeof(D2KMapObject),
+                                   status)) {
+    return false;
+  }
+
+  if (!array_append(&slab->chunks, (void **)&entry, status)) {
+    d2k_free(chunk);
+    return false;
+  }
+
+  *entry = chunk;
+
+  /* Thread the new slots onto the free list in order, lowest first */
+  for (uint32_t i = 0; i < D2K_MAP_OBJECT_SLAB_CHUNK_SIZE; i++) {
+    D2KMapObjectSlot *slot = array_append_fast(&slab->slots);
+
+    slot->generation = 1;
+    slot->live = false;
+    slot->next_free = (i + 1 < D2K_MAP_OBJECT_SLAB_CHUNK_SIZE) ?
+      first + i + 1 :
+      slab->free_head;
+  }
+
+  slab->free_head = first;
+
+  return status_ok(status);
+}
+
+bool d2k_map_object_slab_init(D2KMapObjectSlab *slab, size_t capacity,
+                                                      Status *status) {
+  array_init(&slab->chunks, sizeof(D2KMapObject *));
+  array_init(&slab->slots, sizeof(D2KMapObjectSlot));
+  slab->free_head = D2K_MAP_OBJECT_SLAB_NO_SLOT;
+  slab->live_count = 0;
+
+  while (slab->slots.len < capacity) {
+    if (!add_chunk(slab, status)) {
+      d2k_map_object_slab_free(slab);
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_object_slab_free(D2KMapObjectSlab *slab) {
+  for (size_t i = 0; i < slab->chunks.len; i++) {
+    d2k_free(*(D2KMapObject **)array_index_fast(&slab->chunks, i));
+  }
+
+  array_free(&slab->chunks);
+  array_free(&slab->slots);
+  slab->free_head = D2K_MAP_OBJECT_SLAB_NO_SLOT;
+  slab->live_count = 0;
+}
+
+bool d2k_map_object_slab_spawn(D2KMapObjectSlab *slab,
+                               D2KMapObject **map_object,
+                               Status *status) {
+  D2KMapObjectSlot *slot = NULL;
+  D2KMapObject *new_object = NULL;
+  uint32_t index;
+
+  if (slab->free_head == D2K_MAP_OBJECT_SLAB_NO_SLOT) {
+    if (!add_chunk(slab, status)) {
+      return false;
+    }
+  }
+
+  index = slab->free_head;
+  slot = array_index_fast(&slab->slots, index);
+  slab->free_head = slot->next_free;
+  slot->live = true;
+  slot->next_free = D2K_MAP_OBJECT_SLAB_NO_SLOT;
+  slab->live_count++;
+
+  new_object = d2k_map_object_slab_slot_object(slab, index);
+  memset(new_object, 0, sizeof(D2KMapObject));
+  new_object->handle = (((D2KMapObjectHandle)slot->generation) <<
+                        D2K_MAP_OBJECT_HANDLE_INDEX_BITS) | index;
+
+  *map_object = new_object;
+
+  return status_ok(status);
+}
+
+void d2k_map_object_slab_remove(D2KMapObjectSlab *slab,
+                                D2KMapObjectHandle handle) {
+  uint32_t index = d2k_map_object_handle_index(handle);
+  D2KMapObjectSlot *slot;
+
+  if (!d2k_map_object_slab_get(slab, handle)) {
+    return;
+  }
+
+  slot = array_index_fast(&slab->slots, index);
+  slot->live = false;
+  slab->live_count--;
+
+  /*
+   * Wrapping the generation would let a handle from its first use resolve
+   * again, so a slot that's used them all up is retired instead of freed.
+   */
+  if (slot->generation == D2K_MAP_OBJECT_HANDLE_GENERATION_MAX) {
+    return;
+  }
+
+  slot->generation++;
+  slot->next_free = slab->free_head;
+  slab->free_head = index;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,211 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/map_object_state_table.h"
+
+#define too_many_states(status) status_error( \
+  status,                                     \
+  "d2k_map_object_state_table",               \
+  D2K_MAP_OBJECT_STATE_TABLE_TOO_MANY_STATES, \
+  "too many states"                           \
+)
+
+#define invalid_next_state(status) status_error(  \
+  status,                                         \
+  "d2k_map_object_state_table",                   \
+  D2K_MAP_OBJECT_STATE_TABLE_INVALID_NEXT_STATE,  \
+  "state's next state is out of range"            \
+)
+
+/*
+ * Returns the action's index, adding it if it's new.  There are only a
+ * couple of hundred distinct actions, so a linear search is fine.
+ */
+static bool get_action_index(D2KMapObjectStateTable *table,
+                             D2KActionFunction action,
+                             uint16_t *index,
+                             Status *status) {
+  D2KActionFunction *new_action = NULL;
+
+  if (!action) {
+    *index = 0;
+    return status_ok(status);
+  }
+
+  for (size_t i = 1; i < table->actions.len; i++) {
+    if (*(D2KActionFunction *)array_index_fast(&table->actions, i) == action) {
+      *index = (uint16_t)i;
+      return status_ok(status);
+    }
+  }
+
+  if (!array_append(&table->actions, (void **)&new_action, status)) {
+    return false;
+  }
+
+  *new_action = action;
+  *index = (uint16_t)(table->actions.len - 1);
+
+  return status_ok(status);
+}
+
+bool d2k_map_object_state_table_init(D2KMapObjectStateTable *table,
+                                     const D2KMapObjectState *states,
+                                     size_t state_count,
+                                     Status *status) {
+  D2KActionFunction *no_action = NULL;
+
+  array_init(&table->hot, sizeof(D2KMapObjectStateHot));
+  array_init(&table->cold, sizeof(D2KMapObjectStateCold));
+  array_init(&table->actions, sizeof(D2KActionFunction));
+  table->advancing = 0;
+
+  if (state_count > D2K_MAP_OBJECT_STATE_TABLE_MAX_STATES) {
+    return too_many_states(status);
+  }
+
+  if ((!array_ensure_capacity(&table->hot, state_count, status)) ||
+      (!array_ensure_capacity(&table->cold, state_count, status)) ||
+      (!array_append(&table->actions, (void **)&no_action, status))) {
+    d2k_map_object_state_table_free(table);
+    return false;
+  }
+
+  *no_action = NULL;
+
+  for (size_t i = 0; i < state_count; i++) {
+    const D2KMapObjectState *state = &states[i];
+    D2KMapObjectStateHot *hot = array_append_fast(&table->hot);
+    D2KMapObjectStateCold *cold = array_append_fast(&table->cold);
+
+    if ((size_t)state->next_state >= state_count) {
+      d2k_map_object_state_table_free(table);
+      return invalid_next_state(status);
+    }
+
+    if (!get_action_index(table, state->action, &hot->action, status)) {
+      d2k_map_object_state_table_free(table);
+      return false;
+    }
+
+    hot->tics = state->tics;
+    hot->next_state = (uint16_t)state->next_state;
+    cold->sprite = state->sprite;
+    cold->frame = state->frame;
+    cold->misc1 = state->misc1;
+    cold->misc2 = state->misc2;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_object_state_table_free(D2KMapObjectStateTable *table) {
+  array_free(&table->hot);
+  array_free(&table->cold);
+  array_free(&table->actions);
+}
+
+bool d2k_map_object_state_table_set_state(D2KMapObjectStateTable *table,
+                                          int32_t *tics,
+                                          uint32_t *states,
+                                          size_t actor,
+                                          uint32_t state,
+                                          D2KMapObjectStateHandler handler,
+                                          void *data) {
+  if ((state != D2K_MAP_OBJECT_STATE_NUM_NULL) && (state >= table->hot.len)) {
+    return false;
+  }
+
+  do {
+    D2KMapObjectStateHot *hot;
+
+    if (state == D2K_MAP_OBJECT_STATE_NUM_NULL) {
+      states[actor] = D2K_MAP_OBJECT_STATE_NUM_NULL;
+      tics[actor] = -1;
+      handler(actor, state, NULL, data);
+      return false;
+    }
+
+    hot = d2k_map_object_state_table_hot(table, state);
+    states[actor] = state;
+    tics[actor] = hot->tics;
+
+    /*
+     * As in vanilla, the state followed next is the one this state named,
+     * even if the action set another; only the tics it left count.
+     */
+    if (hot->action) {
+      D2KActionFunction action = *(D2KActionFunction *)array_index_fast(
+        &table->actions,
+        hot->action
+      );
+
+      if (!handler(actor, state, action, data)) {
+        return false;
+      }
+    }
+
+    state = hot->next_state;
+  } while (!tics[actor]);
+
+  /* The advance has already counted this actor down, but not these tics */
+  if (table->advancing && (actor >= table->advancing)) {
+    tics[actor] -= (tics[actor] != -1);
+  }
+
+  return true;
+}
+
+void d2k_map_object_state_table_advance(D2KMapObjectStateTable *table,
+                                        int32_t *tics,
+                                        uint32_t *states,
+                                        size_t count,
+                                        D2KMapObjectStateHandler handler,
+                                        void *data) {
+  /* Branch-free, so this loop vectorizes */
+  for (size_t i = 0; i < count; i++) {
+    tics[i] -= (tics[i] != -1);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    if (tics[i]) {
+      continue;
+    }
+
+    table->advancing = i + 1;
+    d2k_map_object_state_table_set_state(
+      table,
+      tics,
+      states,
+      i,
+      d2k_map_object_state_table_hot(table, states[i])->next_state,
+      handler,
+      data
+    );
+  }
+
+  table->advancing = 0;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,50 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/map_problem.h"
+
+bool d2k_map_problem_add(Array *problems, D2KMapProblemType type,
+                                         D2KMapLump lump,
+                                         size_t record,
+                                         D2KMapProblem **problem,
+                                         Status *status) {
+  D2KMapProblem *new_problem = NULL;
+
+  if (!array_append(problems, (void **)&new_problem, status)) {
+    return false;
+  }
+
+  memset(new_problem, 0, sizeof(D2KMapProblem));
+  new_problem->type = type;
+  new_problem->lump = lump;
+  new_problem->record = record;
+
+  if (problem) {
+    *problem = new_problem;
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,57 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+#include "d2k/map.h"
+#include "d2k/map_loader.h"
+#include "d2k/map_reject.h"
+#include "d2k/wad.h"
+
+bool d2k_map_loader_load_reject(D2KMapLoader *map_loader, Status *status) {
+  D2KMap *map = map_loader->map;
+  D2KLump *reject_lump = map_loader->map_lumps[D2K_VANILLA_MAP_LUMP_REJECT];
+  size_t reject_size = ((map->sectors.len * map->sectors.len) + 7) / 8;
+  size_t copy_size = reject_size;
+
+  if (!array_set_size(&map->reject, reject_size, status)) {
+    return false;
+  }
+
+  if (!reject_size) {
+    return status_ok(status);
+  }
+
+  /* PrBoom+ pads short REJECT lumps; zeros mean "not rejected" */
+  if (reject_lump->data.len < copy_size) {
+    copy_size = reject_lump->data.len;
+    memset(array_index_fast(&map->reject, 0), 0, reject_size);
+  }
+
+  if (copy_size) {
+    slice_read_fast(&reject_lump->data, 0, copy_size,
+                                        array_index_fast(&map->reject, 0));
+  }
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
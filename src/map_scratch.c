@@ -0,0 +1,76 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+#include "d2k/angle.h"
+#include "d2k/map.h"
+#include "d2k/map_scratch.h"
+#include "d2k/stamp_table.h"
+
+static bool init_zeroed(Array *array, size_t element_size, size_t count,
+                                                           Status *status) {
+  array_init(array, element_size);
+
+  if (!array_set_size(array, count, status)) {
+    return false;
+  }
+
+  if (count) {
+    memset(array_index_fast(array, 0), 0, count * element_size);
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_map_scratch_init(D2KMapScratch *scratch, D2KMap *map,
+                                                  Status *status) {
+  memset(scratch, 0, sizeof(D2KMapScratch));
+
+  scratch->map = map;
+
+  if (!(d2k_stamp_table_init(&scratch->lines, map->linedefs.len, status)   &&
+        d2k_stamp_table_init(&scratch->render_lines, map->linedefs.len,
+                                                     status)               &&
+        d2k_stamp_table_init(&scratch->sectors, map->sectors.len, status)  &&
+        init_zeroed(&scratch->vertex_view_angles, sizeof(D2KAngle),
+                                                  map->vertexes.len,
+                                                  status)                  &&
+        init_zeroed(&scratch->vertex_angle_times, sizeof(int),
+                                                  map->vertexes.len,
+                                                  status))) {
+    d2k_map_scratch_free(scratch);
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_scratch_free(D2KMapScratch *scratch) {
+  d2k_stamp_table_free(&scratch->lines);
+  d2k_stamp_table_free(&scratch->render_lines);
+  d2k_stamp_table_free(&scratch->sectors);
+  array_free(&scratch->vertex_view_angles);
+  array_free(&scratch->vertex_angle_times);
+  scratch->map = NULL;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,264 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/fixed_math.h"
+#include "d2k/map.h"
+#include "d2k/map_object.h"
+#include "d2k/map_sectors.h"
+#include "d2k/map_sector_nodes.h"
+
+static void free_chunk_nodes(D2KMapSectorNodes *nodes,
+                             D2KMapSectorNode *chunk) {
+  for (size_t i = 0; i < D2K_MAP_SECTOR_NODES_CHUNK_SIZE; i++) {
+    chunk[i].next_sector_map_sector_node = nodes->free_nodes;
+    nodes->free_nodes = &chunk[i];
+  }
+}
+
+static bool add_chunk(D2KMapSectorNodes *nodes, Status *status) {
+  D2KMapSectorNode *chunk = NULL;
+  D2KMapSectorNode **entry = NULL;
+
+  if (!d2k_calloc((void **)&chunk, D2K_MAP_SECTOR_NODES_CHUNK_SIZE,
+                                   sizeof(D2KMapSectorNode),
+                                   status)) {
+    return false;
+  }
+
+  if (!array_append(&nodes->chunks, (void **)&entry, status)) {
+    d2k_free(chunk);
+    return false;
+  }
+
+  *entry = chunk;
+  free_chunk_nodes(nodes, chunk);
+
+  return status_ok(status);
+}
+
+static bool size_sector_heads(D2KMapSectorNodes *nodes, D2KMap *map,
+                                                        Status *status) {
+  array_clear(&nodes->sector_heads);
+
+  if (!array_ensure_capacity(&nodes->sector_heads, map->sectors.len,
+                                                   status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < map->sectors.len; i++) {
+    D2KMapSectorNode **head = array_append_fast(&nodes->sector_heads);
+
+    *head = NULL;
+  }
+
+  nodes->map = map;
+
+  return status_ok(status);
+}
+
+/* P_GetSecnode */
+static bool get_node(D2KMapSectorNodes *nodes, D2KMapSectorNode **node,
+                                               Status *status) {
+  if (!nodes->free_nodes) {
+    if (!add_chunk(nodes, status)) {
+      return false;
+    }
+  }
+
+  *node = nodes->free_nodes;
+  nodes->free_nodes = (*node)->next_sector_map_sector_node;
+  nodes->live_count++;
+
+  return status_ok(status);
+}
+
+/* P_DelSecnode: returns the next node in the object's list */
+static D2KMapSectorNode* delete_node(D2KMapSectorNodes *nodes,
+                                     D2KMapSectorNode *node) {
+  D2KMapSectorNode *tp = node->previous_thing_map_sector_node;
+  D2KMapSectorNode *tn = node->next_thing_map_sector_node;
+  D2KMapSectorNode *sp = node->previous_sector_map_sector_node;
+  D2KMapSectorNode *sn = node->next_sector_map_sector_node;
+
+  if (tp) {
+    tp->next_thing_map_sector_node = tn;
+  }
+
+  if (tn) {
+    tn->previous_thing_map_sector_node = tp;
+  }
+
+  if (sp) {
+    sp->next_sector_map_sector_node = sn;
+  }
+  else if (!d2k_map_sector_is_null(node->sector)) {
+    D2KMapSectorNode **head = array_index_fast(&nodes->sector_heads,
+                                               node->sector->id);
+
+    *head = sn;
+  }
+
+  if (sn) {
+    sn->previous_sector_map_sector_node = sp;
+  }
+
+  node->next_sector_map_sector_node = nodes->free_nodes;
+  nodes->free_nodes = node;
+  nodes->live_count--;
+
+  return tn;
+}
+
+bool d2k_map_sector_nodes_init(D2KMapSectorNodes *nodes, D2KMap *map,
+                                                         Status *status) {
+  array_init(&nodes->chunks, sizeof(D2KMapSectorNode *));
+  array_init(&nodes->sector_heads, sizeof(D2KMapSectorNode *));
+  nodes->free_nodes = NULL;
+  nodes->live_count = 0;
+
+  if (!size_sector_heads(nodes, map, status)) {
+    d2k_map_sector_nodes_free(nodes);
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_sector_nodes_free(D2KMapSectorNodes *nodes) {
+  for (size_t i = 0; i < nodes->chunks.len; i++) {
+    d2k_free(*(D2KMapSectorNode **)array_index_fast(&nodes->chunks, i));
+  }
+
+  array_free(&nodes->chunks);
+  array_free(&nodes->sector_heads);
+  nodes->map = NULL;
+  nodes->free_nodes = NULL;
+  nodes->live_count = 0;
+}
+
+bool d2k_map_sector_nodes_reset(D2KMapSectorNodes *nodes, D2KMap *map,
+                                                          Status *status) {
+  nodes->free_nodes = NULL;
+  nodes->live_count = 0;
+
+  for (size_t i = 0; i < nodes->chunks.len; i++) {
+    free_chunk_nodes(
+      nodes,
+      *(D2KMapSectorNode **)array_index_fast(&nodes->chunks, i)
+    );
+  }
+
+  return size_sector_heads(nodes, map, status);
+}
+
+void d2k_map_sector_nodes_begin(D2KMapObject *map_object) {
+  for (D2KMapSectorNode *node = map_object->touching_sectorlist;
+       node;
+       node = node->next_thing_map_sector_node) {
+    node->mobj = NULL;
+  }
+}
+
+/* P_AddSecnode */
+bool d2k_map_sector_nodes_touch(D2KMapSectorNodes *nodes,
+                                D2KMapObject *map_object,
+                                D2KSector *sector,
+                                Status *status) {
+  D2KMapSectorNode *first = map_object->touching_sectorlist;
+  D2KMapSectorNode **head = NULL;
+  D2KMapSectorNode *node = NULL;
+
+  for (node = first; node; node = node->next_thing_map_sector_node) {
+    if (node->sector == sector) {
+      node->mobj = map_object;
+      return status_ok(status);
+    }
+  }
+
+  /* Repaired segs' null sector has no slot in sector_heads, nor lines */
+  if (d2k_map_sector_is_null(sector)) {
+    return status_ok(status);
+  }
+
+  if (!get_node(nodes, &node, status)) {
+    return false;
+  }
+
+  head = array_index_fast(&nodes->sector_heads, sector->id);
+
+  node->visited = false;
+  node->sector = sector;
+  node->mobj = map_object;
+
+  node->previous_thing_map_sector_node = NULL;
+  node->next_thing_map_sector_node = first;
+
+  if (first) {
+    first->previous_thing_map_sector_node = node;
+  }
+
+  map_object->touching_sectorlist = node;
+
+  node->previous_sector_map_sector_node = NULL;
+  node->next_sector_map_sector_node = *head;
+
+  if (*head) {
+    (*head)->previous_sector_map_sector_node = node;
+  }
+
+  *head = node;
+
+  return status_ok(status);
+}
+
+void d2k_map_sector_nodes_end(D2KMapSectorNodes *nodes,
+                              D2KMapObject *map_object) {
+  D2KMapSectorNode *node = map_object->touching_sectorlist;
+
+  while (node) {
+    if (node->mobj) {
+      node = node->next_thing_map_sector_node;
+      continue;
+    }
+
+    if (node == map_object->touching_sectorlist) {
+      map_object->touching_sectorlist = node->next_thing_map_sector_node;
+    }
+
+    node = delete_node(nodes, node);
+  }
+}
+
+void d2k_map_sector_nodes_unlink_all(D2KMapSectorNodes *nodes,
+                                     D2KMapObject *map_object) {
+  D2KMapSectorNode *node = map_object->touching_sectorlist;
+
+  while (node) {
+    node = delete_node(nodes, node);
+  }
+
+  map_object->touching_sectorlist = NULL;
+}
+
+/* vi: set et ts=2 sw=2: */
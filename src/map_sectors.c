@@ -21,8 +21,12 @@
 /*****************************************************************************/
 
 #include "d2k/internal.h"
+#include "d2k/fixed_vertex.h"
+#include "d2k/map_blockmap.h"
+#include "d2k/map_linedefs.h"
 #include "d2k/map_loader.h"
 #include "d2k/map_sectors.h"
+#include "d2k/map_sidedefs.h"
 #include "d2k/wad.h"
 
 #define malformed_sectors_lump(status) status_error( \
@@ -32,13 +36,58 @@
   "malformed SECTORS lump"                           \
 )
 
-#define SECTOR_SIZE 26
+static inline void add_to_box(int *box, D2KFixedPoint x, D2KFixedPoint y) {
+  if (x < box[BOXLEFT]) {
+    box[BOXLEFT] = x;
+  }
+
+  if (x > box[BOXRIGHT]) {
+    box[BOXRIGHT] = x;
+  }
+
+  if (y < box[BOXBOTTOM]) {
+    box[BOXBOTTOM] = y;
+  }
+
+  if (y > box[BOXTOP]) {
+    box[BOXTOP] = y;
+  }
+}
+
+static inline void add_line_to_sector(D2KSector *sector, D2KLinedef *line) {
+  sector->line_count++;
+  add_to_box(sector->bbox, line->v1->x, line->v1->y);
+  add_to_box(sector->bbox, line->v2->x, line->v2->y);
+}
+
+static inline void set_blockbox(D2KSector *sector, D2KBlockmap *bmap) {
+  int block;
+
+  block = (sector->bbox[BOXTOP] - bmap->origin_y + MAXRADIUS) >> MAPBLOCKSHIFT;
+  sector->blockbox[BOXTOP] = (block >= (int)bmap->height) ?
+    (int)bmap->height - 1 :
+    block;
+
+  block = (sector->bbox[BOXBOTTOM] - bmap->origin_y - MAXRADIUS) >>
+          MAPBLOCKSHIFT;
+  sector->blockbox[BOXBOTTOM] = (block < 0) ? 0 : block;
+
+  block = (sector->bbox[BOXRIGHT] - bmap->origin_x + MAXRADIUS) >>
+          MAPBLOCKSHIFT;
+  sector->blockbox[BOXRIGHT] = (block >= (int)bmap->width) ?
+    (int)bmap->width - 1 :
+    block;
+
+  block = (sector->bbox[BOXLEFT] - bmap->origin_x - MAXRADIUS) >>
+          MAPBLOCKSHIFT;
+  sector->blockbox[BOXLEFT] = (block < 0) ? 0 : block;
+}
 
 bool d2k_map_loader_load_sectors(D2KMapLoader *map_loader, Status *status) {
   D2KLump *sectors_lump = map_loader->map_lumps[D2K_MAP_LUMP_SECTORS];
-  size_t sector_count = sectors_lump->data.len / SECTOR_SIZE;
+  size_t sector_count = sectors_lump->data.len / D2K_VANILLA_SECTOR_SIZE;
 
-  if ((sectors_lump->data.len % SECTOR_SIZE) != 0) {
+  if ((sectors_lump->data.len % D2K_VANILLA_SECTOR_SIZE) != 0) {
     return malformed_sectors_lump(status);
   }
 
@@ -49,46 +98,153 @@ bool d2k_map_loader_load_sectors(D2KMapLoader *map_loader, Status *status) {
 
   for (size_t i = 0; i < sector_count; i++) {
     D2KSector *sector = array_append_fast(&map_loader->map->sectors);
-    char sector_data[SECTOR_SIZE];
-    char floor_texture[9] = { 0 };
-    char ceiling_texture[9] = { 0 };
-    D2KLump *flat_lump = NULL;
+    char sector_data[D2K_VANILLA_SECTOR_SIZE];
 
     sector->id = i;
 
-    slice_read_fast(&sectors_lump->data, i * SECTOR_SIZE,
-                                         SECTOR_SIZE,
+    slice_read_fast(&sectors_lump->data, i * D2K_VANILLA_SECTOR_SIZE,
+                                         D2K_VANILLA_SECTOR_SIZE,
                                          (void *)sector_data);
 
     sector->floor_height = LUMP_DATA_SHORT_TO_FIXED(sector_data, 0);
     sector->ceiling_height = LUMP_DATA_SHORT_TO_FIXED(sector_data, 2);
-    cbmemmove((void *)floor_texture, (void *)&sector_data[4], 8);
-    cbmemmove((void *)ceiling_texture, (void *)&sector_data[12], 8);
-    sector->light_level = LUMP_DATA_SHORT_TO_FIXED(sector_data, 20);
-    sector->special = LUMP_DATA_SHORT_TO_FIXED(sector_data, 22);
-    sector->tag = LUMP_DATA_SHORT_TO_FIXED(sector_data, 24);
-
-    if (!d2k_lump_directory_lookup_ns(map_loader->lump_directory,
-                                      floor_texture,
-                                      D2K_LUMP_NAMESPACE_FLATS,
-                                      &flat_lump,
-                                      status)) {
+    sector->light_level = LUMP_DATA_SHORT_TO_SHORT(sector_data, 20);
+    sector->special = LUMP_DATA_SHORT_TO_SHORT(sector_data, 22);
+    sector->tag = LUMP_DATA_SHORT_TO_SHORT(sector_data, 24);
+
+    if (!d2k_map_loader_lookup_flat(map_loader, &sector_data[4],
+                                                &sector->floor_texture,
+                                                status)) {
       return false;
     }
 
-    sector->floor_texture = flat_lump->index;
+    if (!d2k_map_loader_lookup_flat(map_loader, &sector_data[12],
+                                                &sector->ceiling_texture,
+                                                status)) {
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+/*
+ * PrBoom+'s P_GroupLines, minus the per-sector allocations: count each
+ * sector's lines (accumulating bounding boxes on the way), turn the counts
+ * into offsets into one shared array, then fill it.
+ */
+bool d2k_map_loader_group_lines(D2KMapLoader *map_loader, Status *status) {
+  D2KMap *map = map_loader->map;
+  size_t total_line_count = 0;
+
+  for (size_t i = 0; i < map->sectors.len; i++) {
+    D2KSector *sector = array_index_fast(&map->sectors, i);
+
+    sector->line_count = 0;
+    sector->bbox[BOXTOP] = INT_MIN;
+    sector->bbox[BOXRIGHT] = INT_MIN;
+    sector->bbox[BOXBOTTOM] = INT_MAX;
+    sector->bbox[BOXLEFT] = INT_MAX;
+  }
 
-    if (!d2k_lump_directory_lookup_ns(map_loader->lump_directory,
-                                      ceiling_texture,
-                                      D2K_LUMP_NAMESPACE_FLATS,
-                                      &flat_lump,
-                                      status)) {
+  for (size_t i = 0; i < map->linedefs.len; i++) {
+    D2KLinedef *line = array_index_fast(&map->linedefs, i);
+
+    line->front_sector = line->front_side ? line->front_side->sector : NULL;
+    line->back_sector = line->back_side ? line->back_side->sector : NULL;
+
+    if (line->front_sector) {
+      add_line_to_sector(line->front_sector, line);
+    }
+
+    if (line->back_sector && line->back_sector != line->front_sector) {
+      add_line_to_sector(line->back_sector, line);
+    }
+  }
+
+  for (size_t i = 0; i < map->sectors.len; i++) {
+    D2KSector *sector = array_index_fast(&map->sectors, i);
+
+    sector->first_line = total_line_count;
+    total_line_count += sector->line_count;
+    sector->line_count = 0;
+  }
+
+  if (!array_set_size(&map->sector_lines, total_line_count, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < map->linedefs.len; i++) {
+    D2KLinedef *line = array_index_fast(&map->linedefs, i);
+    D2KSector *front_sector = line->front_sector;
+    D2KSector *back_sector = line->back_sector;
+
+    if (front_sector) {
+      D2KLinedef **slot = array_index_fast(
+        &map->sector_lines,
+        front_sector->first_line + front_sector->line_count++
+      );
+
+      *slot = line;
+    }
+
+    if (back_sector && back_sector != front_sector) {
+      D2KLinedef **slot = array_index_fast(
+        &map->sector_lines,
+        back_sector->first_line + back_sector->line_count++
+      );
+
+      *slot = line;
+    }
+  }
+
+  for (size_t i = 0; i < map->sectors.len; i++) {
+    D2KSector *sector = array_index_fast(&map->sectors, i);
+
+    /*
+     * A sector with no lines still has its INT_MIN/INT_MAX starting box,
+     * which would overflow below; give it an empty box and blockbox instead.
+     */
+    if (!sector->line_count) {
+      sector->bbox[BOXTOP] = 0;
+      sector->bbox[BOXBOTTOM] = 0;
+      sector->bbox[BOXLEFT] = 0;
+      sector->bbox[BOXRIGHT] = 0;
+      sector->sound_origin.x = 0;
+      sector->sound_origin.y = 0;
+      sector->sound_origin.id = sector->id;
+      sector->blockbox[BOXTOP] = -1;
+      sector->blockbox[BOXBOTTOM] = 0;
+      sector->blockbox[BOXLEFT] = 0;
+      sector->blockbox[BOXRIGHT] = -1;
+      continue;
+    }
+
+    /* Halved separately so the sum can't overflow */
+    sector->sound_origin.x = sector->bbox[BOXRIGHT] / 2 +
+                             sector->bbox[BOXLEFT] / 2;
+    sector->sound_origin.y = sector->bbox[BOXTOP] / 2 +
+                             sector->bbox[BOXBOTTOM] / 2;
+    sector->sound_origin.id = sector->id;
+
+    set_blockbox(sector, &map->blockmap);
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_map_get_null_sector(D2KMap *map, D2KSector **sector, Status *status) {
+  if (!map->null_sector) {
+    if (!d2k_calloc((void **)&map->null_sector, 1, sizeof(D2KSector),
+                                                   status)) {
       return false;
     }
 
-    sector->ceiling_texture = flat_lump->index;
+    map->null_sector->id = D2K_MAP_NULL_SECTOR_ID;
   }
 
+  *sector = map->null_sector;
+
   return status_ok(status);
 }
 
@@ -29,6 +29,8 @@
 #include "d2k/map.h"
 #include "d2k/map_loader.h"
 #include "d2k/map_linedefs.h"
+#include "d2k/map_problem.h"
+#include "d2k/map_sectors.h"
 #include "d2k/map_segs.h"
 #include "d2k/map_sidedefs.h"
 #include "d2k/wad.h"
@@ -75,8 +77,6 @@
   "2-sided seg missing the other side"                         \
 )
 
-#define VANILLA_SEG_SIZE 12
-
 static inline D2KFixedPoint get_offset(D2KFixedVertex *v1,
                                        D2KFixedVertex *v2) {
   float a = d2k_fixed_point_to_float(v1->x - v2->x);
@@ -85,11 +85,63 @@ static inline D2KFixedPoint get_offset(D2KFixedVertex *v1,
   return d2k_float_to_fixed_point(sqrt(a * a + b * b));
 }
 
+/* PrBoom+'s fix for out-of-range vertex indices: use the linedef's */
+static bool repair_seg_vertexes(D2KMapLoader *map_loader,
+                                D2KSeg *seg,
+                                size_t seg_index,
+                                size_t start_vertex_index,
+                                size_t end_vertex_index,
+                                int16_t side,
+                                Status *status) {
+  size_t vertex_count = map_loader->map->vertexes.len;
+  D2KMapProblem *problem = NULL;
+
+  if (start_vertex_index >= vertex_count) {
+    if (!d2k_map_problem_add(map_loader->repairs,
+                             D2K_MAP_PROBLEM_INVALID_SEG_START_VERTEX_INDEX,
+                             D2K_MAP_LUMP_SEGS,
+                             seg_index,
+                             &problem,
+                             status)) {
+      return false;
+    }
+
+    problem->as.invalid_index.index = start_vertex_index;
+    problem->as.invalid_index.count = vertex_count;
+  }
+
+  if (end_vertex_index >= vertex_count) {
+    if (!d2k_map_problem_add(map_loader->repairs,
+                             D2K_MAP_PROBLEM_INVALID_SEG_END_VERTEX_INDEX,
+                             D2K_MAP_LUMP_SEGS,
+                             seg_index,
+                             &problem,
+                             status)) {
+      return false;
+    }
+
+    problem->as.invalid_index.index = end_vertex_index;
+    problem->as.invalid_index.count = vertex_count;
+  }
+
+  if (side == 0) {
+    seg->v1 = seg->linedef->v1;
+    seg->v2 = seg->linedef->v2;
+  }
+  else {
+    seg->v1 = seg->linedef->v2;
+    seg->v2 = seg->linedef->v1;
+  }
+
+  return status_ok(status);
+}
+
 bool d2k_map_loader_load_segs(D2KMapLoader *map_loader, Status *status) {
   D2KLump *segs_lump = map_loader->map_lumps[D2K_MAP_LUMP_SEGS];
-  size_t seg_count = segs_lump->data.len / VANILLA_SEG_SIZE;
+  size_t seg_count = segs_lump->data.len / D2K_VANILLA_SEG_SIZE;
+  size_t vertex_count = map_loader->map->vertexes.len;
 
-  if ((segs_lump->data.len % VANILLA_SEG_SIZE) != 0) {
+  if ((segs_lump->data.len % D2K_VANILLA_SEG_SIZE) != 0) {
     return malformed_segs_lump(status);
   }
 
@@ -99,7 +151,7 @@ bool d2k_map_loader_load_segs(D2KMapLoader *map_loader, Status *status) {
 
   for (size_t i = 0; i < seg_count; i++) {
     D2KSeg *seg = array_append_fast(&map_loader->map->segs);
-    char seg_data[VANILLA_SEG_SIZE];
+    char seg_data[D2K_VANILLA_SEG_SIZE];
     size_t start_vertex_index;
     size_t end_vertex_index;
     D2KAngle angle;
@@ -108,36 +160,24 @@ bool d2k_map_loader_load_segs(D2KMapLoader *map_loader, Status *status) {
     D2KFixedPoint offset;
     D2KSidedef *other_sidedef = NULL;
 
-    slice_read_fast(&segs_lump->data, i * VANILLA_SEG_SIZE, VANILLA_SEG_SIZE,
-                                                            (void *)seg_data);
+    slice_read_fast(&segs_lump->data, i * D2K_VANILLA_SEG_SIZE,
+                                      D2K_VANILLA_SEG_SIZE,
+                                      (void *)seg_data);
     start_vertex_index = LUMP_DATA_SHORT_TO_INDEX(seg_data,  0);
     end_vertex_index   = LUMP_DATA_SHORT_TO_INDEX(seg_data,  2);
     angle              = LUMP_DATA_SHORT_TO_ANGLE(seg_data,  4);
     linedef_index      = LUMP_DATA_SHORT_TO_INDEX(seg_data,  6);
     side               = LUMP_DATA_SHORT_TO_SHORT(seg_data,  8);
-    offset             = LUMP_DATA_SHORT_TO_SHORT(seg_data, 10);
-
-#if 0
-    /* This is the code PrBoom+ uses to fix out-of-range vertex indices */
-    if ((start_vertex_index >= map_loader->map->vertexes.len) ||
-        (end_vertex_index >= map_loader->map->vertexes.len)) {
-      if (seg->sidedef == &seg->linedef->front_side) {
-        seg->v1 = seg->linedef->v1;
-        seg->v2 = seg->linedef->v2;
-      }
-      else {
-        seg->v1 = seg->linedef->v2;
-        seg->v2 = seg->linedef->v1;
-      }
-    }
-#endif
+    offset             = LUMP_DATA_SHORT_TO_FIXED(seg_data, 10);
 
-    if (start_vertex_index >= map_loader->map->vertexes.len) {
-      return invalid_seg_start_vertex_index(status);
-    }
+    if (!map_loader->repairs) {
+      if (start_vertex_index >= vertex_count) {
+        return invalid_seg_start_vertex_index(status);
+      }
 
-    if (end_vertex_index >= map_loader->map->vertexes.len) {
-      return invalid_seg_end_vertex_index(status);
+      if (end_vertex_index >= vertex_count) {
+        return invalid_seg_end_vertex_index(status);
+      }
     }
 
     if (linedef_index >= map_loader->map->linedefs.len) {
@@ -148,10 +188,24 @@ bool d2k_map_loader_load_segs(D2KMapLoader *map_loader, Status *status) {
       return invalid_seg_line_side(status);
     }
 
-    seg->v1 = array_index_fast(&map_loader->map->vertexes, start_vertex_index);
-    seg->v2 = array_index_fast(&map_loader->map->vertexes, end_vertex_index);
     seg->linedef = array_index_fast(&map_loader->map->linedefs, linedef_index);
 
+    if ((start_vertex_index >= vertex_count) ||
+        (end_vertex_index >= vertex_count)) {
+      if (!repair_seg_vertexes(map_loader, seg, i, start_vertex_index,
+                                                   end_vertex_index,
+                                                   side,
+                                                   status)) {
+        return false;
+      }
+    }
+    else {
+      seg->v1 = array_index_fast(&map_loader->map->vertexes,
+                                 start_vertex_index);
+      seg->v2 = array_index_fast(&map_loader->map->vertexes,
+                                 end_vertex_index);
+    }
+
     if (side == 0) {
       seg->sidedef = seg->linedef->front_side;
       other_sidedef = seg->linedef->back_side;
@@ -178,13 +232,24 @@ bool d2k_map_loader_load_segs(D2KMapLoader *map_loader, Status *status) {
       if (other_sidedef) {
         seg->back_sector = other_sidedef->sector;
       }
+      else if (map_loader->repairs) {
+        /* PrBoom+ does this to emulate vanilla behavior */
+        if (!d2k_map_get_null_sector(map_loader->map, &seg->back_sector,
+                                                      status)) {
+          return false;
+        }
+
+        if (!d2k_map_problem_add(
+              map_loader->repairs,
+              D2K_MAP_PROBLEM_TWO_SIDED_SEG_MISSING_OTHER_SIDE,
+              D2K_MAP_LUMP_SEGS,
+              i,
+              NULL,
+              status)) {
+          return false;
+        }
+      }
       else {
-        /*
-         * PrBoom+ does this to emulate vanilla behavior
-         * 
-         * seg->back_sector = GetSectorAtNullAddress();
-         *
-         */
         return two_sided_seg_missing_other_side(status);
       }
     }
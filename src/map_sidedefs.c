@@ -23,7 +23,6 @@
 #include "d2k/internal.h"
 #include "d2k/map_loader.h"
 #include "d2k/map_sidedefs.h"
-#include "d2k/texture.h"
 #include "d2k/wad.h"
 
 #define malformed_sidedefs_lump(status) status_error( \
@@ -40,13 +39,11 @@
   "invalid sidedef index"                                  \
 )
 
-#define SIDEDEF_SIZE 30
-
 bool d2k_map_loader_load_sidedefs(D2KMapLoader *map_loader, Status *status) {
   D2KLump *sidedefs_lump = map_loader->map_lumps[D2K_MAP_LUMP_SIDEDEFS];
-  size_t sidedef_count = sidedefs_lump->data.len / SIDEDEF_SIZE;
+  size_t sidedef_count = sidedefs_lump->data.len / D2K_VANILLA_SIDEDEF_SIZE;
 
-  if ((sidedefs_lump->data.len % SIDEDEF_SIZE) != 0) {
+  if ((sidedefs_lump->data.len % D2K_VANILLA_SIDEDEF_SIZE) != 0) {
     return malformed_sidedefs_lump(status);
   }
 
@@ -57,22 +54,15 @@ bool d2k_map_loader_load_sidedefs(D2KMapLoader *map_loader, Status *status) {
 
   for (size_t i = 0; i < sidedef_count; i++) {
     D2KSidedef *sidedef = array_append_fast(&map_loader->map->sidedefs);
-    D2KTexture *texture = NULL;
-    char top_texture[9];
-    char bottom_texture[9];
-    char mid_texture[9];
-    char sidedef_data[SIDEDEF_SIZE];
+    char sidedef_data[D2K_VANILLA_SIDEDEF_SIZE];
     size_t sector_index;
 
-    slice_read_fast(&sidedefs_lump->data, i * SIDEDEF_SIZE,
-                                          SIDEDEF_SIZE,
+    slice_read_fast(&sidedefs_lump->data, i * D2K_VANILLA_SIDEDEF_SIZE,
+                                          D2K_VANILLA_SIDEDEF_SIZE,
                                           (void *)sidedef_data);
 
     sidedef->texture_offset = LUMP_DATA_SHORT_TO_FIXED(sidedef_data, 0);
     sidedef->row_offset = LUMP_DATA_SHORT_TO_FIXED(sidedef_data, 2);
-    cbmemmove((void *)top_texture, (void *)&sidedef_data[4], 8);
-    cbmemmove((void *)bottom_texture, (void *)&sidedef_data[12], 8);
-    cbmemmove((void *)mid_texture, (void *)&sidedef_data[20], 8);
     sector_index = LUMP_DATA_SHORT_TO_INDEX(sidedef_data, 28);
 
     if (sector_index >= map_loader->map->sectors.len) {
@@ -84,32 +74,23 @@ bool d2k_map_loader_load_sidedefs(D2KMapLoader *map_loader, Status *status) {
       sector_index
     );
 
-    if (!d2k_lump_directory_lookup_texture(map_loader->lump_directory,
-                                           top_texture,
-                                           &texture,
-                                           status)) {
+    if (!d2k_map_loader_lookup_texture(map_loader, &sidedef_data[4],
+                                                   &sidedef->top_texture,
+                                                   status)) {
       return false;
     }
 
-    sidedef->top_texture = texture->index;
-
-    if (!d2k_lump_directory_lookup_texture(map_loader->lump_directory,
-                                           bottom_texture,
-                                           &texture,
-                                           status)) {
+    if (!d2k_map_loader_lookup_texture(map_loader, &sidedef_data[12],
+                                                   &sidedef->bottom_texture,
+                                                   status)) {
       return false;
     }
 
-    sidedef->bottom_texture = texture->index;
-
-    if (!d2k_lump_directory_lookup_texture(map_loader->lump_directory,
-                                           mid_texture,
-                                           &texture,
-                                           status)) {
+    if (!d2k_map_loader_lookup_texture(map_loader, &sidedef_data[20],
+                                                   &sidedef->mid_texture,
+                                                   status)) {
       return false;
     }
-
-    sidedef->mid_texture = texture->index;
   }
 
   return status_ok(status);
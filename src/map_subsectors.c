@@ -21,8 +21,12 @@
 /*****************************************************************************/
 
 #include "d2k/internal.h"
+#include "d2k/fixed_vertex.h"
 #include "d2k/map.h"
 #include "d2k/map_loader.h"
+#include "d2k/map_linedefs.h"
+#include "d2k/map_segs.h"
+#include "d2k/map_sidedefs.h"
 #include "d2k/map_subsectors.h"
 #include "d2k/wad.h"
 
@@ -40,14 +44,34 @@
   "out of range seg list"                                     \
 )
 
-#define VANILLA_SUBSECTOR_SIZE  4
+#define subsector_has_no_sector(status) status_error( \
+  status,                                             \
+  "d2k_map_subsectors",                               \
+  D2K_MAP_SUBSECTORS_NO_SECTOR,                       \
+  "subsector's first seg has no sidedef"              \
+)
+
+/*
+ * The geometry is the whole linedef's, not the seg's: sight checks each
+ * linedef once however many segs it was split into, as P_CrossSubsector does,
+ * so the test has to cover all of it.
+ */
+static void init_ssline(D2KSegLine *ssline, D2KSeg *seg) {
+  ssline->seg = seg;
+  ssline->linedef = seg->linedef;
+  ssline->x1 = seg->linedef->v1->x;
+  ssline->y1 = seg->linedef->v1->y;
+  ssline->x2 = seg->linedef->v2->x;
+  ssline->y2 = seg->linedef->v2->y;
+}
 
 bool d2k_map_loader_load_subsectors(D2KMapLoader *map_loader, Status *status) {
   D2KLump *subsectors_lump =
     map_loader->map_lumps[D2K_VANILLA_MAP_LUMP_SSECTORS];
-  size_t subsector_count = subsectors_lump->data.len / VANILLA_SUBSECTOR_SIZE;
+  size_t subsector_count = subsectors_lump->data.len /
+                           D2K_VANILLA_SUBSECTOR_SIZE;
 
-  if ((subsectors_lump->data.len % VANILLA_SUBSECTOR_SIZE) != 0) {
+  if ((subsectors_lump->data.len % D2K_VANILLA_SUBSECTOR_SIZE) != 0) {
     return malformed_subsectors_lump(status);
   }
 
@@ -58,12 +82,12 @@ bool d2k_map_loader_load_subsectors(D2KMapLoader *map_loader, Status *status) {
 
   for (size_t i = 0; i < subsector_count; i++) {
     D2KSubsector *subsector = array_append_fast(&map_loader->map->subsectors);
-    char subsector_data[VANILLA_SUBSECTOR_SIZE];
+    char subsector_data[D2K_VANILLA_SUBSECTOR_SIZE];
     size_t seg_count;
     size_t first_seg;
 
-    slice_read_fast(&subsectors_lump->data, i * VANILLA_SUBSECTOR_SIZE,
-                                            VANILLA_SUBSECTOR_SIZE,
+    slice_read_fast(&subsectors_lump->data, i * D2K_VANILLA_SUBSECTOR_SIZE,
+                                            D2K_VANILLA_SUBSECTOR_SIZE,
                                             (void *)subsector_data);
 
 
@@ -81,4 +105,51 @@ bool d2k_map_loader_load_subsectors(D2KMapLoader *map_loader, Status *status) {
   return status_ok(status);
 }
 
+bool d2k_map_loader_link_subsectors(D2KMapLoader *map_loader, Status *status) {
+  D2KMap *map = map_loader->map;
+
+  array_clear(&map->sslines);
+
+  /* Mini segs have no linedef, so this is an upper bound */
+  if (!array_ensure_capacity(&map->sslines, map->segs.len, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < map->subsectors.len; i++) {
+    D2KSubsector *subsector = array_index_fast(&map->subsectors, i);
+
+    subsector->sector = NULL;
+
+    /* With GL nodes the first seg can be a mini seg, so find a real one */
+    for (size_t j = 0; j < subsector->seg_count; j++) {
+      D2KSeg *seg = array_index_fast(&map->segs, subsector->first_seg + j);
+
+      if (seg->sidedef) {
+        subsector->sector = seg->sidedef->sector;
+        break;
+      }
+    }
+
+    if (!subsector->sector) {
+      return subsector_has_no_sector(status);
+    }
+
+    subsector->first_ssline = map->sslines.len;
+    subsector->ssline_count = 0;
+
+    for (size_t j = 0; j < subsector->seg_count; j++) {
+      D2KSeg *seg = array_index_fast(&map->segs, subsector->first_seg + j);
+
+      if (seg->mini_seg || !seg->linedef) {
+        continue;
+      }
+
+      init_ssline(array_append_fast(&map->sslines), seg);
+      subsector->ssline_count++;
+    }
+  }
+
+  return status_ok(status);
+}
+
 /* vi: set et ts=2 sw=2: */
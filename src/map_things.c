@@ -0,0 +1,355 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/map.h"
+#include "d2k/map_loader.h"
+#include "d2k/map_things.h"
+#include "d2k/wad.h"
+
+#define malformed_things_lump(status) status_error( \
+  status,                                           \
+  "d2k_map_things",                                 \
+  D2K_MAP_THINGS_MALFORMED_LUMP,                    \
+  "malformed THINGS lump"                           \
+)
+
+#define too_many_types(status) status_error( \
+  status,                                    \
+  "d2k_map_things",                          \
+  D2K_MAP_THINGS_TOO_MANY_TYPES,             \
+  "too many map object types"                \
+)
+
+#define too_many_things(status) status_error( \
+  status,                                     \
+  "d2k_map_things",                           \
+  D2K_MAP_THINGS_TOO_MANY_THINGS,             \
+  "too many things"                           \
+)
+
+bool d2k_map_loader_load_things(D2KMapLoader *map_loader, Status *status) {
+  D2KLump *things_lump = map_loader->map_lumps[D2K_MAP_LUMP_THINGS];
+  size_t thing_count = things_lump->data.len / D2K_VANILLA_THING_SIZE;
+
+  if ((things_lump->data.len % D2K_VANILLA_THING_SIZE) != 0) {
+    return malformed_things_lump(status);
+  }
+
+  if (!array_ensure_capacity(&map_loader->map->things, thing_count, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < thing_count; i++) {
+    D2KMapThing *thing = array_append_fast(&map_loader->map->things);
+    char thing_data[D2K_VANILLA_THING_SIZE];
+
+    slice_read_fast(&things_lump->data, i * D2K_VANILLA_THING_SIZE,
+                                        D2K_VANILLA_THING_SIZE,
+                                        (void *)thing_data);
+
+    thing->x       = d2k_lump_data_int16(thing_data, 0);
+    thing->y       = d2k_lump_data_int16(thing_data, 2);
+    thing->angle   = d2k_lump_data_int16(thing_data, 4);
+    thing->type    = d2k_lump_data_int16(thing_data, 6);
+    thing->options = d2k_lump_data_int16(thing_data, 8);
+
+    if (thing->options & D2K_MAP_THING_OPTION_RESERVED) {
+      thing->options &= D2K_MAP_THING_VANILLA_OPTIONS;
+    }
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_map_thing_types_init(D2KMapThingTypes *types,
+                              const D2KMapObjectInfo *infos,
+                              size_t info_count,
+                              Status *status) {
+  size_t max_doomednum = 0;
+
+  array_init(&types->types, sizeof(uint16_t));
+  types->type_count = info_count;
+
+  if (info_count >= D2K_MAP_THING_NO_TYPE) {
+    return too_many_types(status);
+  }
+
+  for (size_t i = 0; i < info_count; i++) {
+    int doomednum = infos[i].doomednum;
+
+    if (doomednum > 0 && doomednum <= INT16_MAX &&
+        (size_t)doomednum > max_doomednum) {
+      max_doomednum = (size_t)doomednum;
+    }
+  }
+
+  if (!array_set_size(&types->types, max_doomednum + 1, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i <= max_doomednum; i++) {
+    uint16_t *type = array_index_fast(&types->types, i);
+
+    *type = D2K_MAP_THING_NO_TYPE;
+  }
+
+  for (size_t i = 0; i < info_count; i++) {
+    int doomednum = infos[i].doomednum;
+    uint16_t *type;
+
+    if (doomednum <= 0 || doomednum > INT16_MAX) {
+      continue;
+    }
+
+    type = array_index_fast(&types->types, (size_t)doomednum);
+
+    if (*type == D2K_MAP_THING_NO_TYPE) {
+      *type = (uint16_t)i;
+    }
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_thing_types_free(D2KMapThingTypes *types) {
+  array_free(&types->types);
+  types->type_count = 0;
+}
+
+static void thing_table_clear(D2KMapThingTable *table) {
+  array_clear(&table->types);
+  array_clear(&table->classes);
+  array_clear(&table->type_indexes);
+  array_clear(&table->type_starts);
+
+  for (size_t i = 0; i < D2K_MAP_THING_CLASS_COUNT; i++) {
+    table->class_counts[i] = 0;
+  }
+}
+
+static bool resolve_things(D2KMapThingTable *table, D2KMapThingTypes *types,
+                                                    Status *status) {
+  Array *things = &table->map->things;
+
+  if (!array_set_size(&table->types, things->len, status)) {
+    return false;
+  }
+
+  if (!array_set_size(&table->classes, things->len, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < things->len; i++) {
+    D2KMapThing *thing = array_index_fast(things, i);
+    uint16_t *type = array_index_fast(&table->types, i);
+    uint8_t *thing_class = array_index_fast(&table->classes, i);
+
+    *type = d2k_map_thing_types_lookup(types, thing->type);
+
+    /* Starts are recorded regardless of skill and mode */
+    if ((thing->type >= 1 && thing->type <= 4) ||
+        thing->type == D2K_MAP_THING_DEATHMATCH_START) {
+      *thing_class = D2K_MAP_THING_OPTION_EASY   |
+                     D2K_MAP_THING_OPTION_NORMAL |
+                     D2K_MAP_THING_OPTION_HARD;
+    }
+    else {
+      *thing_class = d2k_map_thing_class(thing->options);
+    }
+
+    table->class_counts[*thing_class]++;
+  }
+
+  return status_ok(status);
+}
+
+/* A counting sort, so each bucket keeps its things in lump order */
+static bool bucket_things(D2KMapThingTable *table, Status *status) {
+  size_t bucket_count = table->type_count + 1;
+  size_t thing_count = table->map->things.len;
+
+  if (!array_set_size(&table->type_starts, bucket_count + 1, status)) {
+    return false;
+  }
+
+  if (!array_set_size(&table->type_indexes, thing_count, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i <= bucket_count; i++) {
+    size_t *start = array_index_fast(&table->type_starts, i);
+
+    *start = 0;
+  }
+
+  for (size_t i = 0; i < thing_count; i++) {
+    uint16_t *type = array_index_fast(&table->types, i);
+    size_t bucket = *type == D2K_MAP_THING_NO_TYPE ? table->type_count :
+                                                     *type;
+    size_t *start = array_index_fast(&table->type_starts, bucket + 1);
+
+    (*start)++;
+  }
+
+  for (size_t i = 1; i <= bucket_count; i++) {
+    size_t *previous = array_index_fast(&table->type_starts, i - 1);
+    size_t *start = array_index_fast(&table->type_starts, i);
+
+    *start += *previous;
+  }
+
+  /* Fill each bucket by advancing its start, then shift the starts back */
+  for (size_t i = 0; i < thing_count; i++) {
+    uint16_t *type = array_index_fast(&table->types, i);
+    size_t bucket = *type == D2K_MAP_THING_NO_TYPE ? table->type_count :
+                                                     *type;
+    size_t *start = array_index_fast(&table->type_starts, bucket);
+    uint32_t *index = array_index_fast(&table->type_indexes, *start);
+
+    *index = (uint32_t)i;
+    (*start)++;
+  }
+
+  for (size_t i = bucket_count; i > 0; i--) {
+    size_t *previous = array_index_fast(&table->type_starts, i - 1);
+    size_t *start = array_index_fast(&table->type_starts, i);
+
+    *start = *previous;
+  }
+
+  *(size_t *)array_index_fast(&table->type_starts, 0) = 0;
+
+  return status_ok(status);
+}
+
+bool d2k_map_thing_table_init(D2KMapThingTable *table,
+                              D2KMap *map,
+                              D2KMapThingTypes *types,
+                              Status *status) {
+  table->map = map;
+  table->type_count = types->type_count;
+  array_init(&table->types, sizeof(uint16_t));
+  array_init(&table->classes, sizeof(uint8_t));
+  array_init(&table->type_indexes, sizeof(uint32_t));
+  array_init(&table->type_starts, sizeof(size_t));
+  thing_table_clear(table);
+
+  if (map->things.len > UINT32_MAX) {
+    return too_many_things(status);
+  }
+
+  if (!(resolve_things(table, types, status) &&
+        bucket_things(table, status))) {
+    d2k_map_thing_table_free(table);
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_map_thing_table_free(D2KMapThingTable *table) {
+  thing_table_clear(table);
+  array_free(&table->types);
+  array_free(&table->classes);
+  array_free(&table->type_indexes);
+  array_free(&table->type_starts);
+  table->map = NULL;
+  table->type_count = 0;
+}
+
+uint64_t d2k_map_thing_spawn_mask(int skill, D2KMapThingPlayMode play_mode) {
+  uint64_t mask = 0;
+  int skill_bit;
+  int excluded_bit;
+
+  if (skill <= 1) {
+    skill_bit = D2K_MAP_THING_OPTION_EASY;
+  }
+  else if (skill == 2) {
+    skill_bit = D2K_MAP_THING_OPTION_NORMAL;
+  }
+  else {
+    skill_bit = D2K_MAP_THING_OPTION_HARD;
+  }
+
+  switch (play_mode) {
+    case D2K_MAP_THING_PLAY_MODE_COOPERATIVE:
+      excluded_bit = D2K_MAP_THING_OPTION_NOT_COOP;
+      break;
+    case D2K_MAP_THING_PLAY_MODE_DEATHMATCH:
+      excluded_bit = D2K_MAP_THING_OPTION_NOT_DEATHMATCH;
+      break;
+    default:
+      excluded_bit = D2K_MAP_THING_OPTION_NOT_SINGLE;
+      break;
+  }
+
+  excluded_bit = d2k_map_thing_class(excluded_bit);
+
+  for (int thing_class = 0; thing_class < D2K_MAP_THING_CLASS_COUNT;
+                            thing_class++) {
+    if ((thing_class & skill_bit) && !(thing_class & excluded_bit)) {
+      mask |= UINT64_C(1) << thing_class;
+    }
+  }
+
+  return mask;
+}
+
+size_t d2k_map_thing_table_spawn_count(D2KMapThingTable *table,
+                                       uint64_t mask) {
+  size_t count = 0;
+
+  for (size_t i = 0; i < D2K_MAP_THING_CLASS_COUNT; i++) {
+    if (mask & (UINT64_C(1) << i)) {
+      count += table->class_counts[i];
+    }
+  }
+
+  return count;
+}
+
+bool d2k_map_thing_table_spawn(D2KMapThingTable *table,
+                               uint64_t mask,
+                               D2KMapThingVisitor visitor,
+                               void *data) {
+  for (size_t i = 0; i < table->classes.len; i++) {
+    uint8_t *thing_class = array_index_fast(&table->classes, i);
+    uint16_t *type;
+
+    if (!(mask & (UINT64_C(1) << *thing_class))) {
+      continue;
+    }
+
+    type = array_index_fast(&table->types, i);
+
+    if (!visitor(array_index_fast(&table->map->things, i), *type, data)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,1520 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include <ctype.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "d2k/fixed_math.h"
+#include "d2k/fixed_vertex.h"
+#include "d2k/map.h"
+#include "d2k/map_blockmap.h"
+#include "d2k/map_linedefs.h"
+#include "d2k/map_loader.h"
+#include "d2k/map_sectors.h"
+#include "d2k/map_sidedefs.h"
+#include "d2k/map_things.h"
+#include "d2k/map_udmf.h"
+#include "d2k/wad.h"
+
+#define syntax_error(status) status_error( \
+  status,                                  \
+  "d2k_map_udmf",                          \
+  D2K_MAP_UDMF_SYNTAX_ERROR,               \
+  "UDMF syntax error"                      \
+)
+
+#define unterminated_string(status) status_error( \
+  status,                                         \
+  "d2k_map_udmf",                                 \
+  D2K_MAP_UDMF_UNTERMINATED_STRING,               \
+  "unterminated string in UDMF"                   \
+)
+
+#define unterminated_comment(status) status_error( \
+  status,                                          \
+  "d2k_map_udmf",                                  \
+  D2K_MAP_UDMF_UNTERMINATED_COMMENT,               \
+  "unterminated comment in UDMF"                   \
+)
+
+#define invalid_value(status) status_error( \
+  status,                                   \
+  "d2k_map_udmf",                           \
+  D2K_MAP_UDMF_INVALID_VALUE,               \
+  "invalid UDMF field value"                \
+)
+
+#define missing_field(status) status_error( \
+  status,                                   \
+  "d2k_map_udmf",                           \
+  D2K_MAP_UDMF_MISSING_FIELD,               \
+  "UDMF block missing a required field"     \
+)
+
+#define invalid_vertex_index(status) status_error( \
+  status,                                          \
+  "d2k_map_udmf",                                  \
+  D2K_MAP_UDMF_INVALID_VERTEX_INDEX,               \
+  "invalid UDMF linedef vertex index"              \
+)
+
+#define invalid_sidedef_index(status) status_error( \
+  status,                                           \
+  "d2k_map_udmf",                                   \
+  D2K_MAP_UDMF_INVALID_SIDEDEF_INDEX,               \
+  "invalid UDMF linedef sidedef index"              \
+)
+
+#define invalid_sector_index(status) status_error( \
+  status,                                          \
+  "d2k_map_udmf",                                  \
+  D2K_MAP_UDMF_INVALID_SECTOR_INDEX,               \
+  "invalid UDMF sidedef sector index"              \
+)
+
+#define unsupported_namespace(status) status_error( \
+  status,                                           \
+  "d2k_map_udmf",                                   \
+  D2K_MAP_UDMF_UNSUPPORTED_NAMESPACE,               \
+  "unsupported UDMF namespace"                      \
+)
+
+#define KEY_BIT(key) (UINT64_C(1) << (key))
+
+/* Sorted, and in D2KUDMFKey order (offset by D2K_UDMF_KEY_UNKNOWN) */
+static const char *key_names[D2K_UDMF_KEY_MAX - 1] = {
+  "ambush",
+  "angle",
+  "blocking",
+  "blockmonsters",
+  "blocksound",
+  "coop",
+  "dm",
+  "dontdraw",
+  "dontpegbottom",
+  "dontpegtop",
+  "friend",
+  "heightceiling",
+  "heightfloor",
+  "id",
+  "lightlevel",
+  "linedef",
+  "mapped",
+  "namespace",
+  "offsetx",
+  "offsety",
+  "passuse",
+  "secret",
+  "sector",
+  "sideback",
+  "sidedef",
+  "sidefront",
+  "single",
+  "skill1",
+  "skill2",
+  "skill3",
+  "skill4",
+  "skill5",
+  "special",
+  "texturebottom",
+  "textureceiling",
+  "texturefloor",
+  "texturemiddle",
+  "texturetop",
+  "thing",
+  "twosided",
+  "type",
+  "v1",
+  "v2",
+  "vertex",
+  "x",
+  "y",
+};
+
+typedef struct {
+  D2KUDMFKey kind;
+  uint64_t   seen;
+  bool       skills[5];
+  bool       single;
+  bool       coop;
+  bool       deathmatch;
+  union {
+    D2KMapThing    thing;
+    D2KFixedVertex vertex;
+    D2KUDMFLinedef linedef;
+    D2KUDMFSidedef sidedef;
+    D2KUDMFSector  sector;
+  } record;
+} Block;
+
+static inline bool is_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' ||
+         c == '\v';
+}
+
+static inline bool is_digit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+static inline bool is_identifier_start(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static inline bool is_identifier_char(char c) {
+  return is_identifier_start(c) || is_digit(c);
+}
+
+static inline char to_lower(char c) {
+  return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+static inline char to_upper(char c) {
+  return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+}
+
+/* Compares `len` bytes of `name`, folding case, against a lowercase key */
+static int compare_key(const char *name, size_t len, const char *key) {
+  for (size_t i = 0; i < len; i++) {
+    char c = to_lower(name[i]);
+
+    if (!key[i] || c > key[i]) {
+      return 1;
+    }
+
+    if (c < key[i]) {
+      return -1;
+    }
+  }
+
+  return key[len] ? -1 : 0;
+}
+
+D2KUDMFKey d2k_udmf_key(const char *name, size_t len) {
+  size_t low = 0;
+  size_t high = D2K_UDMF_KEY_MAX - 1;
+
+  while (low < high) {
+    size_t middle = low + ((high - low) / 2);
+    int comparison = compare_key(name, len, key_names[middle]);
+
+    if (comparison == 0) {
+      return (D2KUDMFKey)(middle + 1);
+    }
+
+    if (comparison < 0) {
+      high = middle;
+    }
+    else {
+      low = middle + 1;
+    }
+  }
+
+  return D2K_UDMF_KEY_UNKNOWN;
+}
+
+void d2k_udmf_lexer_init(D2KUDMFLexer *lexer, const char *data, size_t len) {
+  lexer->data = data;
+  lexer->len = len;
+  lexer->offset = 0;
+}
+
+static bool skip_space_and_comments(D2KUDMFLexer *lexer, Status *status) {
+  const char *data = lexer->data;
+  size_t len = lexer->len;
+  size_t i = lexer->offset;
+
+  while (i < len) {
+    if (is_space(data[i])) {
+      i++;
+    }
+    else if (data[i] == '/' && i + 1 < len && data[i + 1] == '/') {
+      while (i < len && data[i] != '\n') {
+        i++;
+      }
+    }
+    else if (data[i] == '/' && i + 1 < len && data[i + 1] == '*') {
+      i += 2;
+
+      while (i + 1 < len && !(data[i] == '*' && data[i + 1] == '/')) {
+        i++;
+      }
+
+      if (i + 1 >= len) {
+        lexer->offset = len;
+        return unterminated_comment(status);
+      }
+
+      i += 2;
+    }
+    else {
+      break;
+    }
+  }
+
+  lexer->offset = i;
+
+  return status_ok(status);
+}
+
+static bool lex_string(D2KUDMFLexer *lexer, D2KUDMFToken *token,
+                                            Status *status) {
+  const char *data = lexer->data;
+  size_t start = lexer->offset + 1;
+  size_t i = start;
+
+  while (i < lexer->len && data[i] != '"') {
+    if (data[i] == '\\') {
+      i++;
+    }
+
+    i++;
+  }
+
+  if (i >= lexer->len) {
+    lexer->offset = lexer->len;
+    return unterminated_string(status);
+  }
+
+  token->type = D2K_UDMF_TOKEN_STRING;
+  token->text = data + start;
+  token->len = i - start;
+  lexer->offset = i + 1;
+
+  return status_ok(status);
+}
+
+/*
+ * Takes the longest run that could be part of a number and leaves checking
+ * it to whoever reads the value, so unused fields are never converted.
+ */
+static void lex_number(D2KUDMFLexer *lexer, D2KUDMFToken *token) {
+  const char *data = lexer->data;
+  size_t start = lexer->offset;
+  size_t i = start;
+  bool hex = false;
+
+  token->type = D2K_UDMF_TOKEN_INTEGER;
+
+  if (data[i] == '+' || data[i] == '-') {
+    i++;
+  }
+
+  if (i + 1 < lexer->len && data[i] == '0' &&
+      (data[i + 1] == 'x' || data[i + 1] == 'X')) {
+    hex = true;
+    i += 2;
+  }
+
+  while (i < lexer->len) {
+    char c = data[i];
+
+    if (c == '.') {
+      token->type = D2K_UDMF_TOKEN_FLOAT;
+    }
+    else if (!hex && (c == 'e' || c == 'E')) {
+      token->type = D2K_UDMF_TOKEN_FLOAT;
+
+      if (i + 1 < lexer->len && (data[i + 1] == '+' || data[i + 1] == '-')) {
+        i++;
+      }
+    }
+    else if (!is_identifier_char(c)) {
+      break;
+    }
+
+    i++;
+  }
+
+  token->text = data + start;
+  token->len = i - start;
+  lexer->offset = i;
+}
+
+bool d2k_udmf_lexer_next(D2KUDMFLexer *lexer, D2KUDMFToken *token,
+                                              Status *status) {
+  char c;
+
+  if (!skip_space_and_comments(lexer, status)) {
+    return false;
+  }
+
+  token->key = D2K_UDMF_KEY_UNKNOWN;
+
+  if (lexer->offset >= lexer->len) {
+    token->type = D2K_UDMF_TOKEN_END;
+    token->text = lexer->data + lexer->len;
+    token->len = 0;
+
+    return status_ok(status);
+  }
+
+  c = lexer->data[lexer->offset];
+  token->text = lexer->data + lexer->offset;
+  token->len = 1;
+
+  switch (c) {
+    case '{':
+      token->type = D2K_UDMF_TOKEN_OPEN_BRACE;
+      lexer->offset++;
+      return status_ok(status);
+    case '}':
+      token->type = D2K_UDMF_TOKEN_CLOSE_BRACE;
+      lexer->offset++;
+      return status_ok(status);
+    case '=':
+      token->type = D2K_UDMF_TOKEN_EQUALS;
+      lexer->offset++;
+      return status_ok(status);
+    case ';':
+      token->type = D2K_UDMF_TOKEN_SEMICOLON;
+      lexer->offset++;
+      return status_ok(status);
+    case '"':
+      return lex_string(lexer, token, status);
+    default:
+      break;
+  }
+
+  if (is_identifier_start(c)) {
+    size_t i = lexer->offset + 1;
+
+    while (i < lexer->len && is_identifier_char(lexer->data[i])) {
+      i++;
+    }
+
+    token->type = D2K_UDMF_TOKEN_IDENTIFIER;
+    token->len = i - lexer->offset;
+    token->key = d2k_udmf_key(token->text, token->len);
+    lexer->offset = i;
+
+    return status_ok(status);
+  }
+
+  if (is_digit(c) || c == '+' || c == '-' || c == '.') {
+    lex_number(lexer, token);
+
+    return status_ok(status);
+  }
+
+  return syntax_error(status);
+}
+
+/* Decimal, hex (0x) or octal (leading 0) integers, as the spec allows */
+static bool read_int(D2KUDMFToken *token, int32_t *value, Status *status) {
+  const char *text = token->text;
+  size_t len = token->len;
+  size_t i = 0;
+  bool negative = false;
+  unsigned base = 10;
+  int64_t result = 0;
+
+  if (token->type != D2K_UDMF_TOKEN_INTEGER) {
+    return invalid_value(status);
+  }
+
+  if (text[i] == '+' || text[i] == '-') {
+    negative = text[i] == '-';
+    i++;
+  }
+
+  if (i + 1 < len && text[i] == '0' && (text[i + 1] == 'x' ||
+                                        text[i + 1] == 'X')) {
+    base = 16;
+    i += 2;
+  }
+  else if (i + 1 < len && text[i] == '0') {
+    base = 8;
+    i++;
+  }
+
+  if (i >= len) {
+    return invalid_value(status);
+  }
+
+  for (; i < len; i++) {
+    char c = to_lower(text[i]);
+    unsigned digit;
+
+    if (is_digit(c)) {
+      digit = (unsigned)(c - '0');
+    }
+    else if (c >= 'a' && c <= 'f') {
+      digit = (unsigned)(c - 'a' + 10);
+    }
+    else {
+      return invalid_value(status);
+    }
+
+    if (digit >= base) {
+      return invalid_value(status);
+    }
+
+    result = (result * base) + digit;
+
+    if (result > (int64_t)INT32_MAX + 1) {
+      return invalid_value(status);
+    }
+  }
+
+  if (negative) {
+    result = -result;
+  }
+
+  if (result > INT32_MAX) {
+    return invalid_value(status);
+  }
+
+  *value = (int32_t)result;
+
+  return status_ok(status);
+}
+
+static bool read_int16(D2KUDMFToken *token, int16_t *value, Status *status) {
+  int32_t result;
+
+  if (!read_int(token, &result, status)) {
+    return false;
+  }
+
+  if (result < INT16_MIN || result > INT16_MAX) {
+    return invalid_value(status);
+  }
+
+  *value = (int16_t)result;
+
+  return status_ok(status);
+}
+
+/*
+ * Reads an integer or float (digits, a fraction, an exponent) as map units.
+ * Floats are only checked for characters that can appear in a decimal
+ * number, then left to strtod, which rounds correctly; callers range-check
+ * the result.
+ */
+static bool read_number(D2KUDMFToken *token, double *value, Status *status) {
+  char text[64];
+  char *end = NULL;
+
+  if (token->type == D2K_UDMF_TOKEN_INTEGER) {
+    int32_t integer;
+
+    if (!read_int(token, &integer, status)) {
+      return false;
+    }
+
+    *value = integer;
+
+    return status_ok(status);
+  }
+
+  if (token->type != D2K_UDMF_TOKEN_FLOAT || token->len >= sizeof(text)) {
+    return invalid_value(status);
+  }
+
+  /* strtod would also take hex floats, "inf" and "nan" */
+  for (size_t i = 0; i < token->len; i++) {
+    if (!strchr("0123456789+-.eE", token->text[i])) {
+      return invalid_value(status);
+    }
+  }
+
+  memcpy(text, token->text, token->len);
+  text[token->len] = '\0';
+  *value = strtod(text, &end);
+
+  if (end == text || *end) {
+    return invalid_value(status);
+  }
+
+  return status_ok(status);
+}
+
+static bool read_fixed(D2KUDMFToken *token, D2KFixedPoint *value,
+                                            Status *status) {
+  double result;
+
+  if (!read_number(token, &result, status)) {
+    return false;
+  }
+
+  if (!(result > -32768.0 && result < 32768.0)) {
+    return invalid_value(status);
+  }
+
+  *value = (D2KFixedPoint)(result * FRACUNIT);
+
+  return status_ok(status);
+}
+
+static bool read_map_short(D2KUDMFToken *token, int16_t *value,
+                                                Status *status) {
+  double result;
+
+  if (!read_number(token, &result, status)) {
+    return false;
+  }
+
+  if (!(result > INT16_MIN - 1.0 && result < INT16_MAX + 1.0)) {
+    return invalid_value(status);
+  }
+
+  *value = (int16_t)result;
+
+  return status_ok(status);
+}
+
+static bool read_bool(D2KUDMFToken *token, bool *value, Status *status) {
+  if (token->type == D2K_UDMF_TOKEN_IDENTIFIER) {
+    if (compare_key(token->text, token->len, "true") == 0) {
+      *value = true;
+      return status_ok(status);
+    }
+
+    if (compare_key(token->text, token->len, "false") == 0) {
+      *value = false;
+      return status_ok(status);
+    }
+  }
+
+  return invalid_value(status);
+}
+
+/* Texture and flat names, upper-cased and NUL-padded like binary lumps */
+static bool read_name(D2KUDMFToken *token, char name[8], Status *status) {
+  size_t name_len = 0;
+
+  if (token->type != D2K_UDMF_TOKEN_STRING) {
+    return invalid_value(status);
+  }
+
+  memset(name, 0, 8);
+
+  for (size_t i = 0; i < token->len; i++) {
+    char c = token->text[i];
+
+    if (c == '\\' && i + 1 < token->len) {
+      c = token->text[++i];
+    }
+
+    if (name_len == 8) {
+      return invalid_value(status);
+    }
+
+    name[name_len++] = to_upper(c);
+  }
+
+  return status_ok(status);
+}
+
+static bool set_flag(D2KUDMFToken *token, uint16_t *flags, uint16_t flag,
+                                                           Status *status) {
+  bool value;
+
+  if (!read_bool(token, &value, status)) {
+    return false;
+  }
+
+  if (value) {
+    *flags |= flag;
+  }
+  else {
+    *flags &= ~flag;
+  }
+
+  return status_ok(status);
+}
+
+static void init_block(Block *block, D2KUDMFKey kind) {
+  memset(block, 0, sizeof(Block));
+  block->kind = kind;
+
+  switch (kind) {
+    case D2K_UDMF_KEY_LINEDEF:
+      block->record.linedef.back_side = -1;
+      break;
+    case D2K_UDMF_KEY_SIDEDEF:
+      block->record.sidedef.top_texture[0] = '-';
+      block->record.sidedef.bottom_texture[0] = '-';
+      block->record.sidedef.mid_texture[0] = '-';
+      break;
+    case D2K_UDMF_KEY_SECTOR:
+      block->record.sector.light_level = 160;
+      break;
+    default:
+      break;
+  }
+}
+
+static bool read_thing_field(Block *block, D2KUDMFKey key,
+                                           D2KUDMFToken *value,
+                                           Status *status) {
+  D2KMapThing *thing = &block->record.thing;
+  bool ambush;
+  bool friendly;
+
+  switch (key) {
+    case D2K_UDMF_KEY_X:
+      return read_map_short(value, &thing->x, status);
+    case D2K_UDMF_KEY_Y:
+      return read_map_short(value, &thing->y, status);
+    case D2K_UDMF_KEY_ANGLE:
+      return read_int16(value, &thing->angle, status);
+    case D2K_UDMF_KEY_TYPE:
+      return read_int16(value, &thing->type, status);
+    case D2K_UDMF_KEY_SKILL1:
+    case D2K_UDMF_KEY_SKILL2:
+    case D2K_UDMF_KEY_SKILL3:
+    case D2K_UDMF_KEY_SKILL4:
+    case D2K_UDMF_KEY_SKILL5:
+      return read_bool(value, &block->skills[key - D2K_UDMF_KEY_SKILL1],
+                                                  status);
+    case D2K_UDMF_KEY_SINGLE:
+      return read_bool(value, &block->single, status);
+    case D2K_UDMF_KEY_COOP:
+      return read_bool(value, &block->coop, status);
+    case D2K_UDMF_KEY_DM:
+      return read_bool(value, &block->deathmatch, status);
+    case D2K_UDMF_KEY_AMBUSH:
+      if (!read_bool(value, &ambush, status)) {
+        return false;
+      }
+
+      thing->options = ambush ?
+        thing->options | D2K_MAP_THING_OPTION_AMBUSH :
+        thing->options & ~D2K_MAP_THING_OPTION_AMBUSH;
+
+      return status_ok(status);
+    case D2K_UDMF_KEY_FRIEND:
+      if (!read_bool(value, &friendly, status)) {
+        return false;
+      }
+
+      thing->options = friendly ?
+        thing->options | D2K_MAP_THING_OPTION_FRIEND :
+        thing->options & ~D2K_MAP_THING_OPTION_FRIEND;
+
+      return status_ok(status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool read_vertex_field(Block *block, D2KUDMFKey key,
+                                            D2KUDMFToken *value,
+                                            Status *status) {
+  switch (key) {
+    case D2K_UDMF_KEY_X:
+      return read_fixed(value, &block->record.vertex.x, status);
+    case D2K_UDMF_KEY_Y:
+      return read_fixed(value, &block->record.vertex.y, status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool read_linedef_field(Block *block, D2KUDMFKey key,
+                                             D2KUDMFToken *value,
+                                             Status *status) {
+  D2KUDMFLinedef *linedef = &block->record.linedef;
+
+  switch (key) {
+    case D2K_UDMF_KEY_V1:
+      return read_int(value, &linedef->v1, status);
+    case D2K_UDMF_KEY_V2:
+      return read_int(value, &linedef->v2, status);
+    case D2K_UDMF_KEY_SIDEFRONT:
+      return read_int(value, &linedef->front_side, status);
+    case D2K_UDMF_KEY_SIDEBACK:
+      return read_int(value, &linedef->back_side, status);
+    case D2K_UDMF_KEY_SPECIAL:
+      return read_int16(value, &linedef->special, status);
+    case D2K_UDMF_KEY_ID:
+      return read_int(value, &linedef->id, status);
+    case D2K_UDMF_KEY_BLOCKING:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_BLOCKING,
+                                              status);
+    case D2K_UDMF_KEY_BLOCKMONSTERS:
+      return set_flag(value, &linedef->flags,
+                             D2K_LINEDEF_FLAG_BLOCK_MONSTERS,
+                             status);
+    case D2K_UDMF_KEY_TWOSIDED:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_TWO_SIDED,
+                                              status);
+    case D2K_UDMF_KEY_DONTPEGTOP:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_DONT_PEG_TOP,
+                                              status);
+    case D2K_UDMF_KEY_DONTPEGBOTTOM:
+      return set_flag(value, &linedef->flags,
+                             D2K_LINEDEF_FLAG_DONT_PEG_BOTTOM,
+                             status);
+    case D2K_UDMF_KEY_SECRET:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_SECRET,
+                                              status);
+    case D2K_UDMF_KEY_BLOCKSOUND:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_SOUND_BLOCK,
+                                              status);
+    case D2K_UDMF_KEY_DONTDRAW:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_DONT_DRAW,
+                                              status);
+    case D2K_UDMF_KEY_MAPPED:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_MAPPED,
+                                              status);
+    case D2K_UDMF_KEY_PASSUSE:
+      return set_flag(value, &linedef->flags, D2K_LINEDEF_FLAG_PASS_USE,
+                                              status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool read_sidedef_field(Block *block, D2KUDMFKey key,
+                                             D2KUDMFToken *value,
+                                             Status *status) {
+  D2KUDMFSidedef *sidedef = &block->record.sidedef;
+  int32_t offset;
+
+  switch (key) {
+    case D2K_UDMF_KEY_OFFSETX:
+    case D2K_UDMF_KEY_OFFSETY:
+      if (!read_int(value, &offset, status)) {
+        return false;
+      }
+
+      if (offset <= -32768 || offset >= 32768) {
+        return invalid_value(status);
+      }
+
+      if (key == D2K_UDMF_KEY_OFFSETX) {
+        sidedef->texture_offset = offset * FRACUNIT;
+      }
+      else {
+        sidedef->row_offset = offset * FRACUNIT;
+      }
+
+      return status_ok(status);
+    case D2K_UDMF_KEY_SECTOR:
+      return read_int(value, &sidedef->sector, status);
+    case D2K_UDMF_KEY_TEXTURETOP:
+      return read_name(value, sidedef->top_texture, status);
+    case D2K_UDMF_KEY_TEXTUREBOTTOM:
+      return read_name(value, sidedef->bottom_texture, status);
+    case D2K_UDMF_KEY_TEXTUREMIDDLE:
+      return read_name(value, sidedef->mid_texture, status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool read_sector_field(Block *block, D2KUDMFKey key,
+                                            D2KUDMFToken *value,
+                                            Status *status) {
+  D2KUDMFSector *sector = &block->record.sector;
+  int16_t height = 0;
+
+  switch (key) {
+    case D2K_UDMF_KEY_HEIGHTFLOOR:
+      if (!read_int16(value, &height, status)) {
+        return false;
+      }
+
+      sector->floor_height = height * FRACUNIT;
+
+      return status_ok(status);
+    case D2K_UDMF_KEY_HEIGHTCEILING:
+      if (!read_int16(value, &height, status)) {
+        return false;
+      }
+
+      sector->ceiling_height = height * FRACUNIT;
+
+      return status_ok(status);
+    case D2K_UDMF_KEY_TEXTUREFLOOR:
+      return read_name(value, sector->floor_texture, status);
+    case D2K_UDMF_KEY_TEXTURECEILING:
+      return read_name(value, sector->ceiling_texture, status);
+    case D2K_UDMF_KEY_LIGHTLEVEL:
+      return read_int16(value, &sector->light_level, status);
+    case D2K_UDMF_KEY_SPECIAL:
+      return read_int16(value, &sector->special, status);
+    case D2K_UDMF_KEY_ID:
+      return read_int16(value, &sector->tag, status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool read_field(Block *block, D2KUDMFKey key, D2KUDMFToken *value,
+                                                     Status *status) {
+  block->seen |= KEY_BIT(key);
+
+  switch (block->kind) {
+    case D2K_UDMF_KEY_THING:
+      return read_thing_field(block, key, value, status);
+    case D2K_UDMF_KEY_VERTEX:
+      return read_vertex_field(block, key, value, status);
+    case D2K_UDMF_KEY_LINEDEF:
+      return read_linedef_field(block, key, value, status);
+    case D2K_UDMF_KEY_SIDEDEF:
+      return read_sidedef_field(block, key, value, status);
+    case D2K_UDMF_KEY_SECTOR:
+      return read_sector_field(block, key, value, status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool append_record(Array *array, const void *record, Status *status) {
+  void *slot = NULL;
+
+  if (!array_append(array, &slot, status)) {
+    return false;
+  }
+
+  memcpy(slot, record, array->element_size);
+
+  return status_ok(status);
+}
+
+/*
+ * UDMF's skill1 and skill2 are both vanilla's "easy" bit, and skill4 and
+ * skill5 both its "hard" bit; single, coop and dm default to off, so they
+ * map onto Boom's "not in this mode" bits inverted.
+ */
+static int16_t thing_options(Block *block) {
+  int16_t options = block->record.thing.options;
+
+  if (block->skills[0] || block->skills[1]) {
+    options |= D2K_MAP_THING_OPTION_EASY;
+  }
+
+  if (block->skills[2]) {
+    options |= D2K_MAP_THING_OPTION_NORMAL;
+  }
+
+  if (block->skills[3] || block->skills[4]) {
+    options |= D2K_MAP_THING_OPTION_HARD;
+  }
+
+  if (!block->single) {
+    options |= D2K_MAP_THING_OPTION_NOT_SINGLE;
+  }
+
+  if (!block->coop) {
+    options |= D2K_MAP_THING_OPTION_NOT_COOP;
+  }
+
+  if (!block->deathmatch) {
+    options |= D2K_MAP_THING_OPTION_NOT_DEATHMATCH;
+  }
+
+  return options;
+}
+
+static bool has_fields(Block *block, uint64_t required, Status *status) {
+  if ((block->seen & required) != required) {
+    return missing_field(status);
+  }
+
+  return status_ok(status);
+}
+
+static bool finish_block(D2KUDMFRecords *records, Block *block,
+                                                  Status *status) {
+  switch (block->kind) {
+    case D2K_UDMF_KEY_THING:
+      if (!has_fields(block, KEY_BIT(D2K_UDMF_KEY_X) |
+                             KEY_BIT(D2K_UDMF_KEY_Y) |
+                             KEY_BIT(D2K_UDMF_KEY_TYPE),
+                             status)) {
+        return false;
+      }
+
+      block->record.thing.options = thing_options(block);
+
+      return append_record(&records->things, &block->record.thing, status);
+    case D2K_UDMF_KEY_VERTEX:
+      if (!has_fields(block, KEY_BIT(D2K_UDMF_KEY_X) |
+                             KEY_BIT(D2K_UDMF_KEY_Y),
+                             status)) {
+        return false;
+      }
+
+      return append_record(&records->vertexes, &block->record.vertex,
+                                               status);
+    case D2K_UDMF_KEY_LINEDEF:
+      if (!has_fields(block, KEY_BIT(D2K_UDMF_KEY_V1) |
+                             KEY_BIT(D2K_UDMF_KEY_V2) |
+                             KEY_BIT(D2K_UDMF_KEY_SIDEFRONT),
+                             status)) {
+        return false;
+      }
+
+      return append_record(&records->linedefs, &block->record.linedef,
+                                               status);
+    case D2K_UDMF_KEY_SIDEDEF:
+      if (!has_fields(block, KEY_BIT(D2K_UDMF_KEY_SECTOR), status)) {
+        return false;
+      }
+
+      return append_record(&records->sidedefs, &block->record.sidedef,
+                                               status);
+    case D2K_UDMF_KEY_SECTOR:
+      if (!has_fields(block, KEY_BIT(D2K_UDMF_KEY_TEXTUREFLOOR) |
+                             KEY_BIT(D2K_UDMF_KEY_TEXTURECEILING),
+                             status)) {
+        return false;
+      }
+
+      return append_record(&records->sectors, &block->record.sector,
+                                              status);
+    default:
+      return status_ok(status);
+  }
+}
+
+static bool expect(D2KUDMFLexer *lexer, D2KUDMFToken *token,
+                                        D2KUDMFTokenType type,
+                                        Status *status) {
+  if (!d2k_udmf_lexer_next(lexer, token, status)) {
+    return false;
+  }
+
+  if (token->type != type) {
+    return syntax_error(status);
+  }
+
+  return status_ok(status);
+}
+
+/* The `value;` that follows a field or global name and its `=` */
+static bool parse_value(D2KUDMFLexer *lexer, D2KUDMFToken *value,
+                                             Status *status) {
+  D2KUDMFToken token;
+
+  if (!d2k_udmf_lexer_next(lexer, value, status)) {
+    return false;
+  }
+
+  switch (value->type) {
+    case D2K_UDMF_TOKEN_IDENTIFIER:
+    case D2K_UDMF_TOKEN_INTEGER:
+    case D2K_UDMF_TOKEN_FLOAT:
+    case D2K_UDMF_TOKEN_STRING:
+      break;
+    default:
+      return syntax_error(status);
+  }
+
+  return expect(lexer, &token, D2K_UDMF_TOKEN_SEMICOLON, status);
+}
+
+static bool parse_block(D2KUDMFRecords *records, D2KUDMFLexer *lexer,
+                                                 D2KUDMFKey kind,
+                                                 Status *status) {
+  Block block;
+
+  init_block(&block, kind);
+
+  for (;;) {
+    D2KUDMFToken name;
+    D2KUDMFToken value;
+
+    if (!d2k_udmf_lexer_next(lexer, &name, status)) {
+      return false;
+    }
+
+    if (name.type == D2K_UDMF_TOKEN_CLOSE_BRACE) {
+      break;
+    }
+
+    if (name.type != D2K_UDMF_TOKEN_IDENTIFIER) {
+      return syntax_error(status);
+    }
+
+    if (!(expect(lexer, &value, D2K_UDMF_TOKEN_EQUALS, status) &&
+          parse_value(lexer, &value, status))) {
+      return false;
+    }
+
+    if (!read_field(&block, (D2KUDMFKey)name.key, &value, status)) {
+      return false;
+    }
+  }
+
+  return finish_block(records, &block, status);
+}
+
+/* Only the Doom namespace's fields are implemented; names are caseless */
+static bool is_doom_namespace(D2KUDMFToken *value) {
+  static const char doom[] = "doom";
+
+  if (value->type != D2K_UDMF_TOKEN_STRING || value->len != sizeof(doom) - 1) {
+    return false;
+  }
+
+  for (size_t i = 0; i < value->len; i++) {
+    if (tolower((unsigned char)value->text[i]) != doom[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static bool parse_global(D2KUDMFRecords *records, D2KUDMFLexer *lexer,
+                                                  D2KUDMFToken *name,
+                                                  Status *status) {
+  D2KUDMFToken token;
+
+  if (name->type != D2K_UDMF_TOKEN_IDENTIFIER) {
+    return syntax_error(status);
+  }
+
+  if (!d2k_udmf_lexer_next(lexer, &token, status)) {
+    return false;
+  }
+
+  if (token.type == D2K_UDMF_TOKEN_OPEN_BRACE) {
+    return parse_block(records, lexer, (D2KUDMFKey)name->key, status);
+  }
+
+  if (token.type != D2K_UDMF_TOKEN_EQUALS) {
+    return syntax_error(status);
+  }
+
+  if (!parse_value(lexer, &token, status)) {
+    return false;
+  }
+
+  /*
+   * Other namespaces give the same fields different meanings (Hexen-style
+   * specials, for one), so loading them as Doom would be wrong.  Any other
+   * global assignment doesn't affect loading.
+   */
+  if (name->key == D2K_UDMF_KEY_NAMESPACE && !is_doom_namespace(&token)) {
+    return unsupported_namespace(status);
+  }
+
+  return status_ok(status);
+}
+
+void d2k_udmf_records_init(D2KUDMFRecords *records) {
+  array_init(&records->things, sizeof(D2KMapThing));
+  array_init(&records->vertexes, sizeof(D2KFixedVertex));
+  array_init(&records->linedefs, sizeof(D2KUDMFLinedef));
+  array_init(&records->sidedefs, sizeof(D2KUDMFSidedef));
+  array_init(&records->sectors, sizeof(D2KUDMFSector));
+  records->error_offset = 0;
+}
+
+void d2k_udmf_records_clear(D2KUDMFRecords *records) {
+  array_clear(&records->things);
+  array_clear(&records->vertexes);
+  array_clear(&records->linedefs);
+  array_clear(&records->sidedefs);
+  array_clear(&records->sectors);
+  records->error_offset = 0;
+}
+
+void d2k_udmf_records_free(D2KUDMFRecords *records) {
+  array_free(&records->things);
+  array_free(&records->vertexes);
+  array_free(&records->linedefs);
+  array_free(&records->sidedefs);
+  array_free(&records->sectors);
+  records->error_offset = 0;
+}
+
+bool d2k_udmf_parse(D2KUDMFRecords *records, const char *data, size_t len,
+                                                               Status *status) {
+  D2KUDMFLexer lexer;
+
+  d2k_udmf_lexer_init(&lexer, data, len);
+  records->error_offset = 0;
+
+  for (;;) {
+    D2KUDMFToken token;
+
+    if (!d2k_udmf_lexer_next(&lexer, &token, status)) {
+      break;
+    }
+
+    if (token.type == D2K_UDMF_TOKEN_END) {
+      return status_ok(status);
+    }
+
+    if (!parse_global(records, &lexer, &token, status)) {
+      break;
+    }
+  }
+
+  records->error_offset = lexer.offset;
+
+  return false;
+}
+
+static bool copy_records(Array *destination, Array *source, Status *status) {
+  if (!array_ensure_capacity(destination, source->len, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < source->len; i++) {
+    memcpy(array_append_fast(destination), array_index_fast(source, i),
+                                           source->element_size);
+  }
+
+  return status_ok(status);
+}
+
+typedef struct {
+  D2KUDMFRecords  records;
+  const char     *data;
+  size_t          len;
+  Status          status;
+  bool            parsed;
+} Chunk;
+
+static void* parse_chunk(void *data) {
+  Chunk *chunk = data;
+
+  chunk->parsed = d2k_udmf_parse(&chunk->records, chunk->data, chunk->len,
+                                                               &chunk->status);
+
+  return NULL;
+}
+
+/*
+ * Just past the first `}` at or after `offset`, skipping braces with a `//`
+ * before them on their line, which are certainly commented out.
+ */
+static size_t find_cut(const char *data, size_t len, size_t offset) {
+  for (size_t i = offset; i < len; i++) {
+    bool commented = false;
+
+    if (data[i] != '}') {
+      continue;
+    }
+
+    for (size_t j = i; j > 0 && data[j - 1] != '\n'; j--) {
+      if (j >= 2 && data[j - 1] == '/' && data[j - 2] == '/') {
+        commented = true;
+        break;
+      }
+    }
+
+    if (!commented) {
+      return i + 1;
+    }
+  }
+
+  return len;
+}
+
+static size_t default_thread_count(size_t len) {
+  size_t thread_count = (len / D2K_UDMF_PARALLEL_CHUNK_SIZE) + 1;
+  long cpu_count = 1;
+
+#ifdef _SC_NPROCESSORS_ONLN
+  cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+  if (cpu_count > 0 && thread_count > (size_t)cpu_count) {
+    thread_count = (size_t)cpu_count;
+  }
+
+  return thread_count;
+}
+
+static bool append_chunks(D2KUDMFRecords *records, Chunk *chunks,
+                                                   size_t chunk_count,
+                                                   Status *status) {
+  for (size_t i = 0; i < chunk_count; i++) {
+    D2KUDMFRecords *chunk_records = &chunks[i].records;
+
+    if (!(copy_records(&records->things, &chunk_records->things, status)     &&
+          copy_records(&records->vertexes, &chunk_records->vertexes,
+                                           status)                           &&
+          copy_records(&records->linedefs, &chunk_records->linedefs,
+                                           status)                           &&
+          copy_records(&records->sidedefs, &chunk_records->sidedefs,
+                                           status)                           &&
+          copy_records(&records->sectors, &chunk_records->sectors, status))) {
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_udmf_parse_parallel(D2KUDMFRecords *records,
+                             const char *data,
+                             size_t len,
+                             size_t thread_count,
+                             Status *status) {
+  Chunk chunks[D2K_UDMF_MAX_THREADS];
+  pthread_t threads[D2K_UDMF_MAX_THREADS];
+  bool started[D2K_UDMF_MAX_THREADS];
+  bool all_parsed = true;
+  size_t start = 0;
+  bool appended = false;
+
+  if (thread_count == 0) {
+    thread_count = default_thread_count(len);
+  }
+
+  if (thread_count > D2K_UDMF_MAX_THREADS) {
+    thread_count = D2K_UDMF_MAX_THREADS;
+  }
+
+  if (thread_count <= 1) {
+    return d2k_udmf_parse(records, data, len, status);
+  }
+
+  for (size_t i = 0; i < thread_count; i++) {
+    size_t end = len;
+
+    if (i + 1 < thread_count) {
+      end = find_cut(data, len, ((i + 1) * len) / thread_count);
+
+      if (end < start) {
+        end = start;
+      }
+    }
+
+    d2k_udmf_records_init(&chunks[i].records);
+    status_init(&chunks[i].status);
+    chunks[i].data = data + start;
+    chunks[i].len = end - start;
+    chunks[i].parsed = false;
+    start = end;
+  }
+
+  /*
+   * The calling thread takes the first chunk, and any chunk whose thread
+   * couldn't be started.
+   */
+  for (size_t i = 1; i < thread_count; i++) {
+    started[i] = pthread_create(&threads[i], NULL, parse_chunk,
+                                                   &chunks[i]) == 0;
+  }
+
+  parse_chunk(&chunks[0]);
+
+  for (size_t i = 1; i < thread_count; i++) {
+    if (started[i]) {
+      pthread_join(threads[i], NULL);
+    }
+    else {
+      parse_chunk(&chunks[i]);
+    }
+  }
+
+  for (size_t i = 0; i < thread_count; i++) {
+    all_parsed = all_parsed && chunks[i].parsed;
+  }
+
+  if (all_parsed) {
+    appended = append_chunks(records, chunks, thread_count, status);
+  }
+
+  for (size_t i = 0; i < thread_count; i++) {
+    d2k_udmf_records_free(&chunks[i].records);
+  }
+
+  if (!all_parsed) {
+    return d2k_udmf_parse(records, data, len, status);
+  }
+
+  return appended;
+}
+
+static bool load_sectors(D2KMapLoader *map_loader, D2KUDMFRecords *records,
+                                                   Status *status) {
+  Array *sectors = &map_loader->map->sectors;
+
+  if (!array_ensure_capacity(sectors, records->sectors.len, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < records->sectors.len; i++) {
+    D2KUDMFSector *record = array_index_fast(&records->sectors, i);
+    D2KSector *sector = array_append_fast(sectors);
+
+    memset(sector, 0, sizeof(D2KSector));
+    sector->id = i;
+    sector->floor_height = record->floor_height;
+    sector->ceiling_height = record->ceiling_height;
+    sector->light_level = record->light_level;
+    sector->special = record->special;
+    sector->tag = record->tag;
+
+    if (!d2k_map_loader_lookup_flat(map_loader, record->floor_texture,
+                                                &sector->floor_texture,
+                                                status)) {
+      return false;
+    }
+
+    if (!d2k_map_loader_lookup_flat(map_loader, record->ceiling_texture,
+                                                &sector->ceiling_texture,
+                                                status)) {
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool load_sidedefs(D2KMapLoader *map_loader, D2KUDMFRecords *records,
+                                                    Status *status) {
+  D2KMap *map = map_loader->map;
+
+  if (!array_ensure_capacity(&map->sidedefs, records->sidedefs.len, status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < records->sidedefs.len; i++) {
+    D2KUDMFSidedef *record = array_index_fast(&records->sidedefs, i);
+    D2KSidedef *sidedef = array_append_fast(&map->sidedefs);
+
+    if (record->sector < 0 || (size_t)record->sector >= map->sectors.len) {
+      return invalid_sector_index(status);
+    }
+
+    memset(sidedef, 0, sizeof(D2KSidedef));
+    sidedef->texture_offset = record->texture_offset;
+    sidedef->row_offset = record->row_offset;
+    sidedef->sector = array_index_fast(&map->sectors, (size_t)record->sector);
+
+    if (!d2k_map_loader_lookup_texture(map_loader, record->top_texture,
+                                                   &sidedef->top_texture,
+                                                   status)) {
+      return false;
+    }
+
+    if (!d2k_map_loader_lookup_texture(map_loader, record->bottom_texture,
+                                                   &sidedef->bottom_texture,
+                                                   status)) {
+      return false;
+    }
+
+    if (!d2k_map_loader_lookup_texture(map_loader, record->mid_texture,
+                                                   &sidedef->mid_texture,
+                                                   status)) {
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool load_linedefs(D2KMapLoader *map_loader, D2KUDMFRecords *records,
+                                                    Status *status) {
+  D2KMap *map = map_loader->map;
+
+  if (!array_ensure_capacity(&map->linedefs, records->linedefs.len, status)) {
+    return false;
+  }
+
+  d2k_map_init_sector_tag_lists(map);
+
+  for (size_t i = 0; i < records->linedefs.len; i++) {
+    D2KUDMFLinedef *record = array_index_fast(&records->linedefs, i);
+    D2KLinedef *linedef = array_append_fast(&map->linedefs);
+
+    if (record->v1 < 0 || (size_t)record->v1 >= map->vertexes.len ||
+        record->v2 < 0 || (size_t)record->v2 >= map->vertexes.len) {
+      return invalid_vertex_index(status);
+    }
+
+    if (record->front_side < 0 ||
+        (size_t)record->front_side >= map->sidedefs.len ||
+        record->back_side < -1 ||
+        (record->back_side >= 0 &&
+         (size_t)record->back_side >= map->sidedefs.len)) {
+      return invalid_sidedef_index(status);
+    }
+
+    memset(linedef, 0, sizeof(D2KLinedef));
+    linedef->id = i;
+    linedef->flags = record->flags;
+    linedef->special = record->special;
+    linedef->v1 = array_index_fast(&map->vertexes, (size_t)record->v1);
+    linedef->v2 = array_index_fast(&map->vertexes, (size_t)record->v2);
+    linedef->tag = record->id;
+    linedef->tagged_sector = d2k_map_find_tagged_sector(map, linedef->tag);
+    linedef->front_side = array_index_fast(&map->sidedefs,
+                                           (size_t)record->front_side);
+
+    if (record->back_side >= 0) {
+      linedef->back_side = array_index_fast(&map->sidedefs,
+                                            (size_t)record->back_side);
+    }
+
+    d2k_map_linedef_set_geometry(linedef);
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_map_loader_load_udmf_records(D2KMapLoader *map_loader,
+                                      D2KUDMFRecords *records,
+                                      Status *status) {
+  return (
+    copy_records(&map_loader->map->things, &records->things, status)     &&
+    copy_records(&map_loader->map->vertexes, &records->vertexes, status) &&
+    load_sectors(map_loader, records, status)                            &&
+    load_sidedefs(map_loader, records, status)                           &&
+    load_linedefs(map_loader, records, status)
+  );
+}
+
+/*
+ * UDMF maps usually leave out BLOCKMAP, so one is always built.  Nodes come
+ * from ZNODES, which isn't supported yet.
+ */
+bool d2k_map_loader_load_udmf(D2KMapLoader *map_loader,
+                              D2KLump *textmap_lump,
+                              Status *status) {
+  D2KUDMFRecords records;
+  bool loaded;
+
+  d2k_udmf_records_init(&records);
+
+  loaded = (
+    d2k_udmf_parse_parallel(&records, textmap_lump->data.data,
+                                      textmap_lump->data.len,
+                                      0,
+                                      status)                      &&
+    d2k_map_loader_load_udmf_records(map_loader, &records, status) &&
+    d2k_map_loader_build_blockmap(map_loader, status)              &&
+    d2k_map_loader_group_lines(map_loader, status)
+  );
+
+  d2k_udmf_records_free(&records);
+
+  return loaded;
+}
+
+/* vi: set et ts=2 sw=2: */
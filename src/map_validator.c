@@ -0,0 +1,952 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/map.h"
+#include "d2k/map_linedefs.h"
+#include "d2k/map_problem.h"
+#include "d2k/map_udmf.h"
+#include "d2k/map_validator.h"
+#include "d2k/wad.h"
+
+#define map_not_found(status) status_error( \
+  status,                                   \
+  "d2k_map_validator",                      \
+  D2K_MAP_VALIDATOR_MAP_NOT_FOUND,          \
+  "map not found"                           \
+)
+
+#define CHILD_IS_SUBSECTOR   0x8000
+#define LINE_LIST_END        0xFFFF
+
+typedef struct {
+  size_t vertexes;
+  size_t linedefs;
+  size_t sidedefs;
+  size_t sectors;
+  size_t segs;
+  size_t subsectors;
+  size_t nodes;
+} RecordCounts;
+
+static bool add_invalid_index(Array *problems, D2KMapProblemType type,
+                                               D2KMapLump lump,
+                                               size_t record,
+                                               int64_t index,
+                                               size_t count,
+                                               Status *status) {
+  D2KMapProblem *problem = NULL;
+
+  if (!d2k_map_problem_add(problems,
+                           type,
+                           lump,
+                           record,
+                           &problem,
+                           status)) {
+    return false;
+  }
+
+  problem->as.invalid_index.index = index;
+  problem->as.invalid_index.count = count;
+
+  return status_ok(status);
+}
+
+static size_t record_count(D2KLump *lump, size_t record_size) {
+  if (!lump) {
+    return 0;
+  }
+
+  return lump->data.len / record_size;
+}
+
+static bool check_record_size(D2KLump *lump, D2KMapLump map_lump,
+                                             size_t record_size,
+                                             Array *problems,
+                                             Status *status) {
+  D2KMapProblem *problem = NULL;
+
+  if ((lump->data.len % record_size) == 0) {
+    return status_ok(status);
+  }
+
+  if (!d2k_map_problem_add(problems,
+                           D2K_MAP_PROBLEM_MALFORMED_LUMP,
+                           map_lump,
+                           0,
+                           &problem,
+                           status)) {
+    return false;
+  }
+
+  problem->as.malformed_lump.lump_size = lump->data.len;
+  problem->as.malformed_lump.record_size = record_size;
+
+  return status_ok(status);
+}
+
+static bool lump_starts_with(D2KLump *lump, const char *signature) {
+  size_t len = strlen(signature);
+
+  return (
+    (lump != NULL)          &&
+    (lump->data.len >= len) &&
+    (memcmp(lump->data.data, signature, len) == 0)
+  );
+}
+
+/*
+ * ZDoom's extended nodes replace the vanilla NODES, SEGS and SSECTORS
+ * records; none of the vanilla checks apply to them.
+ */
+static bool has_extended_nodes(D2KLump *lumps[D2K_VANILLA_MAP_LUMP_MAX]) {
+  D2KLump *nodes = lumps[D2K_VANILLA_MAP_LUMP_NODES];
+  D2KLump *subsectors = lumps[D2K_VANILLA_MAP_LUMP_SSECTORS];
+
+  return (
+    lump_starts_with(nodes, "xNd4")      ||
+    lump_starts_with(nodes, "XNOD")      ||
+    lump_starts_with(nodes, "ZNOD")      ||
+    lump_starts_with(subsectors, "XGLN") ||
+    lump_starts_with(subsectors, "ZGLN")
+  );
+}
+
+static bool validate_linedefs(D2KLump *lump, RecordCounts *counts,
+                                             Array *problems,
+                                             Status *status) {
+  size_t linedef_count = lump->data.len / D2K_VANILLA_LINEDEF_SIZE;
+
+  for (size_t i = 0; i < linedef_count; i++) {
+    const char *data = lump->data.data + (i * D2K_VANILLA_LINEDEF_SIZE);
+    uint16_t start_vertex = d2k_lump_data_uint16(data,  0);
+    uint16_t end_vertex   = d2k_lump_data_uint16(data,  2);
+    uint16_t flags        = d2k_lump_data_uint16(data,  4);
+    uint16_t front_side   = d2k_lump_data_uint16(data, 10);
+    uint16_t back_side    = d2k_lump_data_uint16(data, 12);
+
+    if (start_vertex >= counts->vertexes) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_LINEDEF_START_VERTEX_INDEX,
+                             D2K_MAP_LUMP_LINEDEFS,
+                             i,
+                             start_vertex,
+                             counts->vertexes,
+                             status)) {
+        return false;
+      }
+    }
+
+    if (end_vertex >= counts->vertexes) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_LINEDEF_END_VERTEX_INDEX,
+                             D2K_MAP_LUMP_LINEDEFS,
+                             i,
+                             end_vertex,
+                             counts->vertexes,
+                             status)) {
+        return false;
+      }
+    }
+
+    if (front_side >= counts->sidedefs) {
+      if (!add_invalid_index(
+            problems,
+            D2K_MAP_PROBLEM_INVALID_LINEDEF_FRONT_SIDEDEF_INDEX,
+            D2K_MAP_LUMP_LINEDEFS,
+            i,
+            front_side,
+            counts->sidedefs,
+            status)) {
+        return false;
+      }
+    }
+
+    if ((back_side != D2K_MAP_NO_SIDEDEF) &&
+        (back_side >= counts->sidedefs)) {
+      if (!add_invalid_index(
+            problems,
+            D2K_MAP_PROBLEM_INVALID_LINEDEF_BACK_SIDEDEF_INDEX,
+            D2K_MAP_LUMP_LINEDEFS,
+            i,
+            back_side,
+            counts->sidedefs,
+            status)) {
+        return false;
+      }
+    }
+
+    if ((flags & D2K_LINEDEF_FLAG_TWO_SIDED) &&
+        (back_side == D2K_MAP_NO_SIDEDEF)) {
+      if (!d2k_map_problem_add(
+            problems,
+            D2K_MAP_PROBLEM_TWO_SIDED_LINEDEF_MISSING_BACK_SIDE,
+            D2K_MAP_LUMP_LINEDEFS,
+            i,
+            NULL,
+            status)) {
+        return false;
+      }
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_sidedefs(D2KLump *lump, RecordCounts *counts,
+                                             Array *problems,
+                                             Status *status) {
+  size_t sidedef_count = lump->data.len / D2K_VANILLA_SIDEDEF_SIZE;
+
+  for (size_t i = 0; i < sidedef_count; i++) {
+    const char *data = lump->data.data + (i * D2K_VANILLA_SIDEDEF_SIZE);
+    uint16_t sector = d2k_lump_data_uint16(data, 28);
+
+    if (sector >= counts->sectors) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_SIDEDEF_SECTOR_INDEX,
+                             D2K_MAP_LUMP_SIDEDEFS,
+                             i,
+                             sector,
+                             counts->sectors,
+                             status)) {
+        return false;
+      }
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_segs(D2KLump *lump, RecordCounts *counts,
+                                         Array *problems,
+                                         Status *status) {
+  size_t seg_count = lump->data.len / D2K_VANILLA_SEG_SIZE;
+
+  for (size_t i = 0; i < seg_count; i++) {
+    const char *data = lump->data.data + (i * D2K_VANILLA_SEG_SIZE);
+    uint16_t start_vertex = d2k_lump_data_uint16(data, 0);
+    uint16_t end_vertex   = d2k_lump_data_uint16(data, 2);
+    uint16_t linedef      = d2k_lump_data_uint16(data, 6);
+    int16_t  side         = d2k_lump_data_int16(data,  8);
+
+    if (start_vertex >= counts->vertexes) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_SEG_START_VERTEX_INDEX,
+                             D2K_MAP_LUMP_SEGS,
+                             i,
+                             start_vertex,
+                             counts->vertexes,
+                             status)) {
+        return false;
+      }
+    }
+
+    if (end_vertex >= counts->vertexes) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_SEG_END_VERTEX_INDEX,
+                             D2K_MAP_LUMP_SEGS,
+                             i,
+                             end_vertex,
+                             counts->vertexes,
+                             status)) {
+        return false;
+      }
+    }
+
+    if (linedef >= counts->linedefs) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_SEG_LINEDEF_INDEX,
+                             D2K_MAP_LUMP_SEGS,
+                             i,
+                             linedef,
+                             counts->linedefs,
+                             status)) {
+        return false;
+      }
+    }
+
+    if ((side != 0) && (side != 1)) {
+      D2KMapProblem *problem = NULL;
+
+      if (!d2k_map_problem_add(problems,
+                               D2K_MAP_PROBLEM_INVALID_SEG_LINE_SIDE,
+                               D2K_MAP_LUMP_SEGS,
+                               i,
+                               &problem,
+                               status)) {
+        return false;
+      }
+
+      problem->as.invalid_seg_line_side.side = side;
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_subsectors(D2KLump *lump, RecordCounts *counts,
+                                               Array *problems,
+                                               Status *status) {
+  size_t subsector_count = lump->data.len / D2K_VANILLA_SUBSECTOR_SIZE;
+
+  for (size_t i = 0; i < subsector_count; i++) {
+    const char *data = lump->data.data + (i * D2K_VANILLA_SUBSECTOR_SIZE);
+    size_t seg_count = d2k_lump_data_uint16(data, 0);
+    size_t first_seg = d2k_lump_data_uint16(data, 2);
+    D2KMapProblem *problem = NULL;
+
+    if ((first_seg + seg_count) <= counts->segs) {
+      continue;
+    }
+
+    if (!d2k_map_problem_add(problems,
+                             D2K_MAP_PROBLEM_OUT_OF_RANGE_SEG_LIST,
+                             D2K_MAP_LUMP_SSECTORS,
+                             i,
+                             &problem,
+                             status)) {
+      return false;
+    }
+
+    problem->as.out_of_range_seg_list.first_seg = first_seg;
+    problem->as.out_of_range_seg_list.seg_count = seg_count;
+    problem->as.out_of_range_seg_list.total_seg_count = counts->segs;
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_nodes(D2KLump *lump, RecordCounts *counts,
+                                          Array *problems,
+                                          Status *status) {
+  size_t node_count = lump->data.len / D2K_VANILLA_NODE_SIZE;
+
+  for (size_t i = 0; i < node_count; i++) {
+    const char *data = lump->data.data + (i * D2K_VANILLA_NODE_SIZE);
+
+    for (size_t side = 0; side < 2; side++) {
+      uint16_t child = d2k_lump_data_uint16(data, 24 + (side * 2));
+      bool subsector = (child & CHILD_IS_SUBSECTOR) != 0;
+      size_t index = child & ~CHILD_IS_SUBSECTOR;
+      size_t count = subsector ? counts->subsectors : counts->nodes;
+      D2KMapProblem *problem = NULL;
+
+      if (index < count) {
+        continue;
+      }
+
+      if (!d2k_map_problem_add(problems,
+                               D2K_MAP_PROBLEM_INVALID_NODE_CHILD_INDEX,
+                               D2K_MAP_LUMP_NODES,
+                               i,
+                               &problem,
+                               status)) {
+        return false;
+      }
+
+      problem->as.invalid_node_child_index.side = side;
+      problem->as.invalid_node_child_index.subsector = subsector;
+      problem->as.invalid_node_child_index.index = index;
+      problem->as.invalid_node_child_index.count = count;
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_reject(D2KLump *lump, RecordCounts *counts,
+                                           Array *problems,
+                                           Status *status) {
+  size_t expected_size = ((counts->sectors * counts->sectors) + 7) / 8;
+  D2KMapProblem *problem = NULL;
+
+  if (lump->data.len >= expected_size) {
+    return status_ok(status);
+  }
+
+  if (!d2k_map_problem_add(problems,
+                           D2K_MAP_PROBLEM_TRUNCATED_REJECT,
+                           D2K_MAP_LUMP_REJECT,
+                           0,
+                           &problem,
+                           status)) {
+    return false;
+  }
+
+  problem->as.truncated_reject.lump_size = lump->data.len;
+  problem->as.truncated_reject.expected_size = expected_size;
+
+  return status_ok(status);
+}
+
+/*
+ * Walks a block's line list up to its terminator.  Compressed blockmaps
+ * share lists (and list tails) between blocks, so words already walked are
+ * marked in `walked` and a walk stops when it reaches one: every word is
+ * checked once, and a shared bad list is reported once, for the first block
+ * that uses it.
+ */
+static bool validate_line_list(D2KLump *lump, size_t block,
+                                              size_t offset,
+                                              uint8_t *walked,
+                                              RecordCounts *counts,
+                                              Array *problems,
+                                              Status *status) {
+  size_t word_count = lump->data.len / 2;
+
+  for (size_t pos = offset; !walked[pos]; pos++) {
+    uint16_t linedef;
+
+    walked[pos] = 1;
+    linedef = d2k_lump_data_uint16(lump->data.data, pos * 2);
+
+    if (linedef == LINE_LIST_END) {
+      break;
+    }
+
+    if (linedef >= counts->linedefs) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_BLOCKMAP_LINEDEF_INDEX,
+                             D2K_MAP_LUMP_BLOCKMAP,
+                             block,
+                             linedef,
+                             counts->linedefs,
+                             status)) {
+        return false;
+      }
+    }
+
+    if ((pos + 1) >= word_count) {
+      D2KMapProblem *problem = NULL;
+
+      if (!d2k_map_problem_add(problems,
+                               D2K_MAP_PROBLEM_UNTERMINATED_BLOCKMAP_LINE_LIST,
+                               D2K_MAP_LUMP_BLOCKMAP,
+                               block,
+                               &problem,
+                               status)) {
+        return false;
+      }
+
+      problem->as.blockmap_line_list.offset = offset;
+      break;
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_blockmap(D2KLump *lump, RecordCounts *counts,
+                                             Array *problems,
+                                             Status *status) {
+  D2KMapProblem *problem = NULL;
+  int16_t width;
+  int16_t height;
+  size_t block_count;
+  size_t directory_end;
+  size_t word_count;
+  uint8_t *walked = NULL;
+
+  if (lump->data.len < D2K_VANILLA_BLOCKMAP_HEADER_SIZE) {
+    if (!d2k_map_problem_add(problems,
+                             D2K_MAP_PROBLEM_TRUNCATED_BLOCKMAP_HEADER,
+                             D2K_MAP_LUMP_BLOCKMAP,
+                             0,
+                             &problem,
+                             status)) {
+      return false;
+    }
+
+    problem->as.truncated_blockmap_header.lump_size = lump->data.len;
+
+    return status_ok(status);
+  }
+
+  width = d2k_lump_data_int16(lump->data.data, 4);
+  height = d2k_lump_data_int16(lump->data.data, 6);
+
+  if (width < 0) {
+    if (!d2k_map_problem_add(problems,
+                             D2K_MAP_PROBLEM_NEGATIVE_BLOCKMAP_WIDTH,
+                             D2K_MAP_LUMP_BLOCKMAP,
+                             0,
+                             &problem,
+                             status)) {
+      return false;
+    }
+
+    problem->as.negative_blockmap_width.blockmap_width = width;
+  }
+
+  if (height < 0) {
+    if (!d2k_map_problem_add(problems,
+                             D2K_MAP_PROBLEM_NEGATIVE_BLOCKMAP_HEIGHT,
+                             D2K_MAP_LUMP_BLOCKMAP,
+                             0,
+                             &problem,
+                             status)) {
+      return false;
+    }
+
+    problem->as.negative_blockmap_height.blockmap_height = height;
+  }
+
+  if ((width < 0) || (height < 0)) {
+    return status_ok(status);
+  }
+
+  block_count = ((size_t)width) * ((size_t)height);
+  directory_end = D2K_VANILLA_BLOCKMAP_HEADER_SIZE + (block_count * 2);
+
+  if (lump->data.len < directory_end) {
+    if (!d2k_map_problem_add(
+          problems,
+          D2K_MAP_PROBLEM_TRUNCATED_BLOCKMAP_LINE_LIST_DIRECTORY,
+          D2K_MAP_LUMP_BLOCKMAP,
+          0,
+          &problem,
+          status)) {
+      return false;
+    }
+
+    problem->as.truncated_blockmap_line_list_directory.lump_size =
+      lump->data.len;
+    problem->as.truncated_blockmap_line_list_directory.block_count =
+      block_count;
+
+    return status_ok(status);
+  }
+
+  word_count = lump->data.len / 2;
+
+  if (!d2k_calloc((void **)&walked, word_count, sizeof(uint8_t),
+                                                status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < block_count; i++) {
+    size_t offset = d2k_lump_data_uint16(
+      lump->data.data,
+      D2K_VANILLA_BLOCKMAP_HEADER_SIZE + (i * 2)
+    );
+
+    if ((offset < (directory_end / 2)) || (offset >= word_count)) {
+      if (!d2k_map_problem_add(
+            problems,
+            D2K_MAP_PROBLEM_INVALID_OFFSET_IN_BLOCKMAP_DIRECTORY,
+            D2K_MAP_LUMP_BLOCKMAP,
+            i,
+            &problem,
+            status)) {
+        d2k_free(walked);
+        return false;
+      }
+
+      problem->as.blockmap_line_list.offset = offset;
+      continue;
+    }
+
+    if (!validate_line_list(lump, i, offset, walked, counts, problems,
+                                                             status)) {
+      d2k_free(walked);
+      return false;
+    }
+  }
+
+  d2k_free(walked);
+
+  return status_ok(status);
+}
+
+static bool lump_is_required(size_t index, bool has_gl_nodes) {
+  switch (index) {
+    case D2K_VANILLA_MAP_LUMP_SEGS:
+    case D2K_VANILLA_MAP_LUMP_SSECTORS:
+    case D2K_VANILLA_MAP_LUMP_NODES:
+      return !has_gl_nodes;
+    case D2K_VANILLA_MAP_LUMP_BEHAVIOR:
+    case D2K_VANILLA_MAP_LUMP_SCRIPTS:
+      return false;
+    default:
+      return true;
+  }
+}
+
+bool d2k_map_validate_lumps(D2KLump *lumps[D2K_VANILLA_MAP_LUMP_MAX],
+                            bool has_gl_nodes,
+                            Array *problems,
+                            Status *status) {
+  static const size_t record_sizes[D2K_VANILLA_MAP_LUMP_MAX] = {
+    0,
+    D2K_VANILLA_THING_SIZE,
+    D2K_VANILLA_LINEDEF_SIZE,
+    D2K_VANILLA_SIDEDEF_SIZE,
+    D2K_VANILLA_VERTEX_SIZE,
+    D2K_VANILLA_SEG_SIZE,
+    D2K_VANILLA_SUBSECTOR_SIZE,
+    D2K_VANILLA_NODE_SIZE,
+    D2K_VANILLA_SECTOR_SIZE,
+    0,
+    0,
+    0,
+    0,
+  };
+  bool check_nodes = !has_extended_nodes(lumps);
+  RecordCounts counts;
+
+  counts.vertexes = record_count(lumps[D2K_VANILLA_MAP_LUMP_VERTEXES],
+                                 D2K_VANILLA_VERTEX_SIZE);
+  counts.linedefs = record_count(lumps[D2K_VANILLA_MAP_LUMP_LINEDEFS],
+                                 D2K_VANILLA_LINEDEF_SIZE);
+  counts.sidedefs = record_count(lumps[D2K_VANILLA_MAP_LUMP_SIDEDEFS],
+                                 D2K_VANILLA_SIDEDEF_SIZE);
+  counts.sectors = record_count(lumps[D2K_VANILLA_MAP_LUMP_SECTORS],
+                                D2K_VANILLA_SECTOR_SIZE);
+  counts.segs = record_count(lumps[D2K_VANILLA_MAP_LUMP_SEGS],
+                             D2K_VANILLA_SEG_SIZE);
+  counts.subsectors = record_count(lumps[D2K_VANILLA_MAP_LUMP_SSECTORS],
+                                   D2K_VANILLA_SUBSECTOR_SIZE);
+  counts.nodes = record_count(lumps[D2K_VANILLA_MAP_LUMP_NODES],
+                              D2K_VANILLA_NODE_SIZE);
+
+  for (size_t i = D2K_VANILLA_MAP_LUMP_MAP + 1;
+       i < D2K_VANILLA_MAP_LUMP_MAX;
+       i++) {
+    D2KLump *lump = lumps[i];
+    bool is_node_lump = (
+      (i == D2K_VANILLA_MAP_LUMP_SEGS)     ||
+      (i == D2K_VANILLA_MAP_LUMP_SSECTORS) ||
+      (i == D2K_VANILLA_MAP_LUMP_NODES)
+    );
+    bool ok = true;
+
+    if (!lump) {
+      if (lump_is_required(i, has_gl_nodes)) {
+        if (!d2k_map_problem_add(problems,
+                                 D2K_MAP_PROBLEM_MISSING_LUMP,
+                                 (D2KMapLump)i,
+                                 0,
+                                 NULL,
+                                 status)) {
+          return false;
+        }
+      }
+
+      continue;
+    }
+
+    if (is_node_lump && !check_nodes) {
+      continue;
+    }
+
+    if (record_sizes[i]) {
+      if (!check_record_size(lump, (D2KMapLump)i, record_sizes[i], problems,
+                                                                   status)) {
+        return false;
+      }
+    }
+
+    switch (i) {
+      case D2K_VANILLA_MAP_LUMP_LINEDEFS:
+        ok = validate_linedefs(lump, &counts, problems, status);
+        break;
+      case D2K_VANILLA_MAP_LUMP_SIDEDEFS:
+        ok = validate_sidedefs(lump, &counts, problems, status);
+        break;
+      case D2K_VANILLA_MAP_LUMP_SEGS:
+        ok = validate_segs(lump, &counts, problems, status);
+        break;
+      case D2K_VANILLA_MAP_LUMP_SSECTORS:
+        ok = validate_subsectors(lump, &counts, problems, status);
+        break;
+      case D2K_VANILLA_MAP_LUMP_NODES:
+        ok = validate_nodes(lump, &counts, problems, status);
+        break;
+      case D2K_VANILLA_MAP_LUMP_REJECT:
+        ok = validate_reject(lump, &counts, problems, status);
+        break;
+      case D2K_VANILLA_MAP_LUMP_BLOCKMAP:
+        ok = validate_blockmap(lump, &counts, problems, status);
+        break;
+      default:
+        break;
+    }
+
+    if (!ok) {
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_udmf_linedefs(D2KUDMFRecords *records, Array *problems,
+                                                            Status *status) {
+  size_t vertex_count = records->vertexes.len;
+  size_t sidedef_count = records->sidedefs.len;
+
+  for (size_t i = 0; i < records->linedefs.len; i++) {
+    D2KUDMFLinedef *linedef = array_index_fast(&records->linedefs, i);
+
+    if (linedef->v1 < 0 || (size_t)linedef->v1 >= vertex_count) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_LINEDEF_START_VERTEX_INDEX,
+                             D2K_MAP_LUMP_TEXTMAP,
+                             i,
+                             linedef->v1,
+                             vertex_count,
+                             status)) {
+        return false;
+      }
+    }
+
+    if (linedef->v2 < 0 || (size_t)linedef->v2 >= vertex_count) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_LINEDEF_END_VERTEX_INDEX,
+                             D2K_MAP_LUMP_TEXTMAP,
+                             i,
+                             linedef->v2,
+                             vertex_count,
+                             status)) {
+        return false;
+      }
+    }
+
+    if (linedef->front_side < 0 ||
+        (size_t)linedef->front_side >= sidedef_count) {
+      if (!add_invalid_index(
+            problems,
+            D2K_MAP_PROBLEM_INVALID_LINEDEF_FRONT_SIDEDEF_INDEX,
+            D2K_MAP_LUMP_TEXTMAP,
+            i,
+            linedef->front_side,
+            sidedef_count,
+            status)) {
+        return false;
+      }
+    }
+
+    if (linedef->back_side < -1 ||
+        (linedef->back_side >= 0 &&
+         (size_t)linedef->back_side >= sidedef_count)) {
+      if (!add_invalid_index(
+            problems,
+            D2K_MAP_PROBLEM_INVALID_LINEDEF_BACK_SIDEDEF_INDEX,
+            D2K_MAP_LUMP_TEXTMAP,
+            i,
+            linedef->back_side,
+            sidedef_count,
+            status)) {
+        return false;
+      }
+    }
+
+    if ((linedef->flags & D2K_LINEDEF_FLAG_TWO_SIDED) &&
+        (linedef->back_side == -1)) {
+      if (!d2k_map_problem_add(
+            problems,
+            D2K_MAP_PROBLEM_TWO_SIDED_LINEDEF_MISSING_BACK_SIDE,
+            D2K_MAP_LUMP_TEXTMAP,
+            i,
+            NULL,
+            status)) {
+        return false;
+      }
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool validate_udmf_sidedefs(D2KUDMFRecords *records, Array *problems,
+                                                            Status *status) {
+  size_t sector_count = records->sectors.len;
+
+  for (size_t i = 0; i < records->sidedefs.len; i++) {
+    D2KUDMFSidedef *sidedef = array_index_fast(&records->sidedefs, i);
+
+    if (sidedef->sector < 0 || (size_t)sidedef->sector >= sector_count) {
+      if (!add_invalid_index(problems,
+                             D2K_MAP_PROBLEM_INVALID_SIDEDEF_SECTOR_INDEX,
+                             D2K_MAP_LUMP_TEXTMAP,
+                             i,
+                             sidedef->sector,
+                             sector_count,
+                             status)) {
+        return false;
+      }
+    }
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_map_validate_udmf(D2KLump *textmap_lump, Array *problems,
+                                                  Status *status) {
+  D2KUDMFRecords records;
+  bool ok = false;
+
+  d2k_udmf_records_init(&records);
+
+  if (!d2k_udmf_parse(&records, textmap_lump->data.data,
+                                textmap_lump->data.len,
+                                status)) {
+    D2KMapProblem *problem = NULL;
+    int code = status->code;
+
+    /* Only syntax problems are the map's fault */
+    if (strcmp(status->domain, "d2k_map_udmf") != 0) {
+      d2k_udmf_records_free(&records);
+      return false;
+    }
+
+    status_clear(status);
+    ok = d2k_map_problem_add(problems,
+                             D2K_MAP_PROBLEM_UDMF_SYNTAX_ERROR,
+                             D2K_MAP_LUMP_TEXTMAP,
+                             0,
+                             &problem,
+                             status);
+
+    if (ok) {
+      problem->as.udmf_syntax_error.offset = records.error_offset;
+      problem->as.udmf_syntax_error.code = code;
+    }
+
+    d2k_udmf_records_free(&records);
+
+    return ok;
+  }
+
+  ok = (
+    validate_udmf_linedefs(&records, problems, status) &&
+    validate_udmf_sidedefs(&records, problems, status)
+  );
+
+  d2k_udmf_records_free(&records);
+
+  return ok;
+}
+
+static bool lookup_optional(D2KLumpDirectory *lump_directory,
+                            const char *name,
+                            D2KLump **lump,
+                            Status *status) {
+  *lump = NULL;
+
+  if (!d2k_lump_directory_lookup(lump_directory, name, lump, status)) {
+    if (!status_match(status, "base", ERROR_NOT_FOUND)) {
+      return false;
+    }
+
+    *lump = NULL;
+    status_clear(status);
+  }
+
+  return status_ok(status);
+}
+
+static size_t vanilla_lump_index(const char *name) {
+  for (size_t i = D2K_VANILLA_MAP_LUMP_MAP + 1;
+       i < D2K_VANILLA_MAP_LUMP_MAX;
+       i++) {
+    if (strcmp(name, d2k_map_lump_vanilla_names[i]) == 0) {
+      return i;
+    }
+  }
+
+  return D2K_VANILLA_MAP_LUMP_MAP;
+}
+
+bool d2k_map_validate(D2KLumpDirectory *lump_directory,
+                      const char *map_name,
+                      Array *problems,
+                      Status *status) {
+  D2KLump *lumps[D2K_VANILLA_MAP_LUMP_MAX];
+  D2KLump *map_lump = NULL;
+  D2KLump *gl_map_lump = NULL;
+  char gl_map_name[9];
+  size_t last_index = D2K_VANILLA_MAP_LUMP_MAP;
+  bool jumbled = false;
+
+  if (!lookup_optional(lump_directory, map_name, &map_lump, status)) {
+    return false;
+  }
+
+  if (!map_lump) {
+    return map_not_found(status);
+  }
+
+  memset(lumps, 0, sizeof(lumps));
+
+  /*
+   * Map lumps follow the marker; collect them by name, so that jumbled
+   * lumps can still be checked, and stop at the first non-map lump.
+   */
+  for (size_t i = map_lump->index + 1; i < lump_directory->lumps.len; i++) {
+    D2KLump *lump = NULL;
+    size_t index;
+
+    if (!d2k_lump_directory_index(lump_directory, i, &lump, status)) {
+      return false;
+    }
+
+    if ((i == (map_lump->index + 1)) && (strcmp(lump->name, "TEXTMAP") == 0)) {
+      return d2k_map_validate_udmf(lump, problems, status);
+    }
+
+    index = vanilla_lump_index(lump->name);
+
+    if ((index == D2K_VANILLA_MAP_LUMP_MAP) || lumps[index]) {
+      break;
+    }
+
+    if ((index < last_index) && !jumbled) {
+      if (!d2k_map_problem_add(problems,
+                               D2K_MAP_PROBLEM_JUMBLED_LUMPS,
+                               (D2KMapLump)index,
+                               0,
+                               NULL,
+                               status)) {
+        return false;
+      }
+
+      jumbled = true;
+    }
+
+    lumps[index] = lump;
+    last_index = index;
+  }
+
+  snprintf(gl_map_name, sizeof(gl_map_name), "GL_%s", map_name);
+
+  if (!lookup_optional(lump_directory, gl_map_name, &gl_map_lump, status)) {
+    return false;
+  }
+
+  return d2k_map_validate_lumps(lumps, gl_map_lump != NULL, problems,
+                                                            status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -41,15 +41,14 @@
   "malformed GL_VERT lump"                           \
 )
 
-#define VANILLA_VERTEX_SIZE 4
 #define GL_VERT_HEADER_SIZE 4
 #define GL_VERT_VERTEX_SIZE (sizeof(D2KFixedPoint) * 2)
 
 bool d2k_map_loader_load_vertexes(D2KMapLoader *map_loader, Status *status) {
   D2KLump *vertexes_lump = map_loader->map_lumps[D2K_MAP_LUMP_VERTEXES];
-  size_t vertex_count = vertexes_lump->data.len / VANILLA_VERTEX_SIZE;
+  size_t vertex_count = vertexes_lump->data.len / D2K_VANILLA_VERTEX_SIZE;
 
-  if ((vertexes_lump->data.len % VANILLA_VERTEX_SIZE) != 0) {
+  if ((vertexes_lump->data.len % D2K_VANILLA_VERTEX_SIZE) != 0) {
     return malformed_vertexes_lump(status);
   }
 
@@ -60,10 +59,10 @@ bool d2k_map_loader_load_vertexes(D2KMapLoader *map_loader, Status *status) {
 
   for (size_t i = 0; i < vertex_count; i++) {
     D2KFixedVertex *v = array_append_fast(&map_loader->map->vertexes);
-    char vertex_data[VANILLA_VERTEX_SIZE];
+    char vertex_data[D2K_VANILLA_VERTEX_SIZE];
 
-    slice_read_fast(&vertexes_lump->data, i * VANILLA_VERTEX_SIZE,
-                                          VANILLA_VERTEX_SIZE,
+    slice_read_fast(&vertexes_lump->data, i * D2K_VANILLA_VERTEX_SIZE,
+                                          D2K_VANILLA_VERTEX_SIZE,
                                           (void *)vertex_data);
 
     v->x = LUMP_DATA_SHORT_TO_FIXED(vertex_data, 0);
@@ -99,8 +98,8 @@ bool d2k_map_loader_load_vertexes(D2KMapLoader *map_loader, Status *status) {
                                              GL_VERT_VERTEX_SIZE,
                                              (void *)vertex_data);
 
-        v->x = LUMP_DATA_INT_TO_FIXED(vertex_data, 0);
-        v->y = LUMP_DATA_INT_TO_FIXED(vertex_data, 4);
+        v->x = LUMP_DATA_FIXED(vertex_data, 0);
+        v->y = LUMP_DATA_FIXED(vertex_data, 4);
       }
     }
   }
@@ -0,0 +1,311 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "d2k/patch.h"
+#include "d2k/wad.h"
+
+#define malformed_patch_header(status) status_error( \
+  status,                                            \
+  "d2k_patch",                                       \
+  D2K_PATCH_MALFORMED_HEADER,                        \
+  "malformed patch header"                           \
+)
+
+#define malformed_patch_column(status) status_error( \
+  status,                                            \
+  "d2k_patch",                                       \
+  D2K_PATCH_MALFORMED_COLUMN,                        \
+  "malformed patch column"                           \
+)
+
+#define PATCH_HEADER_SIZE 8
+#define POST_END          0xFF
+
+static inline void masked_copy(uint8_t *dest, uint8_t *dest_mask,
+                                              const uint8_t *src,
+                                              const uint8_t *src_mask,
+                                              size_t count) {
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  for (; (i + 32) <= count; i += 32) {
+    __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+    __m256i m = _mm256_loadu_si256((const __m256i *)(src_mask + i));
+    __m256i d = _mm256_loadu_si256((const __m256i *)(dest + i));
+
+    _mm256_storeu_si256((__m256i *)(dest + i), _mm256_blendv_epi8(d, s, m));
+
+    if (dest_mask) {
+      __m256i dm = _mm256_loadu_si256((const __m256i *)(dest_mask + i));
+
+      _mm256_storeu_si256((__m256i *)(dest_mask + i), _mm256_or_si256(dm, m));
+    }
+  }
+#endif
+
+#if defined(__SSE2__)
+  for (; (i + 16) <= count; i += 16) {
+    __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+    __m128i m = _mm_loadu_si128((const __m128i *)(src_mask + i));
+    __m128i d = _mm_loadu_si128((const __m128i *)(dest + i));
+
+    _mm_storeu_si128(
+      (__m128i *)(dest + i),
+      _mm_or_si128(_mm_and_si128(m, s), _mm_andnot_si128(m, d))
+    );
+
+    if (dest_mask) {
+      __m128i dm = _mm_loadu_si128((const __m128i *)(dest_mask + i));
+
+      _mm_storeu_si128((__m128i *)(dest_mask + i), _mm_or_si128(dm, m));
+    }
+  }
+#elif defined(__ARM_NEON)
+  for (; (i + 16) <= count; i += 16) {
+    uint8x16_t s = vld1q_u8(src + i);
+    uint8x16_t m = vld1q_u8(src_mask + i);
+    uint8x16_t d = vld1q_u8(dest + i);
+
+    vst1q_u8(dest + i, vbslq_u8(m, s, d));
+
+    if (dest_mask) {
+      vst1q_u8(dest_mask + i, vorrq_u8(vld1q_u8(dest_mask + i), m));
+    }
+  }
+#endif
+
+  for (; i < count; i++) {
+    uint8_t m = src_mask[i];
+
+    dest[i] = (uint8_t)((src[i] & m) | (dest[i] & ~m));
+
+    if (dest_mask) {
+      dest_mask[i] |= m;
+    }
+  }
+}
+
+bool d2k_patch_posts_init_from_lump(D2KPatchPosts *patch_posts,
+                                    D2KLump *lump,
+                                    Status *status) {
+  const uint8_t *data = (const uint8_t *)lump->data.data;
+  size_t len = lump->data.len;
+
+  array_init(&patch_posts->columns, sizeof(size_t));
+  array_init(&patch_posts->posts, sizeof(D2KPatchPost));
+
+  if (len < PATCH_HEADER_SIZE) {
+    return malformed_patch_header(status);
+  }
+
+  patch_posts->width = d2k_lump_data_int16(lump->data.data, 0);
+  patch_posts->height = d2k_lump_data_int16(lump->data.data, 2);
+  patch_posts->left_offset = d2k_lump_data_int16(lump->data.data, 4);
+  patch_posts->top_offset = d2k_lump_data_int16(lump->data.data, 6);
+  patch_posts->data = data;
+
+  if ((patch_posts->width < 0) || (patch_posts->height < 0) ||
+      (((len - PATCH_HEADER_SIZE) / 4) < (size_t)patch_posts->width)) {
+    return malformed_patch_header(status);
+  }
+
+  if (!array_ensure_capacity(&patch_posts->columns, patch_posts->width + 1,
+                                                    status)) {
+    return false;
+  }
+
+  for (int x = 0; x < patch_posts->width; x++) {
+    size_t offset = d2k_lump_data_uint32(lump->data.data,
+                                         PATCH_HEADER_SIZE + (x * 4));
+    int top = -1;
+
+    *(size_t *)array_append_fast(&patch_posts->columns) =
+      patch_posts->posts.len;
+
+    for (;;) {
+      D2KPatchPost *post = NULL;
+      int top_delta;
+
+      if (offset >= len) {
+        d2k_patch_posts_free(patch_posts);
+        return malformed_patch_column(status);
+      }
+
+      top_delta = data[offset];
+
+      if (top_delta == POST_END) {
+        break;
+      }
+
+      if (((len - offset) < 4) ||
+          ((len - offset - 3) < (size_t)data[offset + 1])) {
+        d2k_patch_posts_free(patch_posts);
+        return malformed_patch_column(status);
+      }
+
+      /* DeePsea tall patches: a non-increasing delta is relative */
+      if (top_delta <= top) {
+        top += top_delta;
+      }
+      else {
+        top = top_delta;
+      }
+
+      if (!array_append(&patch_posts->posts, (void **)&post, status)) {
+        d2k_patch_posts_free(patch_posts);
+        return false;
+      }
+
+      post->top = (uint32_t)top;
+      post->length = data[offset + 1];
+      post->offset = offset + 3;
+
+      offset += post->length + 4;
+    }
+  }
+
+  *(size_t *)array_append_fast(&patch_posts->columns) = patch_posts->posts.len;
+
+  return status_ok(status);
+}
+
+void d2k_patch_posts_free(D2KPatchPosts *patch_posts) {
+  array_free(&patch_posts->columns);
+  array_free(&patch_posts->posts);
+}
+
+bool d2k_patch_bitmap_init_from_posts(D2KPatchBitmap *patch_bitmap,
+                                      D2KPatchPosts *patch_posts,
+                                      Status *status) {
+  size_t area;
+  uint8_t *buf = NULL;
+  int height = patch_posts->height;
+
+  for (size_t i = 0; i < patch_posts->posts.len; i++) {
+    D2KPatchPost *post = array_index_fast(&patch_posts->posts, i);
+
+    if ((int)(post->top + post->length) > height) {
+      height = (int)(post->top + post->length);
+    }
+  }
+
+  area = (size_t)patch_posts->width * (size_t)height;
+
+  if (!d2k_calloc((void **)&buf, area ? area * 2 : 1, sizeof(uint8_t),
+                                                      status)) {
+    return false;
+  }
+
+  patch_bitmap->width = patch_posts->width;
+  patch_bitmap->height = height;
+  patch_bitmap->left_offset = patch_posts->left_offset;
+  patch_bitmap->top_offset = patch_posts->top_offset;
+  patch_bitmap->pixels = buf;
+  patch_bitmap->mask = buf + area;
+
+  for (int x = 0; x < patch_posts->width; x++) {
+    size_t start = d2k_patch_posts_column_start(patch_posts, x);
+    size_t end = d2k_patch_posts_column_end(patch_posts, x);
+    size_t column = (size_t)x * (size_t)height;
+
+    for (size_t i = start; i < end; i++) {
+      D2KPatchPost *post = array_index_fast(&patch_posts->posts, i);
+
+      cbmemmove(patch_bitmap->pixels + column + post->top,
+                patch_posts->data + post->offset,
+                post->length);
+      memset(patch_bitmap->mask + column + post->top, 0xFF, post->length);
+    }
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_patch_bitmap_init_from_lump(D2KPatchBitmap *patch_bitmap,
+                                     D2KLump *lump,
+                                     Status *status) {
+  D2KPatchPosts patch_posts;
+  bool res;
+
+  if (!d2k_patch_posts_init_from_lump(&patch_posts, lump, status)) {
+    return false;
+  }
+
+  res = d2k_patch_bitmap_init_from_posts(patch_bitmap, &patch_posts, status);
+
+  d2k_patch_posts_free(&patch_posts);
+
+  return res;
+}
+
+void d2k_patch_bitmap_free(D2KPatchBitmap *patch_bitmap) {
+  d2k_free(patch_bitmap->pixels);
+  patch_bitmap->pixels = NULL;
+  patch_bitmap->mask = NULL;
+}
+
+void d2k_patch_bitmap_blit(const D2KPatchBitmap *patch_bitmap,
+                           uint8_t *dest_pixels,
+                           uint8_t *dest_mask,
+                           int dest_width,
+                           int dest_height,
+                           int x,
+                           int y) {
+  int x1 = x < 0 ? 0 : x;
+  int x2 = x + patch_bitmap->width;
+  int y1 = y < 0 ? 0 : y;
+  int y2 = y + patch_bitmap->height;
+
+  if (x2 > dest_width) {
+    x2 = dest_width;
+  }
+
+  if (y2 > dest_height) {
+    y2 = dest_height;
+  }
+
+  if ((x1 >= x2) || (y1 >= y2)) {
+    return;
+  }
+
+  for (int dx = x1; dx < x2; dx++) {
+    size_t src_offset = ((size_t)(dx - x) * (size_t)patch_bitmap->height) +
+                        (size_t)(y1 - y);
+    size_t dest_offset = ((size_t)dx * (size_t)dest_height) + (size_t)y1;
+
+    masked_copy(dest_pixels + dest_offset,
+                dest_mask ? dest_mask + dest_offset : NULL,
+                patch_bitmap->pixels + src_offset,
+                patch_bitmap->mask + src_offset,
+                (size_t)(y2 - y1));
+  }
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,341 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+#include "d2k/divline.h"
+#include "d2k/fixed_vertex.h"
+#include "d2k/map.h"
+#include "d2k/map_blockmap.h"
+#include "d2k/map_linedefs.h"
+#include "d2k/path_traversal.h"
+#include "d2k/stamp_table.h"
+
+/* Vanilla stops stepping after this many blocks; long traces are cut short */
+#define MAX_BLOCK_STEPS 64
+
+/* P_PointOnLineSide */
+static inline int point_on_line_side(D2KLinedef *line, D2KFixedPoint x,
+                                                       D2KFixedPoint y) {
+  if (!line->dx) {
+    return x <= line->v1->x ? line->dy > 0 : line->dy < 0;
+  }
+
+  if (!line->dy) {
+    return y <= line->v1->y ? line->dx < 0 : line->dx > 0;
+  }
+
+  return d2k_fixed_mul(y - line->v1->y, line->dx >> FRACBITS) >=
+         d2k_fixed_mul(line->dy >> FRACBITS, x - line->v1->x);
+}
+
+/* PIT_AddLineIntercepts; returns false for an early out */
+static bool add_line_intercept(D2KPathTraversal *traversal, D2KLinedef *line,
+                                                            int flags) {
+  D2KDivline *trace = &traversal->trace;
+  D2KDivline line_divline;
+  D2KIntercept *intercept;
+  D2KFixedPoint frac;
+  int s1;
+  int s2;
+
+  /* Each test is imprecise at a different scale */
+  if (trace->dx > FRACUNIT * 16 || trace->dy > FRACUNIT * 16 ||
+      trace->dx < -FRACUNIT * 16 || trace->dy < -FRACUNIT * 16) {
+    s1 = d2k_divline_point_on_side(trace, line->v1->x, line->v1->y);
+    s2 = d2k_divline_point_on_side(trace, line->v2->x, line->v2->y);
+  }
+  else {
+    s1 = point_on_line_side(line, trace->x, trace->y);
+    s2 = point_on_line_side(line, trace->x + trace->dx,
+                                  trace->y + trace->dy);
+  }
+
+  if (s1 == s2) {
+    return true;
+  }
+
+  line_divline.x = line->v1->x;
+  line_divline.y = line->v1->y;
+  line_divline.dx = line->dx;
+  line_divline.dy = line->dy;
+
+  frac = d2k_divline_intercept(trace, &line_divline);
+
+  /*
+   * Behind the start, or past the end; vanilla collects the latter but never
+   * hands them to a traverser.
+   */
+  if (frac < 0 || frac > FRACUNIT) {
+    return true;
+  }
+
+  if ((flags & D2K_PATH_TRAVERSE_EARLY_OUT) &&
+      frac < FRACUNIT &&
+      !line->back_side) {
+    return false;
+  }
+
+  /* Lines are only added once per trace, so capacity is never exceeded */
+  intercept = array_append_fast(&traversal->intercepts);
+  intercept->frac = frac;
+  intercept->type = D2K_INTERCEPT_LINE;
+  intercept->d.line = line;
+
+  return true;
+}
+
+/* P_BlockLinesIterator with PIT_AddLineIntercepts */
+static bool add_block_lines(D2KPathTraversal *traversal, int block_x,
+                                                         int block_y,
+                                                         int flags) {
+  D2KMap *map = traversal->map;
+  D2KBlockmap *bmap = &map->blockmap;
+  Array *block;
+
+  if (block_x < 0 || block_y < 0 ||
+      (size_t)block_x >= bmap->width || (size_t)block_y >= bmap->height) {
+    return true;
+  }
+
+  block = array_index_fast(&bmap->blocks,
+                           ((size_t)block_y * bmap->width) + (size_t)block_x);
+
+  for (size_t i = 0; i < block->len; i++) {
+    size_t line_index = *(size_t *)array_index_fast(block, i);
+
+    if (line_index >= map->linedefs.len) {
+      continue;
+    }
+
+    if (!d2k_stamp_table_mark(&traversal->checked_lines, line_index)) {
+      continue;
+    }
+
+    if (!add_line_intercept(traversal,
+                            array_index_fast(&map->linedefs, line_index),
+                            flags)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*
+ * Intercepts are gathered block by block along the trace, so they arrive
+ * nearly sorted and insertion sort does very little work.  It's also stable,
+ * which keeps equal fractions in the order vanilla would visit them.
+ */
+static void sort_intercepts(Array *intercepts) {
+  D2KIntercept *base;
+
+  if (intercepts->len < 2) {
+    return;
+  }
+
+  base = array_index_fast(intercepts, 0);
+
+  for (size_t i = 1; i < intercepts->len; i++) {
+    D2KIntercept intercept = base[i];
+    size_t j = i;
+
+    while (j > 0 && base[j - 1].frac > intercept.frac) {
+      base[j] = base[j - 1];
+      j--;
+    }
+
+    base[j] = intercept;
+  }
+}
+
+bool d2k_path_traversal_init(D2KPathTraversal *traversal, D2KMap *map,
+                                                          Status *status) {
+  size_t line_count = map->linedefs.len;
+
+  traversal->map = map;
+  memset(&traversal->trace, 0, sizeof(D2KDivline));
+  array_init(&traversal->intercepts, sizeof(D2KIntercept));
+
+  if (!array_ensure_capacity(&traversal->intercepts, line_count, status)) {
+    return false;
+  }
+
+  if (!d2k_stamp_table_init(&traversal->checked_lines, line_count, status)) {
+    array_free(&traversal->intercepts);
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_path_traversal_free(D2KPathTraversal *traversal) {
+  array_free(&traversal->intercepts);
+  d2k_stamp_table_free(&traversal->checked_lines);
+  traversal->map = NULL;
+}
+
+/*
+ * P_PathTraverse's gathering half: step through the blockmap cells the trace
+ * passes through (a fixed-point DDA), collecting intercepts.  Returns false
+ * if D2K_PATH_TRAVERSE_EARLY_OUT hit a one-sided line.
+ */
+bool d2k_path_traversal_collect(D2KPathTraversal *traversal,
+                                D2KFixedPoint x1,
+                                D2KFixedPoint y1,
+                                D2KFixedPoint x2,
+                                D2KFixedPoint y2,
+                                int flags) {
+  D2KBlockmap *bmap = &traversal->map->blockmap;
+  D2KFixedPoint xt1;
+  D2KFixedPoint yt1;
+  D2KFixedPoint xt2;
+  D2KFixedPoint yt2;
+  D2KFixedPoint xstep;
+  D2KFixedPoint ystep;
+  D2KFixedPoint partial;
+  D2KFixedPoint xintercept;
+  D2KFixedPoint yintercept;
+  int mapx;
+  int mapy;
+  int mapxstep;
+  int mapystep;
+
+  d2k_stamp_table_next_pass(&traversal->checked_lines);
+  array_clear(&traversal->intercepts);
+
+  /* Don't start exactly on a block edge */
+  if (!((x1 - bmap->origin_x) & (MAPBLOCKSIZE - 1))) {
+    x1 += FRACUNIT;
+  }
+
+  if (!((y1 - bmap->origin_y) & (MAPBLOCKSIZE - 1))) {
+    y1 += FRACUNIT;
+  }
+
+  traversal->trace.x = x1;
+  traversal->trace.y = y1;
+  traversal->trace.dx = x2 - x1;
+  traversal->trace.dy = y2 - y1;
+
+  x1 -= bmap->origin_x;
+  y1 -= bmap->origin_y;
+  xt1 = x1 >> MAPBLOCKSHIFT;
+  yt1 = y1 >> MAPBLOCKSHIFT;
+
+  x2 -= bmap->origin_x;
+  y2 -= bmap->origin_y;
+  xt2 = x2 >> MAPBLOCKSHIFT;
+  yt2 = y2 >> MAPBLOCKSHIFT;
+
+  if (xt2 > xt1) {
+    mapxstep = 1;
+    partial = FRACUNIT - ((x1 >> MAPBTOFRAC) & (FRACUNIT - 1));
+    ystep = d2k_fixed_div(y2 - y1, abs(x2 - x1));
+  }
+  else if (xt2 < xt1) {
+    mapxstep = -1;
+    partial = (x1 >> MAPBTOFRAC) & (FRACUNIT - 1);
+    ystep = d2k_fixed_div(y2 - y1, abs(x2 - x1));
+  }
+  else {
+    mapxstep = 0;
+    partial = FRACUNIT;
+    ystep = 256 * FRACUNIT;
+  }
+
+  yintercept = (y1 >> MAPBTOFRAC) + d2k_fixed_mul(partial, ystep);
+
+  if (yt2 > yt1) {
+    mapystep = 1;
+    partial = FRACUNIT - ((y1 >> MAPBTOFRAC) & (FRACUNIT - 1));
+    xstep = d2k_fixed_div(x2 - x1, abs(y2 - y1));
+  }
+  else if (yt2 < yt1) {
+    mapystep = -1;
+    partial = (y1 >> MAPBTOFRAC) & (FRACUNIT - 1);
+    xstep = d2k_fixed_div(x2 - x1, abs(y2 - y1));
+  }
+  else {
+    mapystep = 0;
+    partial = FRACUNIT;
+    xstep = 256 * FRACUNIT;
+  }
+
+  xintercept = (x1 >> MAPBTOFRAC) + d2k_fixed_mul(partial, xstep);
+
+  mapx = xt1;
+  mapy = yt1;
+
+  for (size_t count = 0; count < MAX_BLOCK_STEPS; count++) {
+    if (flags & D2K_PATH_TRAVERSE_ADD_LINES) {
+      if (!add_block_lines(traversal, mapx, mapy, flags)) {
+        return false;
+      }
+    }
+
+    if (mapx == xt2 && mapy == yt2) {
+      break;
+    }
+
+    if ((yintercept >> FRACBITS) == mapy) {
+      yintercept += ystep;
+      mapx += mapxstep;
+    }
+    else if ((xintercept >> FRACBITS) == mapx) {
+      xintercept += xstep;
+      mapy += mapystep;
+    }
+  }
+
+  sort_intercepts(&traversal->intercepts);
+
+  return true;
+}
+
+/*
+ * P_PathTraverse: collect, then hand each intercept to `traverser` in order.
+ * Returns false if either the early out triggered or `traverser` asked to
+ * stop.
+ */
+bool d2k_path_traverse(D2KPathTraversal *traversal, D2KFixedPoint x1,
+                                                    D2KFixedPoint y1,
+                                                    D2KFixedPoint x2,
+                                                    D2KFixedPoint y2,
+                                                    int flags,
+                                                    D2KPathTraverser traverser,
+                                                    void *data) {
+  if (!d2k_path_traversal_collect(traversal, x1, y1, x2, y2, flags)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < traversal->intercepts.len; i++) {
+    D2KIntercept *intercept = array_index_fast(&traversal->intercepts, i);
+
+    if (!traverser(traversal, intercept, data)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* vi: set et ts=2 sw=2: */
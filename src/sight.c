@@ -0,0 +1,350 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include <math.h>
+
+#include "d2k/divline.h"
+#include "d2k/map.h"
+#include "d2k/map_linedefs.h"
+#include "d2k/map_nodes.h"
+#include "d2k/map_reject.h"
+#include "d2k/map_sectors.h"
+#include "d2k/map_segs.h"
+#include "d2k/map_subsectors.h"
+#include "d2k/sight.h"
+#include "d2k/stamp_table.h"
+
+/*
+ * `node_sides` entries pack the target stamp above the 2-bit side, so the
+ * stamp has to wrap before it reaches the top two bits.
+ */
+#define NODE_SIDE_BITS 2
+#define NODE_SIDE_MASK ((1 << NODE_SIDE_BITS) - 1)
+#define MAX_TARGET_STAMP (UINT32_MAX >> NODE_SIDE_BITS)
+
+static inline int node_divline_side(D2KFixedPoint x, D2KFixedPoint y,
+                                                     const D2KMapNode *node) {
+  D2KDivline line = {node->x, node->y, node->dx, node->dy};
+
+  return d2k_divline_side(&line, x, y);
+}
+
+static void begin_target(D2KSight *sight, const D2KSightActor *target) {
+  sight->target_stamp++;
+
+  if (sight->target_stamp > MAX_TARGET_STAMP) {
+    if (sight->node_sides.len) {
+      memset(array_index_fast(&sight->node_sides, 0), 0,
+             sight->node_sides.len * sizeof(uint32_t));
+    }
+
+    sight->target_stamp = 1;
+  }
+
+  sight->target_x = target->x;
+  sight->target_y = target->y;
+}
+
+static inline int target_side(D2KSight *sight, size_t node_index,
+                                               const D2KMapNode *node) {
+  uint32_t *entry = array_index_fast(&sight->node_sides, node_index);
+  int side;
+
+  if (((*entry) >> NODE_SIDE_BITS) == sight->target_stamp) {
+    return (*entry) & NODE_SIDE_MASK;
+  }
+
+  side = node_divline_side(sight->target_x, sight->target_y, node);
+  *entry = (sight->target_stamp << NODE_SIDE_BITS) | side;
+
+  return side;
+}
+
+static bool cross_subsector(D2KSight *sight, size_t subsector_index) {
+  D2KSubsector *subsector = array_index_fast(&sight->map->subsectors,
+                                             subsector_index);
+  D2KSegLine *ssline;
+
+  if (!subsector->ssline_count) {
+    return true;
+  }
+
+  ssline = array_index_fast(&sight->map->sslines, subsector->first_ssline);
+
+  for (size_t i = 0; i < subsector->ssline_count; i++, ssline++) {
+    D2KSector *front;
+    D2KSector *back;
+    D2KDivline line;
+    D2KFixedPoint open_top;
+    D2KFixedPoint open_bottom;
+    D2KFixedPoint frac;
+
+    if (!d2k_stamp_table_mark(&sight->checked_lines, ssline->linedef->id)) {
+      continue;
+    }
+
+    /* Both endpoints on the same side of the trace: not crossed */
+    if (d2k_divline_side(&sight->trace, ssline->x1, ssline->y1) ==
+        d2k_divline_side(&sight->trace, ssline->x2, ssline->y2)) {
+      continue;
+    }
+
+    line.x = ssline->x1;
+    line.y = ssline->y1;
+    line.dx = ssline->x2 - ssline->x1;
+    line.dy = ssline->y2 - ssline->y1;
+
+    /* Looker and target on the same side of the line: not crossed */
+    if (d2k_divline_side(&line, sight->trace.x, sight->trace.y) ==
+        d2k_divline_side(&line, sight->target_x, sight->target_y)) {
+      continue;
+    }
+
+    if (!(ssline->linedef->flags & D2K_LINEDEF_FLAG_TWO_SIDED)) {
+      return false;
+    }
+
+    front = ssline->seg->front_sector;
+    back = ssline->seg->back_sector;
+
+    if (!front || !back) {
+      return false;
+    }
+
+    if (front->floor_height == back->floor_height &&
+        front->ceiling_height == back->ceiling_height) {
+      continue;
+    }
+
+    open_top = front->ceiling_height < back->ceiling_height ?
+      front->ceiling_height :
+      back->ceiling_height;
+    open_bottom = front->floor_height > back->floor_height ?
+      front->floor_height :
+      back->floor_height;
+
+    /* Closed door */
+    if (open_bottom >= open_top) {
+      return false;
+    }
+
+    frac = d2k_divline_intercept(&sight->trace, &line);
+
+    if (front->floor_height != back->floor_height) {
+      D2KFixedPoint slope = d2k_fixed_div(open_bottom - sight->z_start, frac);
+
+      if (slope > sight->bottom_slope) {
+        sight->bottom_slope = slope;
+      }
+    }
+
+    if (front->ceiling_height != back->ceiling_height) {
+      D2KFixedPoint slope = d2k_fixed_div(open_top - sight->z_start, frac);
+
+      if (slope < sight->top_slope) {
+        sight->top_slope = slope;
+      }
+    }
+
+    if (sight->top_slope <= sight->bottom_slope) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*
+ * True if the trace can't touch anything inside `bbox`: either the boxes
+ * don't overlap, or all four corners are clearly on one side of the trace.
+ * This is only ever used to skip work, so it errs towards "might touch";
+ * the products are done in doubles (exact enough at map scale) to sidestep
+ * 64-bit overflow.
+ */
+static inline bool trace_misses_box(const D2KSight *sight,
+                                    const D2KFixedPoint *bbox) {
+  const D2KFixedPoint xs[2] = {bbox[BOXLEFT], bbox[BOXRIGHT]};
+  const D2KFixedPoint ys[2] = {bbox[BOXBOTTOM], bbox[BOXTOP]};
+  double dx = (double)sight->trace.dx;
+  double dy = (double)sight->trace.dy;
+  double margin = (fabs(dx) + fabs(dy)) * FRACUNIT;
+  int above = 0;
+  int below = 0;
+
+  if (bbox[BOXLEFT] > sight->bbox[BOXRIGHT] ||
+      bbox[BOXRIGHT] < sight->bbox[BOXLEFT] ||
+      bbox[BOXBOTTOM] > sight->bbox[BOXTOP] ||
+      bbox[BOXTOP] < sight->bbox[BOXBOTTOM]) {
+    return true;
+  }
+
+  for (size_t i = 0; i < 2; i++) {
+    for (size_t j = 0; j < 2; j++) {
+      double cross = (((double)xs[i] - sight->trace.x) * dy) -
+                     (((double)ys[j] - sight->trace.y) * dx);
+
+      if (cross > margin) {
+        above++;
+      }
+      else if (cross < -margin) {
+        below++;
+      }
+    }
+  }
+
+  return above == 4 || below == 4;
+}
+
+/*
+ * Walk only the nodes whose partition the trace actually crosses: if both
+ * ends are on one side, the other child can't contain anything in the way.
+ * Children whose bounding box the trace misses entirely are skipped too,
+ * which matters because partitions are infinite lines and so are crossed far
+ * more often than the regions they bound.
+ */
+static bool cross_bsp_node(D2KSight *sight, int child) {
+  while (!d2k_map_node_child_is_subsector(child)) {
+    D2KMapNode *node = array_index_fast(&sight->map->nodes, child);
+    int side = node_divline_side(sight->trace.x, sight->trace.y, node) & 1;
+
+    if (side == target_side(sight, (size_t)child, node)) {
+      child = node->children[side];
+      continue;
+    }
+
+    if (!trace_misses_box(sight, node->bbox[side]) &&
+        !cross_bsp_node(sight, node->children[side])) {
+      return false;
+    }
+
+    if (trace_misses_box(sight, node->bbox[side ^ 1])) {
+      return true;
+    }
+
+    child = node->children[side ^ 1];
+  }
+
+  return cross_subsector(sight, d2k_map_node_child_subsector(child));
+}
+
+static bool check(D2KSight *sight, const D2KSightActor *looker,
+                                   const D2KSightActor *target) {
+  D2KMap *map = sight->map;
+  D2KSector *looker_sector = looker->subsector->sector;
+  D2KSector *target_sector = target->subsector->sector;
+
+  /* REJECT has no row or column for the null sector */
+  if (map->reject.len                         &&
+      !d2k_map_sector_is_null(looker_sector)  &&
+      !d2k_map_sector_is_null(target_sector)  &&
+      d2k_map_reject_blocks(map, looker_sector->id, target_sector->id)) {
+    return false;
+  }
+
+  if (looker->subsector == target->subsector) {
+    return true;
+  }
+
+  d2k_stamp_table_next_pass(&sight->checked_lines);
+
+  sight->z_start = looker->z + looker->height - (looker->height >> 2);
+  sight->bottom_slope = target->z - sight->z_start;
+  sight->top_slope = sight->bottom_slope + target->height;
+
+  sight->trace.x = looker->x;
+  sight->trace.y = looker->y;
+  sight->trace.dx = target->x - looker->x;
+  sight->trace.dy = target->y - looker->y;
+
+  if (looker->x > target->x) {
+    sight->bbox[BOXRIGHT] = looker->x;
+    sight->bbox[BOXLEFT] = target->x;
+  }
+  else {
+    sight->bbox[BOXRIGHT] = target->x;
+    sight->bbox[BOXLEFT] = looker->x;
+  }
+
+  if (looker->y > target->y) {
+    sight->bbox[BOXTOP] = looker->y;
+    sight->bbox[BOXBOTTOM] = target->y;
+  }
+  else {
+    sight->bbox[BOXTOP] = target->y;
+    sight->bbox[BOXBOTTOM] = looker->y;
+  }
+
+  return cross_bsp_node(sight, (int)map->nodes.len - 1);
+}
+
+bool d2k_sight_init(D2KSight *sight, D2KMap *map, Status *status) {
+  memset(sight, 0, sizeof(D2KSight));
+
+  sight->map = map;
+
+  if (!d2k_stamp_table_init(&sight->checked_lines, map->linedefs.len,
+                                                   status)) {
+    return false;
+  }
+
+  array_init(&sight->node_sides, sizeof(uint32_t));
+
+  if (!array_set_size(&sight->node_sides, map->nodes.len, status)) {
+    d2k_stamp_table_free(&sight->checked_lines);
+    return false;
+  }
+
+  if (map->nodes.len) {
+    memset(array_index_fast(&sight->node_sides, 0), 0,
+           map->nodes.len * sizeof(uint32_t));
+  }
+
+  return status_ok(status);
+}
+
+void d2k_sight_free(D2KSight *sight) {
+  d2k_stamp_table_free(&sight->checked_lines);
+  array_free(&sight->node_sides);
+  sight->map = NULL;
+}
+
+bool d2k_sight_check(D2KSight *sight, const D2KSightActor *looker,
+                                      const D2KSightActor *target) {
+  begin_target(sight, target);
+
+  return check(sight, looker, target);
+}
+
+void d2k_sight_check_many(D2KSight *sight, const D2KSightActor *lookers,
+                                           size_t looker_count,
+                                           const D2KSightActor *target,
+                                           bool *results) {
+  begin_target(sight, target);
+
+  for (size_t i = 0; i < looker_count; i++) {
+    results[i] = check(sight, &lookers[i], target);
+  }
+}
+
+/* vi: set et ts=2 sw=2: */
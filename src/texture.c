@@ -0,0 +1,696 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include <ctype.h>
+
+#include "d2k/patch.h"
+#include "d2k/texture.h"
+#include "d2k/wad.h"
+
+#define missing_pnames_lump(status) status_error( \
+  status,                                         \
+  "d2k_texture",                                  \
+  D2K_TEXTURE_MISSING_PNAMES_LUMP,                \
+  "missing PNAMES lump"                           \
+)
+
+#define missing_texture1_lump(status) status_error( \
+  status,                                           \
+  "d2k_texture",                                    \
+  D2K_TEXTURE_MISSING_TEXTURE1_LUMP,                \
+  "missing TEXTURE1 lump"                           \
+)
+
+#define malformed_pnames_lump(status) status_error( \
+  status,                                           \
+  "d2k_texture",                                    \
+  D2K_TEXTURE_MALFORMED_PNAMES_LUMP,                \
+  "malformed PNAMES lump"                           \
+)
+
+#define malformed_texture_lump(status) status_error( \
+  status,                                            \
+  "d2k_texture",                                     \
+  D2K_TEXTURE_MALFORMED_TEXTURE_LUMP,                \
+  "malformed TEXTURE1/TEXTURE2 lump"                 \
+)
+
+#define invalid_patch_index(status) status_error( \
+  status,                                         \
+  "d2k_texture",                                  \
+  D2K_TEXTURE_INVALID_PATCH_INDEX,                \
+  "texture references invalid patch index"        \
+)
+
+#define texture_not_found(status) status_error( \
+  status,                                       \
+  "d2k_texture",                                \
+  D2K_TEXTURE_NOT_FOUND,                        \
+  "texture not found"                           \
+)
+
+#define PNAMES_HEADER_SIZE         4
+#define PNAMES_NAME_SIZE           8
+#define TEXTURE_LUMP_HEADER_SIZE   4
+#define MAP_TEXTURE_HEADER_SIZE   22
+#define MAP_PATCH_SIZE            10
+
+static size_t get_texture_hash(const void *key, size_t seed) {
+  return hash32(key, strlen((const char *)key), seed);
+}
+
+static void* get_texture_key(const void *obj) {
+  return (void *)((D2KTexture *)obj)->name;
+}
+
+static bool texture_names_equal(const void *key1, const void *key2) {
+  return strcmp((const char *)key1, (const char *)key2) == 0;
+}
+
+static inline void copy_name(char *dest, const char *src) {
+  size_t i;
+
+  for (i = 0; i < 8 && src[i]; i++) {
+    dest[i] = toupper((unsigned char)src[i]);
+  }
+
+  for (; i < 9; i++) {
+    dest[i] = '\0';
+  }
+}
+
+static bool load_patch_lumps(D2KTextureTable *texture_table, Status *status) {
+  D2KLump *pnames_lump = NULL;
+  int32_t patch_count;
+
+  if (!d2k_lump_directory_lookup(texture_table->lump_directory, "PNAMES",
+                                                                &pnames_lump,
+                                                                status)) {
+    if (status_match(status, "base", ERROR_NOT_FOUND)) {
+      status_clear(status);
+      return missing_pnames_lump(status);
+    }
+
+    return false;
+  }
+
+  if (pnames_lump->data.len < PNAMES_HEADER_SIZE) {
+    return malformed_pnames_lump(status);
+  }
+
+  patch_count = d2k_lump_data_int32(pnames_lump->data.data, 0);
+
+  if ((patch_count < 0) ||
+      (((pnames_lump->data.len - PNAMES_HEADER_SIZE) / PNAMES_NAME_SIZE) <
+       (size_t)patch_count)) {
+    return malformed_pnames_lump(status);
+  }
+
+  if (!array_ensure_capacity(&texture_table->patch_lumps, patch_count,
+                                                          status)) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < patch_count; i++) {
+    D2KLump **patch_lump = array_append_fast(&texture_table->patch_lumps);
+    char patch_name[9];
+
+    copy_name(
+      patch_name,
+      pnames_lump->data.data + PNAMES_HEADER_SIZE + (i * PNAMES_NAME_SIZE)
+    );
+
+    *patch_lump = NULL;
+
+    /*
+     * Missing patches are tolerated here, and skipped when compositing, the
+     * same way PrBoom+ warns and carries on.
+     */
+    if (!d2k_lump_directory_lookup(texture_table->lump_directory,
+                                   patch_name,
+                                   patch_lump,
+                                   status)) {
+      if (!status_match(status, "base", ERROR_NOT_FOUND)) {
+        return false;
+      }
+
+      *patch_lump = NULL;
+      status_clear(status);
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool load_texture_lump(D2KTextureTable *texture_table,
+                              D2KLump *texture_lump,
+                              Status *status) {
+  const char *data = texture_lump->data.data;
+  size_t len = texture_lump->data.len;
+  int32_t texture_count;
+
+  if (len < TEXTURE_LUMP_HEADER_SIZE) {
+    return malformed_texture_lump(status);
+  }
+
+  texture_count = d2k_lump_data_int32(data, 0);
+
+  if ((texture_count < 0) ||
+      (((len - TEXTURE_LUMP_HEADER_SIZE) / 4) < (size_t)texture_count)) {
+    return malformed_texture_lump(status);
+  }
+
+  if (!array_ensure_capacity(&texture_table->textures,
+                             texture_table->textures.len + texture_count,
+                             status)) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < texture_count; i++) {
+    D2KTexture *texture = NULL;
+    int32_t offset = d2k_lump_data_int32(data, 4 + (i * 4));
+    size_t patch_count;
+    uint32_t width_mask = 1;
+
+    if ((offset < 0) || ((size_t)offset > len) ||
+        ((len - offset) < MAP_TEXTURE_HEADER_SIZE)) {
+      return malformed_texture_lump(status);
+    }
+
+    patch_count = (size_t)d2k_lump_data_uint16(data, offset + 20);
+
+    if (((len - offset - MAP_TEXTURE_HEADER_SIZE) / MAP_PATCH_SIZE) <
+        patch_count) {
+      return malformed_texture_lump(status);
+    }
+
+    texture = array_append_fast(&texture_table->textures);
+    array_init(&texture->patches, sizeof(D2KPatch));
+    texture->index = texture_table->textures.len - 1;
+    copy_name(texture->name, data + offset);
+    texture->masked = d2k_lump_data_int32(data, offset + 8) != 0;
+    texture->width = d2k_lump_data_int16(data, offset + 12);
+    texture->height = d2k_lump_data_int16(data, offset + 14);
+
+    if ((texture->width < 0) || (texture->height < 0)) {
+      return malformed_texture_lump(status);
+    }
+
+    if (!array_ensure_capacity(&texture->patches, patch_count, status)) {
+      return false;
+    }
+
+    for (size_t j = 0; j < patch_count; j++) {
+      D2KPatch *patch = array_append_fast(&texture->patches);
+      size_t patch_offset = offset + MAP_TEXTURE_HEADER_SIZE +
+                            (j * MAP_PATCH_SIZE);
+
+      patch->origin_x = d2k_lump_data_int16(data, patch_offset);
+      patch->origin_y = d2k_lump_data_int16(data, patch_offset + 2);
+      patch->patch = d2k_lump_data_int16(data, patch_offset + 4);
+
+      if ((patch->patch < 0) ||
+          ((size_t)patch->patch >= texture_table->patch_lumps.len)) {
+        return invalid_patch_index(status);
+      }
+    }
+
+    while ((width_mask * 2) <= (uint32_t)texture->width) {
+      width_mask <<= 1;
+    }
+
+    texture->width_mask = width_mask - 1;
+  }
+
+  return status_ok(status);
+}
+
+static bool load_textures(D2KTextureTable *texture_table, Status *status) {
+  D2KLump *texture_lump = NULL;
+
+  if (!d2k_lump_directory_lookup(texture_table->lump_directory, "TEXTURE1",
+                                                                &texture_lump,
+                                                                status)) {
+    if (status_match(status, "base", ERROR_NOT_FOUND)) {
+      status_clear(status);
+      return missing_texture1_lump(status);
+    }
+
+    return false;
+  }
+
+  if (!load_texture_lump(texture_table, texture_lump, status)) {
+    return false;
+  }
+
+  if (!d2k_lump_directory_lookup(texture_table->lump_directory, "TEXTURE2",
+                                                                &texture_lump,
+                                                                status)) {
+    if (!status_match(status, "base", ERROR_NOT_FOUND)) {
+      return false;
+    }
+
+    status_clear(status);
+    return status_ok(status);
+  }
+
+  return load_texture_lump(texture_table, texture_lump, status);
+}
+
+static bool build_lookup(D2KTextureTable *texture_table, Status *status) {
+  /*
+   * Later definitions win (TEXTURE2 overrides TEXTURE1, as in PrBoom+), so
+   * walk backwards and only index the first occurrence of each name.
+   */
+  for (size_t i = texture_table->textures.len; i > 0; i--) {
+    D2KTexture *texture = array_index_fast(&texture_table->textures, i - 1);
+    D2KTexture *existing = NULL;
+
+    if (table_lookup(&texture_table->lookup, (void *)texture->name,
+                                             (void **)&existing,
+                                             status)) {
+      continue;
+    }
+
+    if (!status_match(status, "base", ERROR_NOT_FOUND)) {
+      return false;
+    }
+
+    status_clear(status);
+
+    if (!table_insert(&texture_table->lookup, (void *)texture, status)) {
+      return false;
+    }
+  }
+
+  return status_ok(status);
+}
+
+static bool init_composites(D2KTextureTable *texture_table, Status *status) {
+  if (!array_set_size(&texture_table->patch_bitmaps,
+                      texture_table->patch_lumps.len,
+                      status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < texture_table->patch_bitmaps.len; i++) {
+    D2KPatchBitmap *patch_bitmap = array_index_fast(
+      &texture_table->patch_bitmaps,
+      i
+    );
+
+    patch_bitmap->pixels = NULL;
+    patch_bitmap->mask = NULL;
+  }
+
+  if (!array_set_size(&texture_table->composites,
+                      texture_table->textures.len,
+                      status)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < texture_table->composites.len; i++) {
+    D2KTextureComposite *composite = array_index_fast(
+      &texture_table->composites,
+      i
+    );
+
+    composite->pixels = NULL;
+    composite->mask = NULL;
+    composite->size = 0;
+    composite->lru_prev = D2K_TEXTURE_CACHE_NONE;
+    composite->lru_next = D2K_TEXTURE_CACHE_NONE;
+  }
+
+  return status_ok(status);
+}
+
+static inline D2KTextureComposite* get_composite(
+    D2KTextureTable *texture_table,
+    size_t texture_index) {
+  return array_index_fast(&texture_table->composites, texture_index);
+}
+
+static void lru_unlink(D2KTextureTable *texture_table, size_t texture_index) {
+  D2KTextureComposite *composite = get_composite(texture_table, texture_index);
+
+  if (composite->lru_prev != D2K_TEXTURE_CACHE_NONE) {
+    get_composite(texture_table, composite->lru_prev)->lru_next =
+      composite->lru_next;
+  }
+  else {
+    texture_table->lru_head = composite->lru_next;
+  }
+
+  if (composite->lru_next != D2K_TEXTURE_CACHE_NONE) {
+    get_composite(texture_table, composite->lru_next)->lru_prev =
+      composite->lru_prev;
+  }
+  else {
+    texture_table->lru_tail = composite->lru_prev;
+  }
+
+  composite->lru_prev = D2K_TEXTURE_CACHE_NONE;
+  composite->lru_next = D2K_TEXTURE_CACHE_NONE;
+}
+
+static void lru_push_front(D2KTextureTable *texture_table,
+                           size_t texture_index) {
+  D2KTextureComposite *composite = get_composite(texture_table, texture_index);
+
+  composite->lru_prev = D2K_TEXTURE_CACHE_NONE;
+  composite->lru_next = texture_table->lru_head;
+
+  if (texture_table->lru_head != D2K_TEXTURE_CACHE_NONE) {
+    get_composite(texture_table, texture_table->lru_head)->lru_prev =
+      texture_index;
+  }
+  else {
+    texture_table->lru_tail = texture_index;
+  }
+
+  texture_table->lru_head = texture_index;
+}
+
+static void evict(D2KTextureTable *texture_table, size_t texture_index) {
+  D2KTextureComposite *composite = get_composite(texture_table, texture_index);
+
+  lru_unlink(texture_table, texture_index);
+
+  texture_table->cache_size -= composite->size;
+
+  d2k_free(composite->pixels);
+  composite->pixels = NULL;
+  composite->mask = NULL;
+  composite->size = 0;
+}
+
+static inline size_t get_patch_bitmap_size(D2KPatchBitmap *patch_bitmap) {
+  return ((size_t)patch_bitmap->width * (size_t)patch_bitmap->height) * 2;
+}
+
+static void release_patch_bitmaps(D2KTextureTable *texture_table) {
+  for (size_t i = 0; i < texture_table->patch_bitmaps.len; i++) {
+    D2KPatchBitmap *patch_bitmap = array_index_fast(
+      &texture_table->patch_bitmaps,
+      i
+    );
+
+    if (patch_bitmap->pixels) {
+      texture_table->cache_size -= get_patch_bitmap_size(patch_bitmap);
+      d2k_patch_bitmap_free(patch_bitmap);
+    }
+  }
+}
+
+/*
+ * Decoded patches are only needed to build composites, so they go before any
+ * composite does.
+ */
+static void shrink_cache(D2KTextureTable *texture_table, size_t needed) {
+  if ((texture_table->cache_size + needed) > texture_table->cache_budget) {
+    release_patch_bitmaps(texture_table);
+  }
+
+  while ((texture_table->lru_tail != D2K_TEXTURE_CACHE_NONE) &&
+         ((texture_table->cache_size + needed) > texture_table->cache_budget)) {
+    evict(texture_table, texture_table->lru_tail);
+  }
+}
+
+static bool get_patch_bitmap(D2KTextureTable *texture_table,
+                             size_t patch_index,
+                             D2KPatchBitmap **patch_bitmap,
+                             Status *status) {
+  D2KLump **patch_lump = array_index_fast(&texture_table->patch_lumps,
+                                          patch_index);
+  D2KPatchBitmap *pb = array_index_fast(&texture_table->patch_bitmaps,
+                                        patch_index);
+
+  if (!(*patch_lump)) {
+    *patch_bitmap = NULL;
+    return status_ok(status);
+  }
+
+  if (!pb->pixels) {
+    if (!d2k_patch_bitmap_init_from_lump(pb, *patch_lump, status)) {
+      return false;
+    }
+
+    texture_table->cache_size += get_patch_bitmap_size(pb);
+  }
+
+  *patch_bitmap = pb;
+
+  return status_ok(status);
+}
+
+static bool build_composite(D2KTextureTable *texture_table,
+                            D2KTexture *texture,
+                            D2KTextureComposite *composite,
+                            Status *status) {
+  size_t area = (size_t)texture->width * (size_t)texture->height;
+  uint8_t *buf = NULL;
+
+  if (!d2k_calloc((void **)&buf, area ? area * 2 : 1, sizeof(uint8_t),
+                                                      status)) {
+    return false;
+  }
+
+  composite->pixels = buf;
+  composite->mask = buf + area;
+  composite->size = area * 2;
+
+  for (size_t i = 0; i < texture->patches.len; i++) {
+    D2KPatch *patch = array_index_fast(&texture->patches, i);
+    D2KPatchBitmap *patch_bitmap = NULL;
+
+    if (!get_patch_bitmap(texture_table, (size_t)patch->patch, &patch_bitmap,
+                                                               status)) {
+      d2k_free(buf);
+      composite->pixels = NULL;
+      composite->mask = NULL;
+      composite->size = 0;
+      return false;
+    }
+
+    /* Missing patches are skipped */
+    if (!patch_bitmap) {
+      continue;
+    }
+
+    d2k_patch_bitmap_blit(patch_bitmap, composite->pixels,
+                                        composite->mask,
+                                        texture->width,
+                                        texture->height,
+                                        patch->origin_x,
+                                        patch->origin_y);
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_texture_table_init(D2KTextureTable *texture_table,
+                            D2KLumpDirectory *lump_directory,
+                            Status *status) {
+  texture_table->lump_directory = lump_directory;
+  texture_table->cache_budget = D2K_TEXTURE_CACHE_DEFAULT_BUDGET;
+  texture_table->cache_size = 0;
+  texture_table->lru_head = D2K_TEXTURE_CACHE_NONE;
+  texture_table->lru_tail = D2K_TEXTURE_CACHE_NONE;
+
+  array_init(&texture_table->patch_lumps, sizeof(D2KLump *));
+  array_init(&texture_table->patch_bitmaps, sizeof(D2KPatchBitmap));
+  array_init(&texture_table->textures, sizeof(D2KTexture));
+  array_init(&texture_table->composites, sizeof(D2KTextureComposite));
+
+  if (!table_init(&texture_table->lookup, get_texture_hash,
+                                          get_texture_key,
+                                          texture_names_equal,
+                                          0,
+                                          status)) {
+    return false;
+  }
+
+  if (!(load_patch_lumps(texture_table, status) &&
+        load_textures(texture_table, status)    &&
+        build_lookup(texture_table, status)     &&
+        init_composites(texture_table, status))) {
+    d2k_texture_table_free(texture_table);
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+void d2k_texture_table_free(D2KTextureTable *texture_table) {
+  d2k_texture_table_flush_cache(texture_table);
+
+  for (size_t i = 0; i < texture_table->textures.len; i++) {
+    D2KTexture *texture = array_index_fast(&texture_table->textures, i);
+
+    array_free(&texture->patches);
+  }
+
+  array_free(&texture_table->textures);
+  array_free(&texture_table->patch_lumps);
+  array_free(&texture_table->patch_bitmaps);
+  array_free(&texture_table->composites);
+  table_free(&texture_table->lookup);
+}
+
+void d2k_texture_table_set_cache_budget(D2KTextureTable *texture_table,
+                                        size_t cache_budget) {
+  texture_table->cache_budget = cache_budget;
+  shrink_cache(texture_table, 0);
+}
+
+void d2k_texture_table_flush_cache(D2KTextureTable *texture_table) {
+  while (texture_table->lru_tail != D2K_TEXTURE_CACHE_NONE) {
+    evict(texture_table, texture_table->lru_tail);
+  }
+
+  release_patch_bitmaps(texture_table);
+}
+
+bool d2k_texture_table_lookup(D2KTextureTable *texture_table,
+                              const char *texture_name,
+                              D2KTexture **texture,
+                              Status *status) {
+  char name[9];
+
+  /* "-" means "no texture", which is always texture 0 */
+  if (texture_name[0] == '-' && texture_name[1] == '\0') {
+    if (!texture_table->textures.len) {
+      return texture_not_found(status);
+    }
+
+    *texture = array_index_fast(&texture_table->textures, 0);
+    return status_ok(status);
+  }
+
+  copy_name(name, texture_name);
+
+  if (!table_lookup(&texture_table->lookup, (void *)name, (void **)texture,
+                                                          status)) {
+    if (status_match(status, "base", ERROR_NOT_FOUND)) {
+      status_clear(status);
+      return texture_not_found(status);
+    }
+
+    return false;
+  }
+
+  return status_ok(status);
+}
+
+bool d2k_texture_table_get_composite(D2KTextureTable *texture_table,
+                                     size_t texture_index,
+                                     D2KTextureComposite **composite,
+                                     Status *status) {
+  D2KTexture *texture = NULL;
+  D2KTextureComposite *tc = NULL;
+
+  if (texture_index >= texture_table->textures.len) {
+    return texture_not_found(status);
+  }
+
+  texture = array_index_fast(&texture_table->textures, texture_index);
+  tc = get_composite(texture_table, texture_index);
+
+  if (tc->pixels) {
+    if (texture_table->lru_head != texture_index) {
+      lru_unlink(texture_table, texture_index);
+      lru_push_front(texture_table, texture_index);
+    }
+
+    *composite = tc;
+    return status_ok(status);
+  }
+
+  shrink_cache(
+    texture_table,
+    ((size_t)texture->width * (size_t)texture->height) * 2
+  );
+
+  if (!build_composite(texture_table, texture, tc, status)) {
+    return false;
+  }
+
+  /*
+   * A composite larger than the whole budget is still handed out; it just
+   * becomes the first thing evicted.
+   */
+  lru_push_front(texture_table, texture_index);
+  texture_table->cache_size += tc->size;
+
+  /* The patches decoded while building may have pushed the cache over */
+  if (texture_table->cache_size > texture_table->cache_budget) {
+    release_patch_bitmaps(texture_table);
+  }
+
+  *composite = tc;
+
+  return status_ok(status);
+}
+
+bool d2k_texture_table_get_column(D2KTextureTable *texture_table,
+                                  size_t texture_index,
+                                  int column,
+                                  const uint8_t **pixels,
+                                  const uint8_t **mask,
+                                  Status *status) {
+  D2KTextureComposite *composite = NULL;
+  D2KTexture *texture = NULL;
+  size_t offset;
+
+  if (!d2k_texture_table_get_composite(texture_table, texture_index,
+                                                      &composite,
+                                                      status)) {
+    return false;
+  }
+
+  texture = array_index_fast(&texture_table->textures, texture_index);
+
+  if (texture->width <= 0) {
+    *pixels = composite->pixels;
+    *mask = composite->mask;
+    return status_ok(status);
+  }
+
+  column %= texture->width;
+
+  if (column < 0) {
+    column += texture->width;
+  }
+
+  offset = (size_t)column * (size_t)texture->height;
+
+  *pixels = composite->pixels + offset;
+  *mask = composite->mask + offset;
+
+  return status_ok(status);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,243 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "d2k/internal.h"
+
+#include "d2k/thinker.h"
+
+#define invalid_class(status) status_error( \
+  status,                                   \
+  "d2k_thinker",                            \
+  D2K_THINKER_INVALID_CLASS,                \
+  "invalid thinker class"                   \
+)
+
+static inline D2KThinkerPoolChunk* pool_chunk(D2KThinkerPool *pool,
+                                              size_t slot) {
+  return *(D2KThinkerPoolChunk **)array_index_fast(
+    &pool->chunks,
+    slot / D2K_THINKER_POOL_CHUNK_SIZE
+  );
+}
+
+static inline D2KThinker* pool_thinker(D2KThinkerPool *pool, size_t slot) {
+  D2KThinkerPoolChunk *chunk = pool_chunk(pool, slot);
+
+  return (D2KThinker *)(chunk->elements + (
+    (slot % D2K_THINKER_POOL_CHUNK_SIZE) * pool->element_size
+  ));
+}
+
+static inline uint8_t* pool_slot_state(D2KThinkerPool *pool, size_t slot) {
+  return &pool_chunk(pool, slot)->states[slot % D2K_THINKER_POOL_CHUNK_SIZE];
+}
+
+static bool pool_add_chunk(D2KThinkerPool *pool, Status *status) {
+  D2KThinkerPoolChunk *chunk = NULL;
+  D2KThinkerPoolChunk **entry = NULL;
+
+  if (!d2k_calloc((void **)&chunk, 1, sizeof(D2KThinkerPoolChunk), status)) {
+    return false;
+  }
+
+  if (!d2k_calloc((void **)&chunk->elements, D2K_THINKER_POOL_CHUNK_SIZE,
+                                             pool->element_size,
+                                             status)) {
+    d2k_free(chunk);
+    return false;
+  }
+
+  if (!array_append(&pool->chunks, (void **)&entry, status)) {
+    d2k_free(chunk->elements);
+    d2k_free(chunk);
+    return false;
+  }
+
+  *entry = chunk;
+
+  return status_ok(status);
+}
+
+static void pool_free(D2KThinkerPool *pool) {
+  for (size_t i = 0; i < pool->chunks.len; i++) {
+    D2KThinkerPoolChunk *chunk = *(D2KThinkerPoolChunk **)array_index_fast(
+      &pool->chunks, i
+    );
+
+    d2k_free(chunk->elements);
+    d2k_free(chunk);
+  }
+
+  array_free(&pool->chunks);
+  array_free(&pool->free_slots);
+}
+
+void d2k_thinker_runtime_init(D2KThinkerRuntime *runtime) {
+  array_init(&runtime->pools, sizeof(D2KThinkerPool));
+}
+
+void d2k_thinker_runtime_free(D2KThinkerRuntime *runtime) {
+  for (size_t i = 0; i < runtime->pools.len; i++) {
+    pool_free(array_index_fast(&runtime->pools, i));
+  }
+
+  array_free(&runtime->pools);
+}
+
+bool d2k_thinker_runtime_add_class(D2KThinkerRuntime *runtime,
+                                   size_t element_size,
+                                   size_t *class_id,
+                                   Status *status) {
+  D2KThinkerPool *pool = NULL;
+
+  if (element_size < sizeof(D2KThinker)) {
+    return invalid_class(status);
+  }
+
+  if (!array_append(&runtime->pools, (void **)&pool, status)) {
+    return false;
+  }
+
+  pool->element_size = element_size;
+  pool->slot_count = 0;
+  pool->live_count = 0;
+  pool->removed_count = 0;
+  array_init(&pool->chunks, sizeof(D2KThinkerPoolChunk *));
+  array_init(&pool->free_slots, sizeof(size_t));
+
+  *class_id = runtime->pools.len - 1;
+
+  return status_ok(status);
+}
+
+bool d2k_thinker_runtime_spawn(D2KThinkerRuntime *runtime, size_t class_id,
+                                                           void **thinker,
+                                                           Status *status) {
+  D2KThinkerPool *pool = NULL;
+  D2KThinker *new_thinker = NULL;
+  size_t slot;
+
+  if (class_id >= runtime->pools.len) {
+    return invalid_class(status);
+  }
+
+  pool = array_index_fast(&runtime->pools, class_id);
+
+  /* Reuse the most recently freed slot; it's the likeliest to be cached */
+  if (pool->free_slots.len) {
+    slot = *(size_t *)array_index_fast(&pool->free_slots,
+                                       pool->free_slots.len - 1);
+    array_truncate_fast(&pool->free_slots, pool->free_slots.len - 1);
+  }
+  else {
+    if ((pool->slot_count % D2K_THINKER_POOL_CHUNK_SIZE) == 0) {
+      if (!pool_add_chunk(pool, status)) {
+        return false;
+      }
+    }
+
+    slot = pool->slot_count++;
+  }
+
+  new_thinker = pool_thinker(pool, slot);
+  memset(new_thinker, 0, pool->element_size);
+  new_thinker->pool_class = class_id;
+  new_thinker->pool_slot = slot;
+
+  *pool_slot_state(pool, slot) = D2K_THINKER_SLOT_LIVE;
+  pool->live_count++;
+
+  *thinker = new_thinker;
+
+  return status_ok(status);
+}
+
+void d2k_thinker_runtime_remove(D2KThinkerRuntime *runtime,
+                                D2KThinker *thinker) {
+  D2KThinkerPool *pool = array_index_fast(&runtime->pools,
+                                          thinker->pool_class);
+  uint8_t *state = pool_slot_state(pool, thinker->pool_slot);
+
+  if (*state != D2K_THINKER_SLOT_LIVE) {
+    return;
+  }
+
+  *state = D2K_THINKER_SLOT_REMOVED;
+  pool->live_count--;
+  pool->removed_count++;
+}
+
+void d2k_thinker_runtime_run(D2KThinkerRuntime *runtime) {
+  for (size_t i = 0; i < runtime->pools.len; i++) {
+    D2KThinkerIterator iterator;
+    D2KThinker *thinker;
+
+    d2k_thinker_iterator_init(&iterator, runtime, i);
+
+    while ((thinker = d2k_thinker_iterator_next(&iterator))) {
+      if (thinker->function) {
+        thinker->function(thinker);
+      }
+    }
+  }
+}
+
+bool d2k_thinker_runtime_collect(D2KThinkerRuntime *runtime, Status *status) {
+  for (size_t i = 0; i < runtime->pools.len; i++) {
+    D2KThinkerPool *pool = array_index_fast(&runtime->pools, i);
+
+    if (!pool->removed_count) {
+      continue;
+    }
+
+    if (!array_ensure_capacity(&pool->free_slots,
+                               pool->free_slots.len + pool->removed_count,
+                               status)) {
+      return false;
+    }
+
+    /* Scanning the state bytes is cheap, and keeps removal allocation-free */
+    for (size_t slot = 0; slot < pool->slot_count; slot++) {
+      uint8_t *state = pool_slot_state(pool, slot);
+
+      if ((*state != D2K_THINKER_SLOT_REMOVED) ||
+          (pool_thinker(pool, slot)->references)) {
+        continue;
+      }
+
+      *state = D2K_THINKER_SLOT_FREE;
+      *(size_t *)array_append_fast(&pool->free_slots) = slot;
+      pool->removed_count--;
+    }
+  }
+
+  return status_ok(status);
+}
+
+size_t d2k_thinker_runtime_live_count(D2KThinkerRuntime *runtime,
+                                      size_t class_id) {
+  D2KThinkerPool *pool = array_index_fast(&runtime->pools, class_id);
+
+  return pool->live_count;
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -23,6 +23,8 @@
 #include <limits.h>
 
 #include "d2k/internal.h"
+#include "d2k/hash.h"
+#include "d2k/texture.h"
 #include "d2k/wad.h"
 
 #define too_small(status) status_error( \
@@ -177,6 +179,8 @@ static bool load_wad_lumps(D2KWad *wad, Status *status) {
     return too_small(status);
   }
 
+  wad->hash = d2k_hash(wad->data.data, wad->data.len, 0);
+
   if (!buffer_read(&wad->data, 0, sizeof(char) * 4, (void *)&identification[0],
                                                     status)) {
     return false;
@@ -227,7 +231,7 @@ static bool load_wad_lumps(D2KWad *wad, Status *status) {
   for (size_t i = 0; i < lump_count; i++) {
     int32_t  filepos;
     int32_t  size;
-    size_t   entry_start = info_table_offset + (i * 12);
+    size_t   entry_start = info_table_offset + (i * 16);
     size_t   lump_data_start;
     size_t   lump_data_len;
     D2KLump *lump = NULL;
@@ -379,6 +383,8 @@ bool d2k_lump_directory_init(D2KLumpDirectory *lump_directory,
                              Status *status) {
   size_t lump_count = 0;
 
+  lump_directory->texture_table = NULL;
+
   for (size_t i = 0; i < wads->len; i++) {
     D2KWad *wad = parray_index_fast(wads, i);
       
@@ -392,8 +398,8 @@ bool d2k_lump_directory_init(D2KLumpDirectory *lump_directory,
   for (size_t i = 0; i < wads->len; i++) {
     D2KWad *wad = parray_index_fast(wads, i);
 
-    for (size_t j = 0; j < wad->lumps.len; i++) {
-      D2KLump *lump = array_index_fast(&wad->lumps, i);
+    for (size_t j = 0; j < wad->lumps.len; j++) {
+      D2KLump *lump = array_index_fast(&wad->lumps, j);
 
       if (!parray_append(&lump_directory->lumps, (void *)lump, status)) {
         parray_free(&lump_directory->lumps);
@@ -451,7 +457,7 @@ bool d2k_lump_directory_init(D2KLumpDirectory *lump_directory,
     return false;
   }
 
-  if (!table_init(&lump_directory->lookups[0],
+  if (!table_init(&lump_directory->lookups[1],
                   get_lump_hash,
                   get_lump_key_from_name_and_ns,
                   lump_names_and_ns_equal,
@@ -515,11 +521,44 @@ bool d2k_lump_directory_lookup_texture(D2KLumpDirectory *lump_directory,
                                        const char *texture_name,
                                        struct D2KTextureStruct **texture,
                                        Status *status) {
-  (void)lump_directory;
-  (void)texture_name;
-  (void)texture;
+  /*
+   * The texture table is built on first use; plenty of consumers never need
+   * textures at all.
+   */
+  if (!lump_directory->texture_table) {
+    D2KTextureTable *texture_table = NULL;
+
+    if (!d2k_malloc((void **)&texture_table, 1, sizeof(D2KTextureTable),
+                                                status)) {
+      return false;
+    }
+
+    if (!d2k_texture_table_init(texture_table, lump_directory, status)) {
+      d2k_free(texture_table);
+      return false;
+    }
+
+    lump_directory->texture_table = texture_table;
+  }
+
+  return d2k_texture_table_lookup(lump_directory->texture_table, texture_name,
+                                                                 texture,
+                                                                 status);
+}
+
+void d2k_lump_directory_free(D2KLumpDirectory *lump_directory,
+                             Status *status) {
   (void)status;
 
-  return status_ok(status);
+  if (lump_directory->texture_table) {
+    d2k_texture_table_free(lump_directory->texture_table);
+    d2k_free(lump_directory->texture_table);
+    lump_directory->texture_table = NULL;
+  }
+
+  table_free(&lump_directory->lookups[0]);
+  table_free(&lump_directory->lookups[1]);
+  parray_free(&lump_directory->lumps);
 }
+
 /* vi: set et ts=2 sw=2: */
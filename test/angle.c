@@ -0,0 +1,94 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+void test_angle(void **state) {
+  Status status;
+  PArray wads;
+  D2KLumpDirectory lump_directory;
+  D2KFixedPoint finesine[SINE_COUNT];
+  D2KFixedPoint finecosine[COSINE_COUNT];
+  D2KFixedPoint finetangent[TANGENT_COUNT];
+  D2KAngle tantoangle[TANGENT_TO_ANGLE_COUNT];
+  const D2KAngle *builtin = d2k_tantoangle;
+  D2KFixedPoint dx[8];
+  D2KFixedPoint dy[8];
+  D2KAngle angles[8];
+
+  (void)state;
+
+  /* Known vanilla values */
+  assert_int_equal(d2k_finesine[0], 25);
+  assert_int_equal(d2k_finesine[1], 75);
+  assert_int_equal(d2k_finetangent[0], -170910304);
+  assert_int_equal(d2k_finetangent[1], -56965752);
+  assert_int_equal(d2k_tantoangle[0], 0);
+  assert_int_equal(d2k_tantoangle[SLOPERANGE], ANG45);
+
+  assert_int_equal(d2k_point_to_angle(builtin, 0, 0), 0);
+  assert_int_equal(d2k_point_to_angle(builtin, FRACUNIT, 0), 0);
+  assert_int_equal(d2k_point_to_angle(builtin, FRACUNIT, FRACUNIT),
+                   ANG45 - 1);
+  assert_int_equal(d2k_point_to_angle(builtin, 0, FRACUNIT), ANG90 - 1);
+  assert_int_equal(d2k_point_to_angle(builtin, -FRACUNIT, 0), ANG180 - 1);
+  assert_int_equal(d2k_point_to_angle(builtin, 0, -FRACUNIT), ANG270);
+  assert_int_equal(d2k_point_to_angle(builtin, FRACUNIT, -FRACUNIT),
+                   ANG270 + ANG45);
+  assert_int_equal(d2k_point_to_angle(builtin, 2 * FRACUNIT, -FRACUNIT),
+                   -d2k_tantoangle[1024]);
+
+  assert_ptr_equal(d2k_finecosine, &d2k_finesine[FINEANGLES / 4]);
+
+  /* Rising through the first quadrant, falling through the next two */
+  for (size_t i = 1; i < FINEANGLES / 4; i++) {
+    assert_true(d2k_finesine[i] >= d2k_finesine[i - 1]);
+    assert_true(d2k_finesine[i] <= FRACUNIT);
+  }
+
+  for (size_t i = (FINEANGLES / 4) + 1; i < (3 * FINEANGLES) / 4; i++) {
+    assert_true(d2k_finesine[i] <= d2k_finesine[i - 1]);
+  }
+
+  for (size_t i = 1; i < TANGENT_COUNT; i++) {
+    assert_true(d2k_finetangent[i] > d2k_finetangent[i - 1]);
+  }
+
+  for (size_t i = 1; i < TANGENT_TO_ANGLE_COUNT; i++) {
+    assert_true(d2k_tantoangle[i] > d2k_tantoangle[i - 1]);
+  }
+
+  /* Loaded tables (here, copies of the built-in ones) are used when passed */
+  status_init(&status);
+  parray_init(&wads);
+  assert_true(d2k_lump_directory_init(&lump_directory, &wads, &status));
+  assert_true(d2k_angle_load_trig_tables(&lump_directory, finesine,
+                                                          finecosine,
+                                                          finetangent,
+                                                          tantoangle,
+                                                          &status));
+  assert_int_equal(tantoangle[SLOPERANGE], ANG45);
+
+  tantoangle[0] = 1;
+  assert_int_equal(d2k_point_to_angle(tantoangle, FRACUNIT, 0), 1);
+
+  for (size_t i = 0; i < 8; i++) {
+    dx[i] = FRACUNIT;
+    dy[i] = 0;
+  }
+
+  d2k_fixed_batch_point_to_angle(angles, tantoangle, dx, dy, 8);
+
+  for (size_t i = 0; i < 8; i++) {
+    assert_int_equal(angles[i], 1);
+  }
+
+  /* Nothing else sees them */
+  assert_int_equal(d2k_point_to_angle(builtin, FRACUNIT, 0), 0);
+
+  d2k_lump_directory_free(&lump_directory, &status);
+  parray_free(&wads);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -1,6 +1,42 @@
 #ifndef D2K_TEST_H__
 #define D2K_TEST_H__
 
+/*
+ * A synthetic map of `width` x `height` square cells, one sector, subsector
+ * and blockmap block per cell, with a balanced BSP over them.  Every interior
+ * edge is a two-sided line; tests and benchmarks can then close lines or
+ * change sector heights to build whatever geometry they need.
+ */
+
+#define GRID_MAP_CELL_SIZE 128
+#define GRID_MAP_ACTOR_HEIGHT 56
+
+typedef struct GridMapStruct {
+  D2KMap map;
+  size_t width;
+  size_t height;
+} GridMap;
+
+bool grid_map_init(GridMap *grid, size_t width, size_t height,
+                                                Status *status);
+void grid_map_free(GridMap *grid);
+D2KSector* grid_map_sector(GridMap *grid, size_t x, size_t y);
+D2KLinedef* grid_map_vertical_line(GridMap *grid, size_t x, size_t y);
+D2KLinedef* grid_map_horizontal_line(GridMap *grid, size_t x, size_t y);
+
+/*
+ * Stretches the interior line along the left edge of cell (x, y0) up to row
+ * y1, and points the segs of the rows in between at it, the way a nodebuilder
+ * splits one linedef across several subsectors.  The lines those segs used
+ * are left in place but no longer referenced by any seg.
+ */
+bool grid_map_split_vertical_line(GridMap *grid, size_t x, size_t y0,
+                                                           size_t y1,
+                                                           Status *status);
+
+void grid_map_place_actor(GridMap *grid, D2KSightActor *actor, size_t x,
+                                                                size_t y);
+
 #endif
 
 /* vi: set et ts=2 sw=2: */
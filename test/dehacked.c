@@ -0,0 +1,182 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+#define STATE_COUNT 10
+#define INFO_COUNT  3
+
+static void a_look(void) {
+}
+
+static void a_chase(void) {
+}
+
+static const char *patch =
+  "Patch File for DeHackEd v3.0\n"
+  "# A comment\n"
+  "Doom version = 21\n"
+  "Patch format = 6\n"
+  "\n"
+  "Thing 2 (Imp)\r\n"
+  "Hit points = 300\r\n"
+  "Speed = 15\r\n"
+  "Bits = SOLID+SHOOTABLE | COUNTKILL\r\n"
+  "\n"
+  "Text 7 9\n"
+  "Thing 1Frame 1 \n"
+  "Frame 3\n"
+  "Duration = 12\n"
+  "Next frame = 4\n"
+  "\n"
+  "Pointer 2 (Frame 5)\n"
+  "Codep Frame = 1\n"
+  "\n"
+  "[CODEPTR]\n"
+  "FRAME 6 = Chase\n"
+  "FRAME 1 = NULL\n"
+  "\n"
+  "[STRINGS]\n"
+  "GOTARMOR = Thing 1\n"
+  "\n"
+  "[SPRITES]\n"
+  "SHTG = boss\n";
+
+void test_dehacked(void **state) {
+  D2KDehackedAction actions[] = {
+    { "Look",  a_look  },
+    { "Chase", a_chase },
+  };
+  Status status;
+  Array states;
+  Array infos;
+  Array sprite_names;
+  D2KDehackedBase base;
+  D2KDehackedCache cache;
+  D2KDehackedTables *tables = NULL;
+  D2KDehackedTables *again = NULL;
+  D2KDehackedTables *other = NULL;
+  D2KMapObjectState *base_state;
+  D2KMapObjectInfo *base_info;
+  const char *names[] = { "TROO", "SHTG", "PUNG" };
+
+  (void)state;
+
+  status_init(&status);
+
+  array_init(&states, sizeof(D2KMapObjectState));
+  array_init(&infos, sizeof(D2KMapObjectInfo));
+  array_init(&sprite_names, sizeof(D2KSpriteName));
+
+  for (size_t i = 0; i < STATE_COUNT; i++) {
+    D2KMapObjectState *s = NULL;
+
+    assert_true(array_append(&states, (void **)&s, &status));
+    memset(s, 0, sizeof(D2KMapObjectState));
+    s->tics = 1;
+    s->action = (i == 1) ? a_look : NULL;
+  }
+
+  for (size_t i = 0; i < INFO_COUNT; i++) {
+    D2KMapObjectInfo *info = NULL;
+
+    assert_true(array_append(&infos, (void **)&info, &status));
+    memset(info, 0, sizeof(D2KMapObjectInfo));
+    info->spawn_health = 60;
+  }
+
+  for (size_t i = 0; i < 3; i++) {
+    D2KSpriteName *sprite_name = NULL;
+
+    assert_true(array_append(&sprite_names, (void **)&sprite_name, &status));
+    strcpy(sprite_name->name, names[i]);
+  }
+
+  base.states = &states;
+  base.infos = &infos;
+  base.sprite_names = &sprite_names;
+  base.actions = actions;
+  base.action_count = 2;
+
+  d2k_dehacked_cache_init(&cache, &base);
+
+  assert_true(d2k_dehacked_cache_get(&cache, patch, strlen(patch), &tables,
+                                                                   &status));
+
+  /* Thing numbers are 1-based */
+  assert_int_equal(d2k_dehacked_info(tables, 1)->spawn_health, 300);
+  assert_int_equal(d2k_dehacked_info(tables, 1)->speed, 15);
+  assert_int_equal(d2k_dehacked_info(tables, 1)->flags,
+                   (1 << 1) | (1 << 2) | (1 << 22));
+  assert_int_equal(d2k_dehacked_info(tables, 0)->spawn_health, 60);
+
+  assert_int_equal(d2k_dehacked_state(tables, 3)->tics, 12);
+  assert_int_equal(d2k_dehacked_state(tables, 3)->next_state, 4);
+
+  /* Pointer copies frame 1's original action, even though BEX cleared it */
+  assert_true(d2k_dehacked_state(tables, 5)->action == a_look);
+  assert_true(d2k_dehacked_state(tables, 6)->action == a_chase);
+  assert_true(d2k_dehacked_state(tables, 1)->action == NULL);
+
+  assert_string_equal(d2k_dehacked_sprite_name(tables, 1)->name, "BOSS");
+  assert_string_equal(d2k_dehacked_sprite_name(tables, 0)->name, "TROO");
+
+  /* The base tables are untouched */
+  base_state = array_index_fast(&states, 3);
+  base_info = array_index_fast(&infos, 1);
+  assert_int_equal(base_state->tics, 1);
+  assert_int_equal(base_info->spawn_health, 60);
+  assert_string_equal(((D2KSpriteName *)array_index_fast(&sprite_names,
+                                                         1))->name, "SHTG");
+
+  /* Same bytes, same tables; different bytes, different tables */
+  assert_true(d2k_dehacked_cache_get(&cache, patch, strlen(patch), &again,
+                                                                   &status));
+  assert_ptr_equal(again, tables);
+  assert_true(d2k_dehacked_cache_get(&cache, "Thing 1\nMass = 5\n", 17,
+                                     &other, &status));
+  assert_true(other != tables);
+  assert_int_equal(d2k_dehacked_info(other, 0)->mass, 5);
+  assert_int_equal(d2k_dehacked_info(other, 1)->spawn_health, 60);
+  assert_int_equal(other->states.copied_page_count, 0);
+  assert_int_equal(cache.entries.len, 2);
+
+  /* Failed patches aren't cached */
+  assert_false(d2k_dehacked_cache_get(&cache, "Thing 4\n", 8, &other,
+                                                              &status));
+  assert_int_equal(status.code, D2K_DEHACKED_INVALID_THING_NUMBER);
+  status_init(&status);
+  assert_false(d2k_dehacked_cache_get(&cache, "Frame 2\nNext frame = 10\n",
+                                      24, &other, &status));
+  assert_int_equal(status.code, D2K_DEHACKED_INVALID_FRAME_NUMBER);
+  status_init(&status);
+  assert_false(d2k_dehacked_cache_get(&cache, "Frame 2\nSprite number = 3\n",
+                                      26, &other, &status));
+  assert_int_equal(status.code, D2K_DEHACKED_INVALID_SPRITE_NUMBER);
+  status_init(&status);
+  assert_false(d2k_dehacked_cache_get(&cache, "Thing 1\nDeath frame = -1\n",
+                                      25, &other, &status));
+  assert_int_equal(status.code, D2K_DEHACKED_INVALID_FRAME_NUMBER);
+  status_init(&status);
+  assert_false(d2k_dehacked_cache_get(&cache, "Text 5 5\nabc", 12, &other,
+                                                                   &status));
+  assert_int_equal(status.code, D2K_DEHACKED_TRUNCATED_TEXT);
+  status_init(&status);
+  assert_int_equal(cache.entries.len, 2);
+
+  /* Unknown mnemonics are counted and skipped */
+  assert_true(d2k_dehacked_cache_get(&cache,
+                                     "Thing 1\nBits = SOLID+FOO+TRANSLATION\n",
+                                     37, &other, &status));
+  assert_int_equal(other->unknown_flag_count, 1);
+  assert_int_equal(d2k_dehacked_info(other, 0)->flags,
+                   (1 << 1) | (1 << 26) | (1 << 27));
+
+  d2k_dehacked_cache_free(&cache);
+  array_free(&states);
+  array_free(&infos);
+  array_free(&sprite_names);
+}
+
+/* vi: set et ts=2 sw=2: */
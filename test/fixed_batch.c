@@ -0,0 +1,64 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+void test_fixed_batch(void **state) {
+  Status status;
+  D2KFixedPoint a[9] = {
+    FRACUNIT, -FRACUNIT, 3 * FRACUNIT, FRACUNIT / 2, 0, INT_MAX, 7, -9, 100
+  };
+  D2KFixedPoint b[9] = {
+    2 * FRACUNIT, FRACUNIT / 4, -FRACUNIT, 0, 5, 1, FRACUNIT, 3, -FRACUNIT
+  };
+  D2KFixedPoint out[9];
+  D2KAngle angles[9];
+
+  (void)state;
+
+  status_init(&status);
+
+  assert_true(d2k_fixed_batch_self_test(&status));
+  assert_true(d2k_fixed_batch_impl_supported(D2K_FIXED_BATCH_IMPL_SCALAR));
+  assert_true(d2k_fixed_batch_impl_supported(d2k_fixed_batch_impl()));
+
+  for (int i = 0; i < D2K_FIXED_BATCH_IMPL_MAX; i++) {
+    if (!d2k_fixed_batch_use_impl((D2KFixedBatchImpl)i, &status)) {
+      assert_false(d2k_fixed_batch_impl_supported((D2KFixedBatchImpl)i));
+      continue;
+    }
+
+    d2k_fixed_batch_mul(out, a, b, 9);
+    for (size_t j = 0; j < 9; j++) {
+      assert_int_equal(out[j], d2k_fixed_mul(a[j], b[j]));
+    }
+
+    d2k_fixed_batch_div(out, a, b, 9);
+    for (size_t j = 0; j < 9; j++) {
+      assert_int_equal(out[j], d2k_fixed_div(a[j], b[j]));
+    }
+
+    d2k_fixed_batch_approx_distance(out, a, b, 9);
+    assert_int_equal(out[0], 2 * FRACUNIT + FRACUNIT / 2);
+
+    d2k_fixed_batch_point_to_angle(angles, d2k_tantoangle, a, b, 9);
+    for (size_t j = 0; j < 9; j++) {
+      assert_int_equal(angles[j],
+                       d2k_point_to_angle(d2k_tantoangle, a[j], b[j]));
+    }
+
+    d2k_fixed_batch_dot(out, a, a, b, b, 9);
+    assert_int_equal(out[2], -6 * FRACUNIT);
+
+    /* Outputs may alias inputs */
+    memcpy(out, b, sizeof(out));
+    d2k_fixed_batch_mul(out, out, out, 9);
+    assert_int_equal(out[0], 4 * FRACUNIT);
+    assert_int_equal(out[1], FRACUNIT / 16);
+  }
+
+  assert_true(d2k_fixed_batch_use_impl(D2K_FIXED_BATCH_IMPL_SCALAR, &status));
+}
+
+/* vi: set et ts=2 sw=2: */
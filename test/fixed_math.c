@@ -0,0 +1,72 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+#define RANDOM_DIVISION_COUNT 2000000
+
+static uint32_t next_random(uint32_t *seed) {
+  *seed = (*seed * 1664525u) + 1013904223u;
+
+  return *seed;
+}
+
+/* Random bits at a random magnitude, so quotients cover the whole range */
+static D2KFixedPoint random_fixed(uint32_t *seed) {
+  uint32_t value = next_random(seed) >> (next_random(seed) % 32);
+
+  if (next_random(seed) & 1) {
+    value = 0u - value;
+  }
+
+  if ((D2KFixedPoint)value == INT_MIN) {
+    value++;
+  }
+
+  return (D2KFixedPoint)value;
+}
+
+void test_fixed_math(void **state) {
+  uint32_t seed = 0xD1F;
+
+  (void)state;
+
+  assert_int_equal(d2k_fixed_div(FRACUNIT, 2 * FRACUNIT), FRACUNIT / 2);
+  assert_int_equal(d2k_fixed_div(-3 * FRACUNIT, 2 * FRACUNIT),
+                   -(3 * FRACUNIT / 2));
+  assert_int_equal(d2k_fixed_div(FRACUNIT, 0), INT_MAX);
+  assert_int_equal(d2k_fixed_div(-FRACUNIT, 0), INT_MIN);
+
+  /* INT_MIN doesn't trap, and INT_MIN / 0 saturates instead of faulting */
+  assert_int_equal(d2k_fixed_div(INT_MIN, 0), INT_MIN);
+  assert_int_equal(d2k_fixed_div(INT_MIN, INT_MIN), INT_MAX);
+  assert_int_equal(d2k_fixed_div(INT_MIN, 1), d2k_fixed_div_int64(INT_MIN, 1));
+  assert_int_equal(d2k_fixed_div(INT_MIN, -1),
+                   d2k_fixed_div_int64(INT_MIN, -1));
+
+  /* Every pair of small numerators and divisors, around the overflow edge */
+  for (D2KFixedPoint a = -2048; a <= 2048; a++) {
+    for (D2KFixedPoint b = -256; b <= 256; b++) {
+      if (b == 0) {
+        continue;
+      }
+
+      assert_int_equal(d2k_fixed_div(a, b), d2k_fixed_div_int64(a, b));
+      assert_int_equal(d2k_fixed_div(a * (1 << 14), b),
+                       d2k_fixed_div_int64(a * (1 << 14), b));
+    }
+  }
+
+  for (size_t i = 0; i < RANDOM_DIVISION_COUNT; i++) {
+    D2KFixedPoint a = random_fixed(&seed);
+    D2KFixedPoint b = random_fixed(&seed);
+
+    assert_int_equal(d2k_fixed_div(a, b), d2k_fixed_div_int64(a, b));
+  }
+
+  assert_int_equal(d2k_fixed_approx_distance(3 * FRACUNIT, -4 * FRACUNIT),
+                   4 * FRACUNIT + 3 * FRACUNIT / 2);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,348 @@
+#include "d2k.h"
+#include "d2k_test.h"
+
+#define cell_coord(n) d2k_int_to_fixed_point((n) * GRID_MAP_CELL_SIZE)
+
+static size_t vertical_line_index(GridMap *grid, size_t x, size_t y) {
+  return (y * (grid->width + 1)) + x;
+}
+
+static size_t horizontal_line_index(GridMap *grid, size_t x, size_t y) {
+  return ((grid->width + 1) * grid->height) + (y * grid->width) + x;
+}
+
+static D2KFixedVertex* vertex(GridMap *grid, size_t x, size_t y) {
+  return array_index_fast(&grid->map.vertexes, (y * (grid->width + 1)) + x);
+}
+
+/*
+ * `front` and `back` are cell sectors (back may be NULL); the line runs from
+ * `v1` to `v2` with `front` on its right.
+ */
+static void add_line(GridMap *grid, size_t index, D2KFixedVertex *v1,
+                                                  D2KFixedVertex *v2,
+                                                  D2KSector *front,
+                                                  D2KSector *back) {
+  D2KLinedef *line = array_index_fast(&grid->map.linedefs, index);
+  D2KSidedef *front_side = array_index_fast(&grid->map.sidedefs, index * 2);
+  D2KSidedef *back_side = array_index_fast(&grid->map.sidedefs,
+                                           (index * 2) + 1);
+
+  memset(line, 0, sizeof(D2KLinedef));
+  memset(front_side, 0, sizeof(D2KSidedef));
+  memset(back_side, 0, sizeof(D2KSidedef));
+
+  line->id = index;
+  line->v1 = v1;
+  line->v2 = v2;
+  line->dx = v2->x - v1->x;
+  line->dy = v2->y - v1->y;
+  line->front_side = front_side;
+  front_side->sector = front;
+
+  if (back) {
+    line->flags |= D2K_LINEDEF_FLAG_TWO_SIDED;
+    line->back_side = back_side;
+    back_side->sector = back;
+  }
+}
+
+static void add_seg(GridMap *grid, D2KSector *sector, D2KLinedef *line) {
+  D2KSeg *seg = array_append_fast(&grid->map.segs);
+
+  memset(seg, 0, sizeof(D2KSeg));
+
+  seg->linedef = line;
+
+  if (line->front_side->sector == sector) {
+    seg->v1 = line->v1;
+    seg->v2 = line->v2;
+    seg->sidedef = line->front_side;
+    seg->front_sector = sector;
+    seg->back_sector = line->back_side ? line->back_side->sector : NULL;
+  }
+  else {
+    seg->v1 = line->v2;
+    seg->v2 = line->v1;
+    seg->sidedef = line->back_side;
+    seg->front_sector = sector;
+    seg->back_sector = line->front_side->sector;
+  }
+}
+
+static void set_box(D2KFixedPoint *bbox, size_t x0, size_t y0, size_t x1,
+                                                               size_t y1) {
+  bbox[BOXTOP] = cell_coord(y1);
+  bbox[BOXBOTTOM] = cell_coord(y0);
+  bbox[BOXLEFT] = cell_coord(x0);
+  bbox[BOXRIGHT] = cell_coord(x1);
+}
+
+/* Nodes are appended children-first, so the root ends up last */
+static int build_nodes(GridMap *grid, size_t x0, size_t y0, size_t x1,
+                                                            size_t y1) {
+  D2KMapNode *node;
+  int children[2];
+
+  if (((x1 - x0) == 1) && ((y1 - y0) == 1)) {
+    return (int)((y0 * grid->width) + x0) | D2K_MAP_NODE_FLAGS_SUBSECTOR;
+  }
+
+  if ((x1 - x0) >= (y1 - y0)) {
+    size_t xm = (x0 + x1) / 2;
+
+    children[0] = build_nodes(grid, xm, y0, x1, y1);
+    children[1] = build_nodes(grid, x0, y0, xm, y1);
+    node = array_append_fast(&grid->map.nodes);
+    node->x = cell_coord(xm);
+    node->y = cell_coord(y0);
+    node->dx = 0;
+    node->dy = cell_coord(y1 - y0);
+    set_box(node->bbox[0], xm, y0, x1, y1);
+    set_box(node->bbox[1], x0, y0, xm, y1);
+  }
+  else {
+    size_t ym = (y0 + y1) / 2;
+
+    children[0] = build_nodes(grid, x0, y0, x1, ym);
+    children[1] = build_nodes(grid, x0, ym, x1, y1);
+    node = array_append_fast(&grid->map.nodes);
+    node->x = cell_coord(x0);
+    node->y = cell_coord(ym);
+    node->dx = cell_coord(x1 - x0);
+    node->dy = 0;
+    set_box(node->bbox[0], x0, y0, x1, ym);
+    set_box(node->bbox[1], x0, ym, x1, y1);
+  }
+
+  node->children[0] = children[0];
+  node->children[1] = children[1];
+
+  return (int)(grid->map.nodes.len - 1);
+}
+
+/*
+ * Cells are exactly one block, so each block just lists its cell's four
+ * edges.
+ */
+static bool build_blockmap(GridMap *grid, Status *status) {
+  D2KBlockmap *bmap = &grid->map.blockmap;
+
+  bmap->width = grid->width;
+  bmap->height = grid->height;
+  bmap->origin_x = 0;
+  bmap->origin_y = 0;
+
+  if (!array_set_size(&bmap->blocks, grid->width * grid->height, status)) {
+    return false;
+  }
+
+  for (size_t y = 0; y < grid->height; y++) {
+    for (size_t x = 0; x < grid->width; x++) {
+      Array *block = array_index_fast(&bmap->blocks, (y * grid->width) + x);
+      size_t line_indices[4] = {
+        vertical_line_index(grid, x, y),
+        vertical_line_index(grid, x + 1, y),
+        horizontal_line_index(grid, x, y),
+        horizontal_line_index(grid, x, y + 1),
+      };
+
+      array_init(block, sizeof(size_t));
+
+      if (!array_set_size(block, 4, status)) {
+        return false;
+      }
+
+      for (size_t i = 0; i < 4; i++) {
+        *(size_t *)array_index_fast(block, i) = line_indices[i];
+      }
+    }
+  }
+
+  return status_ok(status);
+}
+
+bool grid_map_init(GridMap *grid, size_t width, size_t height,
+                                                Status *status) {
+  D2KMap *map = &grid->map;
+  size_t cell_count = width * height;
+  size_t line_count = ((width + 1) * height) + (width * (height + 1));
+  D2KMapLoader map_loader;
+
+  d2k_map_init(map);
+  grid->width = width;
+  grid->height = height;
+
+  if (!(array_set_size(&map->vertexes, (width + 1) * (height + 1), status) &&
+        array_set_size(&map->sectors, cell_count, status)                &&
+        array_set_size(&map->subsectors, cell_count, status)             &&
+        array_set_size(&map->linedefs, line_count, status)               &&
+        array_set_size(&map->sidedefs, line_count * 2, status)           &&
+        array_ensure_capacity(&map->segs, cell_count * 4, status)        &&
+        array_ensure_capacity(&map->nodes, cell_count - 1, status)       &&
+        array_set_size(&map->reject, ((cell_count * cell_count) + 7) / 8,
+                                     status))) {
+    return false;
+  }
+
+  memset(array_index_fast(&map->reject, 0), 0, map->reject.len);
+
+  for (size_t y = 0; y <= height; y++) {
+    for (size_t x = 0; x <= width; x++) {
+      D2KFixedVertex *v = vertex(grid, x, y);
+
+      memset(v, 0, sizeof(D2KFixedVertex));
+      v->x = cell_coord(x);
+      v->y = cell_coord(y);
+    }
+  }
+
+  for (size_t i = 0; i < cell_count; i++) {
+    D2KSector *sector = array_index_fast(&map->sectors, i);
+
+    memset(sector, 0, sizeof(D2KSector));
+    sector->id = i;
+    sector->floor_height = 0;
+    sector->ceiling_height = cell_coord(1);
+  }
+
+  for (size_t y = 0; y < height; y++) {
+    for (size_t x = 0; x <= width; x++) {
+      size_t index = vertical_line_index(grid, x, y);
+
+      if (x < width) {
+        add_line(grid, index, vertex(grid, x, y), vertex(grid, x, y + 1),
+          grid_map_sector(grid, x, y),
+          x > 0 ? grid_map_sector(grid, x - 1, y) : NULL
+        );
+      }
+      else {
+        add_line(grid, index, vertex(grid, x, y + 1), vertex(grid, x, y),
+          grid_map_sector(grid, x - 1, y),
+          NULL
+        );
+      }
+    }
+  }
+
+  for (size_t y = 0; y <= height; y++) {
+    for (size_t x = 0; x < width; x++) {
+      size_t index = horizontal_line_index(grid, x, y);
+
+      if (y > 0) {
+        add_line(grid, index, vertex(grid, x, y), vertex(grid, x + 1, y),
+          grid_map_sector(grid, x, y - 1),
+          y < height ? grid_map_sector(grid, x, y) : NULL
+        );
+      }
+      else {
+        add_line(grid, index, vertex(grid, x + 1, y), vertex(grid, x, y),
+          grid_map_sector(grid, x, y),
+          NULL
+        );
+      }
+    }
+  }
+
+  for (size_t y = 0; y < height; y++) {
+    for (size_t x = 0; x < width; x++) {
+      D2KSector *sector = grid_map_sector(grid, x, y);
+      D2KSubsector *subsector = array_index_fast(&map->subsectors,
+                                                 (y * width) + x);
+
+      subsector->first_seg = map->segs.len;
+      subsector->seg_count = 4;
+
+      add_seg(grid, sector, grid_map_vertical_line(grid, x, y));
+      add_seg(grid, sector, grid_map_vertical_line(grid, x + 1, y));
+      add_seg(grid, sector, grid_map_horizontal_line(grid, x, y));
+      add_seg(grid, sector, grid_map_horizontal_line(grid, x, y + 1));
+    }
+  }
+
+  build_nodes(grid, 0, 0, width, height);
+
+  if (!build_blockmap(grid, status)) {
+    return false;
+  }
+
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  map_loader.map = map;
+
+  return (
+    d2k_map_loader_link_subsectors(&map_loader, status) &&
+    d2k_map_loader_group_lines(&map_loader, status)
+  );
+}
+
+void grid_map_free(GridMap *grid) {
+  array_free(&grid->map.vertexes);
+  array_free(&grid->map.segs);
+  array_free(&grid->map.sectors);
+  array_free(&grid->map.subsectors);
+  array_free(&grid->map.nodes);
+  array_free(&grid->map.linedefs);
+  array_free(&grid->map.sidedefs);
+  array_free(&grid->map.sector_lines);
+  array_free(&grid->map.sslines);
+  array_free(&grid->map.reject);
+
+  for (size_t i = 0; i < grid->map.blockmap.blocks.len; i++) {
+    array_free(array_index_fast(&grid->map.blockmap.blocks, i));
+  }
+
+  array_free(&grid->map.blockmap.blocks);
+}
+
+D2KSector* grid_map_sector(GridMap *grid, size_t x, size_t y) {
+  return array_index_fast(&grid->map.sectors, (y * grid->width) + x);
+}
+
+/* The line along the left edge of cell (x, y); x == width is the far edge */
+D2KLinedef* grid_map_vertical_line(GridMap *grid, size_t x, size_t y) {
+  return array_index_fast(&grid->map.linedefs,
+                          vertical_line_index(grid, x, y));
+}
+
+/* The line along the bottom edge of cell (x, y); y == height is the top */
+D2KLinedef* grid_map_horizontal_line(GridMap *grid, size_t x, size_t y) {
+  return array_index_fast(&grid->map.linedefs,
+                          horizontal_line_index(grid, x, y));
+}
+
+bool grid_map_split_vertical_line(GridMap *grid, size_t x, size_t y0,
+                                                           size_t y1,
+                                                           Status *status) {
+  D2KLinedef *line = grid_map_vertical_line(grid, x, y0);
+  D2KMapLoader map_loader;
+
+  line->v2 = vertex(grid, x, y1);
+  line->dy = line->v2->y - line->v1->y;
+
+  for (size_t y = y0 + 1; y < y1; y++) {
+    D2KSeg *left = array_index_fast(&grid->map.segs,
+                                    (((y * grid->width) + x) * 4) + 0);
+    D2KSeg *right = array_index_fast(&grid->map.segs,
+                                     (((y * grid->width) + x - 1) * 4) + 1);
+
+    left->linedef = line;
+    right->linedef = line;
+  }
+
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  map_loader.map = &grid->map;
+
+  return d2k_map_loader_link_subsectors(&map_loader, status);
+}
+
+void grid_map_place_actor(GridMap *grid, D2KSightActor *actor, size_t x,
+                                                                size_t y) {
+  actor->x = cell_coord(x) + (cell_coord(1) / 2);
+  actor->y = cell_coord(y) + (cell_coord(1) / 2);
+  actor->subsector = d2k_map_point_in_subsector(&grid->map, actor->x,
+                                                            actor->y);
+  actor->z = actor->subsector->sector->floor_height;
+  actor->height = d2k_int_to_fixed_point(GRID_MAP_ACTOR_HEIGHT);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,117 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+static const char *sample =
+  "Nobody inspects the spammish repetition";
+
+void test_hash(void **state) {
+  uint8_t data[300];
+  uint32_t seed = 1;
+  D2KLump lumps[2];
+  D2KLump *lump_pointers[3];
+  D2KLumpDirectory lump_directory;
+  Status status;
+  uint64_t map_hash;
+
+  (void)state;
+
+  /* Reference XXH64 values */
+  assert_true(d2k_hash("", 0, 0) == UINT64_C(0xEF46DB3751D8E999));
+  assert_true(d2k_hash("a", 1, 0) == UINT64_C(0xD24EC4F1A98C6E5B));
+  assert_true(d2k_hash("abc", 3, 0) == UINT64_C(0x44BC2CF5AD770999));
+  assert_true(d2k_hash(sample, strlen(sample), 0) ==
+              UINT64_C(0xFBCEA83C8A378BF1));
+  assert_true(d2k_hash("abc", 3, 1) != d2k_hash("abc", 3, 0));
+
+  for (size_t i = 0; i < sizeof(data); i++) {
+    seed = (seed * 1103515245) + 12345;
+    data[i] = (uint8_t)(seed >> 16);
+  }
+
+  /* Any split of the input hashes the same as all of it at once */
+  for (size_t len = 0; len <= sizeof(data); len += 7) {
+    uint64_t expected = d2k_hash(data, len, 5);
+
+    for (size_t chunk = 1; chunk <= 70; chunk += 3) {
+      D2KHash hash;
+
+      d2k_hash_init(&hash, 5);
+
+      for (size_t offset = 0; offset < len; offset += chunk) {
+        size_t left = len - offset;
+
+        d2k_hash_update(&hash, data + offset, left < chunk ? left : chunk);
+      }
+
+      assert_true(d2k_hash_final(&hash) == expected);
+    }
+  }
+
+  memset(lumps, 0, sizeof(lumps));
+  strcpy(lumps[0].name, "THINGS");
+  lumps[0].data.data = (char *)data;
+  lumps[0].data.len = 10;
+  strcpy(lumps[1].name, "LINEDEFS");
+  lumps[1].data.data = (char *)data + 10;
+  lumps[1].data.len = 14;
+  lump_pointers[0] = &lumps[0];
+  lump_pointers[1] = NULL;
+  lump_pointers[2] = &lumps[1];
+
+  map_hash = d2k_map_hash_lumps(lump_pointers, 3);
+  assert_true(map_hash == d2k_map_hash_lumps(lump_pointers, 3));
+
+  /* Missing lumps are skipped */
+  lump_pointers[1] = &lumps[1];
+  assert_true(map_hash == d2k_map_hash_lumps(lump_pointers, 2));
+
+  /* Moving bytes across a lump boundary changes the hash */
+  lumps[0].data.len = 12;
+  lumps[1].data.data = (char *)data + 12;
+  lumps[1].data.len = 12;
+  assert_true(map_hash != d2k_map_hash_lumps(lump_pointers, 2));
+  lumps[0].data.len = 10;
+  lumps[1].data.data = (char *)data + 10;
+  lumps[1].data.len = 14;
+  assert_true(map_hash == d2k_map_hash_lumps(lump_pointers, 2));
+
+  /* A directory range hashes the same as the lumps it covers */
+  status_init(&status);
+  parray_init(&lump_directory.lumps);
+  assert_true(parray_append(&lump_directory.lumps, &lumps[1], &status));
+  assert_true(parray_append(&lump_directory.lumps, &lumps[0], &status));
+  assert_true(parray_append(&lump_directory.lumps, &lumps[1], &status));
+  assert_true(map_hash == d2k_map_hash_lump_range(&lump_directory, 1, 3));
+  assert_true(map_hash != d2k_map_hash_lump_range(&lump_directory, 1, 2));
+  parray_free(&lump_directory.lumps);
+
+  strcpy(lumps[1].name, "SIDEDEFS");
+  assert_true(map_hash != d2k_map_hash_lumps(lump_pointers, 2));
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,44 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+void test_lump_name_cache(void **state) {
+  D2KLumpNameCache cache;
+  char name[9];
+  size_t index = 0;
+  uint64_t key1 = d2k_lump_name_cache_key("STARTAN3");
+  uint64_t key2 = d2k_lump_name_cache_key("FLAT1\0\xff\xff");
+  uint64_t key3 = d2k_lump_name_cache_key("FLAT1\0\0\0");
+
+  (void)state;
+
+  d2k_lump_name_cache_init(&cache);
+
+  assert_int_equal(key2, key3);
+  assert_int_equal(d2k_lump_name_cache_key("\0\0\0\0\0\0\0\0"), 0);
+
+  d2k_lump_name_cache_key_to_name(key1, name);
+  assert_string_equal(name, "STARTAN3");
+
+  d2k_lump_name_cache_key_to_name(key2, name);
+  assert_string_equal(name, "FLAT1");
+
+  assert_false(d2k_lump_name_cache_get(&cache, key1, &index));
+
+  d2k_lump_name_cache_put(&cache, key1, 42);
+  d2k_lump_name_cache_put(&cache, key2, 7);
+
+  assert_true(d2k_lump_name_cache_get(&cache, key1, &index));
+  assert_int_equal(index, 42);
+
+  assert_true(d2k_lump_name_cache_get(&cache, key3, &index));
+  assert_int_equal(index, 7);
+
+  assert_int_equal(cache.hits, 2);
+  assert_int_equal(cache.misses, 1);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -4,17 +4,59 @@
 
 #include <cmocka.h>
 
+void test_angle(void **state);
 void test_basic(void **state);
 void test_blockmap(void **state);
+void test_dehacked(void **state);
+void test_fixed_batch(void **state);
+void test_fixed_math(void **state);
+void test_hash(void **state);
+void test_lump_name_cache(void **state);
 void test_map(void **state);
+void test_map_blockmap_things(void **state);
+void test_map_instance(void **state);
+void test_map_object_slab(void **state);
+void test_map_object_state_table(void **state);
+void test_map_repair(void **state);
+void test_map_scratch(void **state);
+void test_map_sector_nodes(void **state);
+void test_map_things(void **state);
+void test_map_udmf(void **state);
+void test_map_validator(void **state);
+void test_path_traversal(void **state);
+void test_patch(void **state);
+void test_sight(void **state);
+void test_texture(void **state);
+void test_thinker(void **state);
 void test_wad(void **state);
 
 int main(void) {
   int failed_test_count = 0;
 
   const struct CMUnitTest tests[] = {
+    cmocka_unit_test(test_angle),
     cmocka_unit_test(test_blockmap),
+    cmocka_unit_test(test_dehacked),
+    cmocka_unit_test(test_fixed_batch),
+    cmocka_unit_test(test_fixed_math),
+    cmocka_unit_test(test_hash),
+    cmocka_unit_test(test_lump_name_cache),
     cmocka_unit_test(test_map),
+    cmocka_unit_test(test_map_blockmap_things),
+    cmocka_unit_test(test_map_instance),
+    cmocka_unit_test(test_map_object_slab),
+    cmocka_unit_test(test_map_object_state_table),
+    cmocka_unit_test(test_map_repair),
+    cmocka_unit_test(test_map_scratch),
+    cmocka_unit_test(test_map_sector_nodes),
+    cmocka_unit_test(test_map_things),
+    cmocka_unit_test(test_map_udmf),
+    cmocka_unit_test(test_map_validator),
+    cmocka_unit_test(test_path_traversal),
+    cmocka_unit_test(test_patch),
+    cmocka_unit_test(test_sight),
+    cmocka_unit_test(test_texture),
+    cmocka_unit_test(test_thinker),
     cmocka_unit_test(test_wad),
   };
 
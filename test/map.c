@@ -7,10 +7,74 @@
 
 void test_map(void **state) {
   Status status;
+  D2KMap map;
+  D2KMapLoader map_loader;
+  D2KSector *sector = NULL;
+  D2KSubsector *subsector = NULL;
+  D2KSeg *seg = NULL;
+  D2KSidedef sidedef;
+  D2KLinedef linedef;
+  D2KFixedVertex v1 = { 0, 0 };
+  D2KFixedVertex v2 = { 64 << FRACBITS, 0 };
 
   (void)state;
 
   status_init(&status);
+  d2k_map_init(&map);
+
+  map.blockmap.width = 4;
+  map.blockmap.height = 4;
+  map.blockmap.origin_x = -(256 << FRACBITS);
+  map.blockmap.origin_y = -(256 << FRACBITS);
+
+  /* A sector no line refers to gets an empty blockbox */
+  assert_true(array_append(&map.sectors, (void **)&sector, &status));
+  memset(sector, 0, sizeof(D2KSector));
+  sector->id = 0;
+
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  map_loader.map = &map;
+
+  assert_true(d2k_map_loader_group_lines(&map_loader, &status));
+
+  sector = array_index_fast(&map.sectors, 0);
+  assert_int_equal(sector->line_count, 0);
+  assert_true(sector->blockbox[BOXBOTTOM] > sector->blockbox[BOXTOP]);
+  assert_true(sector->blockbox[BOXLEFT] > sector->blockbox[BOXRIGHT]);
+  assert_int_equal(sector->sound_origin.x, 0);
+  assert_int_equal(sector->sound_origin.y, 0);
+
+  /* A GL subsector whose first seg is a mini seg takes the next seg's sector */
+  memset(&sidedef, 0, sizeof(D2KSidedef));
+  memset(&linedef, 0, sizeof(D2KLinedef));
+  sidedef.sector = sector;
+  linedef.v1 = &v1;
+  linedef.v2 = &v2;
+
+  assert_true(array_append(&map.segs, (void **)&seg, &status));
+  memset(seg, 0, sizeof(D2KSeg));
+  seg->v1 = &v2;
+  seg->v2 = &v1;
+  seg->mini_seg = true;
+
+  assert_true(array_append(&map.segs, (void **)&seg, &status));
+  memset(seg, 0, sizeof(D2KSeg));
+  seg->v1 = &v1;
+  seg->v2 = &v2;
+  seg->sidedef = &sidedef;
+  seg->linedef = &linedef;
+
+  assert_true(array_append(&map.subsectors, (void **)&subsector, &status));
+  subsector->first_seg = 0;
+  subsector->seg_count = 2;
+
+  assert_true(d2k_map_loader_link_subsectors(&map_loader, &status));
+
+  subsector = array_index_fast(&map.subsectors, 0);
+  assert_ptr_equal(subsector->sector, sector);
+  assert_int_equal(subsector->ssline_count, 1);
+
+  d2k_map_clear(&map);
 }
 
 /* vi: set et ts=2 sw=2: */
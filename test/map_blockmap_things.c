@@ -0,0 +1,239 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+#define CELL (128 * FRACUNIT)
+
+typedef struct {
+  D2KBlockmapThings *things;
+  D2KMapObjectSlab  *slab;
+  D2KMapObject      *visited[32];
+  size_t             count;
+  D2KMapObject      *victim;
+} Visits;
+
+static bool record(D2KMapObject *map_object, void *data) {
+  Visits *visits = data;
+
+  visits->visited[visits->count++] = map_object;
+
+  return true;
+}
+
+static bool record_and_unlink(D2KMapObject *map_object, void *data) {
+  Visits *visits = data;
+
+  visits->visited[visits->count++] = map_object;
+  d2k_blockmap_things_unlink(visits->things, map_object);
+
+  return true;
+}
+
+static bool record_and_unlink_victim(D2KMapObject *map_object, void *data) {
+  Visits *visits = data;
+
+  assert_non_null(map_object);
+  visits->visited[visits->count++] = map_object;
+
+  if (visits->victim) {
+    d2k_blockmap_things_unlink(visits->things, visits->victim);
+    visits->victim = NULL;
+  }
+
+  return true;
+}
+
+static D2KMapObject* spawn_at(D2KBlockmapThings *things,
+                              D2KMapObjectSlab *slab,
+                              D2KFixedPoint x,
+                              D2KFixedPoint y,
+                              Status *status) {
+  D2KMapObject *map_object = NULL;
+
+  assert_true(d2k_map_object_slab_spawn(slab, &map_object, status));
+  map_object->x = x;
+  map_object->y = y;
+  assert_true(d2k_blockmap_things_link(things, map_object, status));
+
+  return map_object;
+}
+
+void test_map_blockmap_things(void **state) {
+  Status status;
+  D2KBlockmap blockmap;
+  D2KBlockmapThings things;
+  D2KMapObjectSlab slab;
+  D2KBlockmapThingCell *cell;
+  D2KMapObject *objects[10];
+  D2KMapObject *outside;
+  Visits visits;
+
+  (void)state;
+
+  status_init(&status);
+
+  d2k_blockmap_init(&blockmap);
+  blockmap.width = 4;
+  blockmap.height = 4;
+  blockmap.origin_x = -CELL;
+  blockmap.origin_y = -CELL;
+
+  assert_true(d2k_blockmap_things_init(&things, &blockmap, &status));
+  assert_true(d2k_map_object_slab_init(&slab, 64, &status));
+
+  visits.things = &things;
+  visits.slab = &slab;
+  visits.victim = NULL;
+
+  /* Cell (1, 1) holds the origin; enough objects to spill off the inline array */
+  for (size_t i = 0; i < 10; i++) {
+    objects[i] = spawn_at(&things, &slab, (D2KFixedPoint)i * FRACUNIT, 0,
+                                                                      &status);
+  }
+
+  cell = d2k_blockmap_things_cell(&things, 1, 1);
+  assert_int_equal(cell->count, 10);
+  assert_non_null(cell->spilled);
+
+  visits.count = 0;
+  assert_true(d2k_blockmap_things_iterate(&things, &slab, 1, 1, record,
+                                                                &visits));
+  assert_int_equal(visits.count, 10);
+
+  for (size_t i = 0; i < 10; i++) {
+    assert_ptr_equal(visits.visited[i], objects[9 - i]);
+  }
+
+  /* Things outside the blockmap aren't linked */
+  outside = spawn_at(&things, &slab, -2 * CELL, 0, &status);
+
+  /*
+   * Moving within a cell makes the object the newest there, as vanilla's
+   * unset and set position do; the rest keep their order
+   */
+  objects[2]->x += 16 * FRACUNIT;
+  assert_true(d2k_blockmap_things_relink(&things, objects[2], &status));
+  assert_int_equal(cell->count, 10);
+  visits.count = 0;
+  assert_true(d2k_blockmap_things_iterate(&things, &slab, 1, 1, record,
+                                                                &visits));
+  assert_int_equal(visits.count, 10);
+  assert_ptr_equal(visits.visited[0], objects[2]);
+  assert_ptr_equal(visits.visited[1], objects[9]);
+  assert_ptr_equal(visits.visited[7], objects[3]);
+  assert_ptr_equal(visits.visited[8], objects[1]);
+  assert_ptr_equal(visits.visited[9], objects[0]);
+
+  /* Crossing into cell (2, 1) closes the gap without reordering */
+  objects[2]->x = CELL + FRACUNIT;
+  assert_true(d2k_blockmap_things_relink(&things, objects[2], &status));
+  assert_int_equal(cell->count, 9);
+  assert_int_equal(d2k_blockmap_thing_cell_handles(cell)[2],
+                   objects[3]->handle);
+  assert_int_equal(d2k_blockmap_thing_cell_handles(cell)[8],
+                   objects[9]->handle);
+  assert_int_equal(d2k_blockmap_things_cell(&things, 2, 1)->count, 1);
+
+  d2k_blockmap_things_unlink(&things, objects[5]);
+  assert_int_equal(d2k_blockmap_thing_cell_handles(cell)[3],
+                   objects[4]->handle);
+  assert_int_equal(d2k_blockmap_thing_cell_handles(cell)[4],
+                   objects[6]->handle);
+  assert_true(d2k_blockmap_things_link(&things, objects[5], &status));
+  assert_int_equal(d2k_blockmap_thing_cell_handles(cell)[8],
+                   objects[5]->handle);
+
+  /* The box picks up both cells, not the empty ones around them */
+  visits.count = 0;
+  assert_true(d2k_blockmap_things_iterate_box(&things, &slab, -CELL, -CELL,
+                                              3 * CELL, 3 * CELL, record,
+                                              &visits));
+  assert_int_equal(visits.count, 10);
+  d2k_blockmap_things_unlink(&things, outside);
+
+  /* Visitors can unlink what they're given; everything's seen exactly once */
+  visits.count = 0;
+  assert_true(d2k_blockmap_things_iterate(&things, &slab, 1, 1,
+                                          record_and_unlink, &visits));
+  assert_int_equal(visits.count, 9);
+  assert_int_equal(cell->count, 0);
+
+  /* Relinking finds objects[2] where it actually is after all the shifts */
+  objects[2]->x = 0;
+  assert_true(d2k_blockmap_things_relink(&things, objects[2], &status));
+  assert_int_equal(cell->count, 1);
+  assert_int_equal(d2k_blockmap_things_cell(&things, 2, 1)->count, 0);
+
+  for (size_t i = 0; i < 10; i++) {
+    size_t seen = 0;
+
+    for (size_t j = 0; j < visits.count; j++) {
+      if (visits.visited[j] == objects[i]) {
+        seen++;
+      }
+    }
+
+    assert_int_equal(seen, i == 2 ? 0 : 1);
+  }
+
+  /*
+   * Unlinking an object the walk hasn't reached yet skips it, and doesn't
+   * move an already-visited one into its place
+   */
+  for (size_t i = 0; i < 10; i++) {
+    d2k_blockmap_things_unlink(&things, objects[i]);
+  }
+
+  for (size_t i = 0; i < 4; i++) {
+    objects[i]->x = (D2KFixedPoint)i * FRACUNIT;
+    assert_true(d2k_blockmap_things_link(&things, objects[i], &status));
+  }
+
+  /* Linking twice moves rather than duplicating */
+  assert_true(d2k_blockmap_things_link(&things, objects[3], &status));
+  assert_int_equal(cell->count, 4);
+
+  visits.count = 0;
+  visits.victim = objects[1];
+  assert_true(d2k_blockmap_things_iterate(&things, &slab, 1, 1,
+                                          record_and_unlink_victim, &visits));
+  assert_int_equal(visits.count, 3);
+  assert_ptr_equal(visits.visited[0], objects[3]);
+  assert_ptr_equal(visits.visited[1], objects[2]);
+  assert_ptr_equal(visits.visited[2], objects[0]);
+  assert_int_equal(cell->count, 3);
+  assert_int_equal(cell->holes, 0);
+
+  /* Compacting keeps the links pointing at the right positions */
+  d2k_blockmap_things_unlink(&things, objects[0]);
+  assert_int_equal(cell->count, 2);
+
+  /* Relinking the older of two in place puts it first, as in vanilla */
+  assert_true(d2k_blockmap_things_relink(&things, objects[2], &status));
+  visits.count = 0;
+  assert_true(d2k_blockmap_things_iterate(&things, &slab, 1, 1, record,
+                                                                &visits));
+  assert_int_equal(visits.count, 2);
+  assert_ptr_equal(visits.visited[0], objects[2]);
+  assert_ptr_equal(visits.visited[1], objects[3]);
+
+  /* Objects removed from the slab without being unlinked are skipped */
+  d2k_map_object_slab_remove(&slab, objects[2]->handle);
+  visits.count = 0;
+  assert_true(d2k_blockmap_things_iterate(&things, &slab, 1, 1,
+                                          record_and_unlink_victim, &visits));
+  assert_int_equal(visits.count, 1);
+  assert_ptr_equal(visits.visited[0], objects[3]);
+
+  /* Out-of-range cells are empty */
+  assert_null(d2k_blockmap_things_cell(&things, 4, 0));
+  assert_true(d2k_blockmap_things_iterate(&things, &slab, -1, 0, record,
+                                                                 &visits));
+
+  d2k_map_object_slab_free(&slab);
+  d2k_blockmap_things_free(&things);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,84 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+void test_map_instance(void **state) {
+  Status status;
+  GridMap grid;
+  D2KMapInstance match1;
+  D2KMapInstance match2;
+  D2KSector *sector = NULL;
+  D2KLinedef *linedef = NULL;
+  const D2KSector *shared_sector;
+  const D2KLinedef *shared_linedef;
+  size_t last_sector;
+
+  (void)state;
+
+  status_init(&status);
+
+  /* 100 sectors: one full page and one partial page */
+  assert_true(grid_map_init(&grid, 10, 10, &status));
+  assert_true(d2k_map_instance_init(&match1, &grid.map, &status));
+  assert_true(d2k_map_instance_init(&match2, &grid.map, &status));
+
+  last_sector = grid.map.sectors.len - 1;
+  shared_sector = array_index_fast(&grid.map.sectors, last_sector);
+  shared_linedef = array_index_fast(&grid.map.linedefs, 5);
+
+  /* Nothing is copied until something is written */
+  assert_ptr_equal(d2k_map_instance_sector(&match1, last_sector),
+                   shared_sector);
+  assert_int_equal(d2k_map_instance_copied_page_count(&match1), 0);
+
+  assert_true(d2k_map_instance_edit_sector(&match1, last_sector, &sector,
+                                                                 &status));
+  assert_true(sector != shared_sector);
+  sector->floor_height += 64 * FRACUNIT;
+  assert_int_equal(d2k_map_instance_copied_page_count(&match1), 1);
+
+  /* Writes are only visible to the instance that made them */
+  assert_int_equal(d2k_map_instance_sector(&match1, last_sector)->floor_height,
+                   shared_sector->floor_height + (64 * FRACUNIT));
+  assert_int_equal(d2k_map_instance_sector(&match2, last_sector)->floor_height,
+                   shared_sector->floor_height);
+  assert_int_equal(
+    d2k_map_instance_sector_of(&match1, shared_sector)->floor_height,
+    sector->floor_height
+  );
+
+  /* Other elements on the copied page keep their loaded values */
+  assert_int_equal(d2k_map_instance_sector(&match1, last_sector - 1)->id,
+                   last_sector - 1);
+
+  /* A second write to the same page reuses the copy */
+  assert_true(d2k_map_instance_edit_sector(&match1, last_sector - 1, &sector,
+                                                                     &status));
+  assert_int_equal(d2k_map_instance_copied_page_count(&match1), 1);
+
+  assert_true(d2k_map_instance_edit_linedef(&match2, 5, &linedef, &status));
+  linedef->special = 11;
+  assert_int_equal(d2k_map_instance_linedef_of(&match2, shared_linedef)->special,
+                   11);
+  assert_int_equal(shared_linedef->special, 0);
+  assert_int_equal(d2k_map_instance_linedef(&match1, 5)->special, 0);
+
+  /* Resetting starts a fresh match on the same map */
+  d2k_map_instance_reset(&match1);
+  assert_int_equal(d2k_map_instance_copied_page_count(&match1), 0);
+  assert_ptr_equal(d2k_map_instance_sector(&match1, last_sector),
+                   shared_sector);
+
+  /* The null sector isn't paged, so it's shared as is */
+  assert_true(d2k_map_get_null_sector(&grid.map, &sector, &status));
+  assert_ptr_equal(d2k_map_instance_sector_of(&match1, sector), sector);
+
+  d2k_map_instance_free(&match1);
+  d2k_map_instance_free(&match2);
+  grid_map_free(&grid);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,90 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+void test_map_object_slab(void **state) {
+  Status status;
+  D2KMapObjectSlab slab;
+  D2KMapObject *imp = NULL;
+  D2KMapObject *fireball = NULL;
+  D2KMapObject *reused = NULL;
+  D2KMapObject *map_object = NULL;
+  D2KMapObjectHandle fireball_handle;
+  D2KMapObjectHandle first_handle;
+  uint32_t index = 0;
+  size_t count = 0;
+
+  (void)state;
+
+  status_init(&status);
+
+  assert_true(d2k_map_object_slab_init(&slab, 10, &status));
+  assert_int_equal(slab.slots.len, D2K_MAP_OBJECT_SLAB_CHUNK_SIZE);
+
+  assert_true(d2k_map_object_slab_spawn(&slab, &imp, &status));
+  assert_true(d2k_map_object_slab_spawn(&slab, &fireball, &status));
+  assert_true(imp->handle != D2K_MAP_OBJECT_HANDLE_NONE);
+  assert_true(imp->handle != fireball->handle);
+  assert_ptr_equal(d2k_map_object_slab_get(&slab, imp->handle), imp);
+  assert_null(d2k_map_object_slab_get(&slab, D2K_MAP_OBJECT_HANDLE_NONE));
+
+  fireball->target = imp->handle;
+  fireball_handle = fireball->handle;
+
+  /* A removed object's handle stops resolving, even once its slot is reused */
+  d2k_map_object_slab_remove(&slab, fireball_handle);
+  assert_null(d2k_map_object_slab_get(&slab, fireball_handle));
+  assert_true(d2k_map_object_slab_spawn(&slab, &reused, &status));
+  assert_ptr_equal(reused, fireball);
+  assert_true(reused->handle != fireball_handle);
+  assert_int_equal(reused->target, D2K_MAP_OBJECT_HANDLE_NONE);
+  assert_null(d2k_map_object_slab_get(&slab, fireball_handle));
+  assert_ptr_equal(d2k_map_object_slab_get(&slab, reused->handle), reused);
+
+  /* Stale removes are harmless */
+  d2k_map_object_slab_remove(&slab, fireball_handle);
+  assert_int_equal(slab.live_count, 2);
+
+  /* Grows a chunk at a time, without moving existing objects */
+  for (size_t i = 0; i < D2K_MAP_OBJECT_SLAB_CHUNK_SIZE; i++) {
+    assert_true(d2k_map_object_slab_spawn(&slab, &map_object, &status));
+  }
+  assert_int_equal(slab.slots.len, 2 * D2K_MAP_OBJECT_SLAB_CHUNK_SIZE);
+  assert_ptr_equal(d2k_map_object_slab_get(&slab, imp->handle), imp);
+
+  d2k_map_object_slab_remove(&slab, imp->handle);
+  while ((map_object = d2k_map_object_slab_next(&slab, &index))) {
+    assert_true(map_object != imp);
+    count++;
+  }
+  assert_int_equal(count, D2K_MAP_OBJECT_SLAB_CHUNK_SIZE + 1);
+  assert_int_equal(slab.live_count, count);
+
+  d2k_map_object_slab_free(&slab);
+
+  /* A slot reused until its generation runs out is retired, not wrapped */
+  assert_true(d2k_map_object_slab_init(&slab, 1, &status));
+  assert_true(d2k_map_object_slab_spawn(&slab, &map_object, &status));
+  first_handle = map_object->handle;
+  index = d2k_map_object_handle_index(first_handle);
+
+  for (size_t i = 1; i < D2K_MAP_OBJECT_HANDLE_GENERATION_MAX; i++) {
+    d2k_map_object_slab_remove(&slab, map_object->handle);
+    assert_true(d2k_map_object_slab_spawn(&slab, &map_object, &status));
+    assert_int_equal(d2k_map_object_handle_index(map_object->handle), index);
+  }
+
+  assert_int_equal(d2k_map_object_handle_generation(map_object->handle),
+                   D2K_MAP_OBJECT_HANDLE_GENERATION_MAX);
+  d2k_map_object_slab_remove(&slab, map_object->handle);
+  assert_true(d2k_map_object_slab_spawn(&slab, &map_object, &status));
+  assert_true(d2k_map_object_handle_index(map_object->handle) != index);
+  assert_null(d2k_map_object_slab_get(&slab, first_handle));
+  assert_int_equal(slab.live_count, 1);
+
+  d2k_map_object_slab_free(&slab);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,183 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+typedef struct {
+  size_t   actors[16];
+  uint32_t states[16];
+  size_t   count;
+} Calls;
+
+typedef struct {
+  D2KMapObjectStateTable *table;
+  int32_t                *tics;
+  uint32_t               *states;
+} Shove;
+
+static int chase_calls = 0;
+
+static void a_look(void) {
+}
+
+static void a_chase(void) {
+  chase_calls++;
+}
+
+static bool record(size_t actor, uint32_t state, D2KActionFunction action,
+                                                 void *data) {
+  Calls *calls = data;
+
+  if (action) {
+    action();
+  }
+
+  calls->actors[calls->count] = actor;
+  calls->states[calls->count] = state;
+  calls->count++;
+
+  return true;
+}
+
+/* Entering state 6 knocks the next actor into state 5 */
+static bool shove(size_t actor, uint32_t state, D2KActionFunction action,
+                                                void *data) {
+  Shove *shove = data;
+
+  (void)action;
+
+  if (state == 6) {
+    d2k_map_object_state_table_set_state(shove->table, shove->tics,
+                                                       shove->states,
+                                                       actor + 1,
+                                                       5,
+                                                       shove,
+                                                       shove);
+  }
+
+  return true;
+}
+
+void test_map_object_state_table(void **state) {
+  /*
+   * 1: looks for 2 tics, then a zero-tic chase into 3, which lasts forever.
+   * 4: 1 tic, then the null state.
+   * 5: 3 tics, no action, back to itself.
+   * 6: forever, looking.
+   * 7: 1 tic, then 6.
+   */
+  D2KMapObjectState states[] = {
+    { 0, 0, -1, NULL,    0, 0, 0 },
+    { 0, 0,  2, a_look,  2, 0, 0 },
+    { 0, 1,  0, a_chase, 3, 0, 0 },
+    { 0, 2, -1, a_chase, 3, 0, 0 },
+    { 0, 0,  1, NULL,    0, 0, 0 },
+    { 0, 0,  3, NULL,    5, 7, 9 },
+    { 0, 0, -1, a_look,  6, 0, 0 },
+    { 0, 0,  1, NULL,    6, 0, 0 },
+  };
+  D2KMapObjectState bad_states[] = {
+    { 0, 0, -1, NULL, 0, 0, 0 },
+    { 0, 0,  1, NULL, 2, 0, 0 },
+  };
+  D2KMapObjectStateTable table;
+  Status status;
+  Calls calls;
+  Shove shoves;
+  int32_t tics[3];
+  uint32_t actor_states[3];
+
+  (void)state;
+
+  status_init(&status);
+
+  assert_false(d2k_map_object_state_table_init(&table, bad_states, 2,
+                                                                   &status));
+  assert_int_equal(status.code, D2K_MAP_OBJECT_STATE_TABLE_INVALID_NEXT_STATE);
+  status_init(&status);
+
+  assert_true(d2k_map_object_state_table_init(&table, states, 8, &status));
+
+  /* Null plus two distinct actions */
+  assert_int_equal(table.actions.len, 3);
+  assert_true(d2k_map_object_state_table_action(&table, 2) ==
+              d2k_map_object_state_table_action(&table, 3));
+  assert_true(d2k_map_object_state_table_action(&table, 5) == NULL);
+  assert_int_equal(d2k_map_object_state_table_cold(&table, 5)->misc1, 7);
+  assert_int_equal(d2k_map_object_state_table_cold(&table, 2)->frame, 1);
+
+  calls.count = 0;
+  assert_true(d2k_map_object_state_table_set_state(&table, tics,
+                                                   actor_states, 0, 1, record,
+                                                   &calls));
+  assert_true(d2k_map_object_state_table_set_state(&table, tics,
+                                                   actor_states, 1, 4, record,
+                                                   &calls));
+  assert_true(d2k_map_object_state_table_set_state(&table, tics,
+                                                   actor_states, 2, 5, record,
+                                                   &calls));
+  assert_int_equal(calls.count, 1);
+  assert_int_equal(tics[0], 2);
+
+  /* Tic 1: actor 1 runs out and is removed */
+  calls.count = 0;
+  d2k_map_object_state_table_advance(&table, tics, actor_states, 3, record,
+                                                                    &calls);
+  assert_int_equal(calls.count, 1);
+  assert_int_equal(calls.actors[0], 1);
+  assert_int_equal(calls.states[0], D2K_MAP_OBJECT_STATE_NUM_NULL);
+  assert_int_equal(actor_states[1], D2K_MAP_OBJECT_STATE_NUM_NULL);
+  assert_int_equal(tics[1], -1);
+
+  /* Tic 2: actor 0 chases straight through the zero-tic state into 3 */
+  calls.count = 0;
+  d2k_map_object_state_table_advance(&table, tics, actor_states, 3, record,
+                                                                    &calls);
+  assert_int_equal(calls.count, 2);
+  assert_int_equal(calls.states[0], 2);
+  assert_int_equal(calls.states[1], 3);
+  assert_int_equal(chase_calls, 2);
+  assert_int_equal(actor_states[0], 3);
+  assert_int_equal(tics[0], -1);
+
+  /* Tic 3: actor 2 loops back into its own state, with no action to call */
+  calls.count = 0;
+  d2k_map_object_state_table_advance(&table, tics, actor_states, 3, record,
+                                                                    &calls);
+  assert_int_equal(calls.count, 0);
+  assert_int_equal(actor_states[2], 5);
+  assert_int_equal(tics[2], 3);
+  assert_int_equal(tics[0], -1);
+
+  /* States outside the table are refused */
+  assert_false(d2k_map_object_state_table_set_state(&table, tics,
+                                                    actor_states, 2, 8,
+                                                    record, &calls));
+  assert_int_equal(actor_states[2], 5);
+  assert_int_equal(tics[2], 3);
+
+  /*
+   * Actor 0's action sets actor 1's state; actor 1 still counts down this
+   * tic, as it would in vanilla where it thinks after actor 0
+   */
+  shoves.table = &table;
+  shoves.tics = tics;
+  shoves.states = actor_states;
+  assert_true(d2k_map_object_state_table_set_state(&table, tics,
+                                                   actor_states, 0, 7, shove,
+                                                   &shoves));
+  assert_true(d2k_map_object_state_table_set_state(&table, tics,
+                                                   actor_states, 1, 3, shove,
+                                                   &shoves));
+  d2k_map_object_state_table_advance(&table, tics, actor_states, 3, shove,
+                                                                    &shoves);
+  assert_int_equal(actor_states[0], 6);
+  assert_int_equal(actor_states[1], 5);
+  assert_int_equal(tics[1], 2);
+  assert_int_equal(tics[2], 2);
+
+  d2k_map_object_state_table_free(&table);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,190 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+static void put16(char *data, size_t offset, uint16_t value) {
+  data[offset]     = (char)(value & 0xFF);
+  data[offset + 1] = (char)(value >> 8);
+}
+
+static void build_map(D2KMap *map, Status *status) {
+  D2KFixedVertex *vertexes;
+  D2KSector *sector;
+  D2KSidedef *sidedef;
+  D2KLinedef *linedef;
+
+  assert_true(array_set_size(&map->vertexes, 2, status));
+  assert_true(array_set_size(&map->sectors, 1, status));
+  assert_true(array_set_size(&map->sidedefs, 1, status));
+  assert_true(array_set_size(&map->linedefs, 1, status));
+
+  vertexes = array_index_fast(&map->vertexes, 0);
+  vertexes[0].x = 0;
+  vertexes[0].y = 0;
+  vertexes[1].x = 64 * FRACUNIT;
+  vertexes[1].y = 0;
+
+  sector = array_index_fast(&map->sectors, 0);
+  memset(sector, 0, sizeof(D2KSector));
+
+  sidedef = array_index_fast(&map->sidedefs, 0);
+  memset(sidedef, 0, sizeof(D2KSidedef));
+  sidedef->sector = sector;
+
+  linedef = array_index_fast(&map->linedefs, 0);
+  memset(linedef, 0, sizeof(D2KLinedef));
+  linedef->v1 = &vertexes[0];
+  linedef->v2 = &vertexes[1];
+  linedef->flags = D2K_LINEDEF_FLAG_TWO_SIDED;
+  linedef->front_side = sidedef;
+}
+
+void test_map_repair(void **state) {
+  Status status;
+  D2KMap map;
+  D2KMapLoader map_loader;
+  D2KLump subsectors_lump;
+  D2KLump nodes_lump;
+  D2KLump segs_lump;
+  Array repairs;
+  D2KMapProblem *problem;
+  D2KMapNode *node;
+  D2KSeg *seg;
+  D2KLinedef *linedef;
+  char subsectors[4];
+  char nodes[28];
+  char segs[24];
+
+  (void)state;
+
+  status_init(&status);
+  array_init(&repairs, sizeof(D2KMapProblem));
+  memset(subsectors, 0, sizeof(subsectors));
+  memset(nodes, 0, sizeof(nodes));
+  memset(segs, 0, sizeof(segs));
+  memset(&subsectors_lump, 0, sizeof(D2KLump));
+  memset(&nodes_lump, 0, sizeof(D2KLump));
+  memset(&segs_lump, 0, sizeof(D2KLump));
+
+  put16(nodes, 24, 0x8003);
+  put16(nodes, 26, 0x8000);
+
+  /*
+   * Seg 0 has a bad end vertex and runs along the front of a 2-sided line
+   * with no back side; seg 1 is on the missing back side, so its front is
+   * missing instead.
+   */
+  put16(segs,  0, 0);
+  put16(segs,  2, 9);
+  put16(segs, 12, 1);
+  put16(segs, 14, 0);
+  put16(segs, 20, 1);
+
+  subsectors_lump.data.data = subsectors;
+  subsectors_lump.data.len = 0;
+  nodes_lump.data.data = nodes;
+  nodes_lump.data.len = sizeof(nodes);
+  segs_lump.data.data = segs;
+  segs_lump.data.len = sizeof(segs);
+
+  d2k_map_init(&map);
+  build_map(&map, &status);
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  map_loader.map = &map;
+  map_loader.nodes_version = D2K_MAP_NODES_VERSION_VANILLA;
+  map_loader.map_lumps[D2K_MAP_LUMP_SSECTORS] = &subsectors_lump;
+  map_loader.map_lumps[D2K_MAP_LUMP_NODES] = &nodes_lump;
+  map_loader.map_lumps[D2K_MAP_LUMP_SEGS] = &segs_lump;
+
+  assert_false(d2k_map_loader_load_nodes(&map_loader, &status));
+  assert_true(status_match(&status, "d2k_map_nodes",
+                                    D2K_MAP_NODES_INVALID_CHILD_INDEX));
+  status_clear(&status);
+
+  d2k_map_clear(&map);
+  build_map(&map, &status);
+  map_loader.repairs = &repairs;
+  assert_true(d2k_map_loader_load_nodes(&map_loader, &status));
+  assert_int_equal(repairs.len, 4);
+
+  node = array_index_fast(&map.nodes, 0);
+  assert_true(d2k_map_node_child_is_subsector(node->children[0]));
+  assert_int_equal(d2k_map_node_child_subsector(node->children[0]), 0);
+  assert_true(d2k_map_node_child_is_subsector(node->children[1]));
+  assert_int_equal(d2k_map_node_child_subsector(node->children[1]), 0);
+
+  problem = array_index_fast(&repairs, 0);
+  assert_int_equal(problem->type, D2K_MAP_PROBLEM_INVALID_NODE_CHILD_INDEX);
+  assert_int_equal(problem->lump, D2K_MAP_LUMP_NODES);
+  assert_int_equal(problem->record, 0);
+  assert_int_equal(problem->as.invalid_node_child_index.side, 0);
+  assert_true(problem->as.invalid_node_child_index.subsector);
+  assert_int_equal(problem->as.invalid_node_child_index.index, 3);
+  assert_int_equal(problem->as.invalid_node_child_index.count, 0);
+
+  problem = array_index_fast(&repairs, 1);
+  assert_int_equal(problem->as.invalid_node_child_index.side, 1);
+  assert_int_equal(problem->as.invalid_node_child_index.index, 0);
+
+  linedef = array_index_fast(&map.linedefs, 0);
+
+  problem = array_index_fast(&repairs, 2);
+  assert_int_equal(problem->type,
+                   D2K_MAP_PROBLEM_INVALID_SEG_END_VERTEX_INDEX);
+  assert_int_equal(problem->lump, D2K_MAP_LUMP_SEGS);
+  assert_int_equal(problem->record, 0);
+  assert_true(problem->as.invalid_index.index == 9);
+  assert_int_equal(problem->as.invalid_index.count, 2);
+
+  problem = array_index_fast(&repairs, 3);
+  assert_int_equal(problem->type,
+                   D2K_MAP_PROBLEM_TWO_SIDED_SEG_MISSING_OTHER_SIDE);
+  assert_int_equal(problem->record, 0);
+
+  seg = array_index_fast(&map.segs, 0);
+  assert_ptr_equal(seg->v1, linedef->v1);
+  assert_ptr_equal(seg->v2, linedef->v2);
+  assert_ptr_equal(seg->front_sector, array_index_fast(&map.sectors, 0));
+  assert_non_null(seg->back_sector);
+  assert_ptr_equal(seg->back_sector, map.null_sector);
+  assert_int_equal(seg->back_sector->id, D2K_MAP_NULL_SECTOR_ID);
+  assert_int_equal(seg->back_sector->floor_height, 0);
+  assert_int_equal(seg->back_sector->ceiling_height, 0);
+
+  /* Side 1 is the back, so the vertexes are flipped */
+  seg = array_index_fast(&map.segs, 1);
+  assert_ptr_equal(seg->v1, linedef->v2);
+  assert_ptr_equal(seg->v2, linedef->v1);
+  assert_null(seg->front_sector);
+  assert_ptr_equal(seg->back_sector, array_index_fast(&map.sectors, 0));
+
+  d2k_map_clear(&map);
+  assert_null(map.null_sector);
+  array_free(&repairs);
+}
+
+/* vi: set et ts=2 sw=2: */
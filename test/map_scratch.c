@@ -0,0 +1,51 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+void test_map_scratch(void **state) {
+  Status status;
+  GridMap grid;
+  D2KMapScratch scratch1;
+  D2KMapScratch scratch2;
+
+  (void)state;
+
+  status_init(&status);
+
+  assert_true(grid_map_init(&grid, 2, 2, &status));
+  assert_true(d2k_map_scratch_init(&scratch1, &grid.map, &status));
+  assert_true(d2k_map_scratch_init(&scratch2, &grid.map, &status));
+
+  assert_int_equal(scratch1.lines.stamps.len, grid.map.linedefs.len);
+  assert_int_equal(scratch1.sectors.stamps.len, grid.map.sectors.len);
+  assert_int_equal(scratch1.vertex_view_angles.len, grid.map.vertexes.len);
+
+  /* Marks last for one pass, and don't leak between simulations */
+  d2k_stamp_table_next_pass(&scratch1.lines);
+  d2k_stamp_table_next_pass(&scratch2.lines);
+  assert_true(d2k_stamp_table_mark(&scratch1.lines, 3));
+  assert_false(d2k_stamp_table_mark(&scratch1.lines, 3));
+  assert_true(d2k_stamp_table_is_marked(&scratch1.lines, 3));
+  assert_false(d2k_stamp_table_is_marked(&scratch2.lines, 3));
+  d2k_stamp_table_next_pass(&scratch1.lines);
+  assert_false(d2k_stamp_table_is_marked(&scratch1.lines, 3));
+
+  /* Wrapping around clears old marks instead of resurrecting them */
+  assert_true(d2k_stamp_table_mark(&scratch1.lines, 4));
+  scratch1.lines.current = UINT32_MAX;
+  d2k_stamp_table_next_pass(&scratch1.lines);
+  assert_int_equal(scratch1.lines.current, 1);
+  assert_false(d2k_stamp_table_is_marked(&scratch1.lines, 4));
+
+  *d2k_map_scratch_vertex_view_angle(&scratch1, 2) = 1234;
+  assert_int_equal(*d2k_map_scratch_vertex_view_angle(&scratch2, 2), 0);
+
+  d2k_map_scratch_free(&scratch1);
+  d2k_map_scratch_free(&scratch2);
+  grid_map_free(&grid);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,130 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+static size_t count_things(D2KMapSectorNodes *nodes, D2KSector *sector) {
+  size_t count = 0;
+
+  for (D2KMapSectorNode *node = d2k_map_sector_nodes_sector_things(nodes,
+                                                                   sector->id);
+       node;
+       node = node->next_sector_map_sector_node) {
+    assert_ptr_equal(node->sector, sector);
+    count++;
+  }
+
+  return count;
+}
+
+static D2KMapSectorNode* find_node(D2KMapObject *map_object,
+                                   D2KSector *sector) {
+  for (D2KMapSectorNode *node = map_object->touching_sectorlist;
+       node;
+       node = node->next_thing_map_sector_node) {
+    if (node->sector == sector) {
+      return node;
+    }
+  }
+
+  return NULL;
+}
+
+void test_map_sector_nodes(void **state) {
+  Status status;
+  GridMap grid;
+  D2KMapSectorNodes nodes;
+  D2KMapObject imp;
+  D2KMapObject demon;
+  D2KSector *a;
+  D2KSector *b;
+  D2KSector *c;
+  D2KSector *null_sector;
+  D2KMapSectorNode *kept;
+
+  (void)state;
+
+  status_init(&status);
+  memset(&imp, 0, sizeof(D2KMapObject));
+  memset(&demon, 0, sizeof(D2KMapObject));
+
+  assert_true(grid_map_init(&grid, 3, 1, &status));
+  assert_true(d2k_map_sector_nodes_init(&nodes, &grid.map, &status));
+
+  a = grid_map_sector(&grid, 0, 0);
+  b = grid_map_sector(&grid, 1, 0);
+  c = grid_map_sector(&grid, 2, 0);
+
+  /* The imp straddles a and b, the demon sits in b */
+  d2k_map_sector_nodes_begin(&imp);
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, a, &status));
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, b, &status));
+  d2k_map_sector_nodes_end(&nodes, &imp);
+
+  d2k_map_sector_nodes_begin(&demon);
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &demon, b, &status));
+  d2k_map_sector_nodes_end(&nodes, &demon);
+
+  assert_int_equal(nodes.live_count, 3);
+  assert_int_equal(count_things(&nodes, a), 1);
+  assert_int_equal(count_things(&nodes, b), 2);
+  assert_int_equal(count_things(&nodes, c), 0);
+
+  /* Moving into b and c keeps b's node, drops a's and adds c's */
+  kept = find_node(&imp, b);
+  d2k_map_sector_nodes_begin(&imp);
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, b, &status));
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, c, &status));
+  d2k_map_sector_nodes_end(&nodes, &imp);
+
+  assert_ptr_equal(find_node(&imp, b), kept);
+  assert_null(find_node(&imp, a));
+  assert_non_null(find_node(&imp, c));
+  assert_int_equal(nodes.live_count, 3);
+  assert_int_equal(count_things(&nodes, a), 0);
+  assert_int_equal(count_things(&nodes, b), 2);
+  assert_int_equal(count_things(&nodes, c), 1);
+
+  /* Dropping the head of the imp's list */
+  d2k_map_sector_nodes_begin(&imp);
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, b, &status));
+  d2k_map_sector_nodes_end(&nodes, &imp);
+  assert_ptr_equal(imp.touching_sectorlist, kept);
+  assert_null(kept->previous_thing_map_sector_node);
+  assert_null(kept->next_thing_map_sector_node);
+  assert_int_equal(count_things(&nodes, c), 0);
+
+  d2k_map_sector_nodes_unlink_all(&nodes, &imp);
+  assert_null(imp.touching_sectorlist);
+  assert_int_equal(count_things(&nodes, b), 1);
+  assert_int_equal(nodes.live_count, 1);
+
+  /* Spent nodes are recycled rather than allocated */
+  d2k_map_sector_nodes_begin(&imp);
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, a, &status));
+  d2k_map_sector_nodes_end(&nodes, &imp);
+  assert_ptr_equal(imp.touching_sectorlist, kept);
+  assert_int_equal(nodes.chunks.len, 1);
+
+  /* The null sector has no slot, so touching it links nothing */
+  assert_true(d2k_map_get_null_sector(&grid.map, &null_sector, &status));
+  d2k_map_sector_nodes_begin(&imp);
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, a, &status));
+  assert_true(d2k_map_sector_nodes_touch(&nodes, &imp, null_sector, &status));
+  d2k_map_sector_nodes_end(&nodes, &imp);
+  assert_null(find_node(&imp, null_sector));
+  assert_non_null(find_node(&imp, a));
+
+  /* Map change */
+  assert_true(d2k_map_sector_nodes_reset(&nodes, &grid.map, &status));
+  assert_int_equal(nodes.live_count, 0);
+  assert_int_equal(count_things(&nodes, a), 0);
+  assert_int_equal(count_things(&nodes, b), 0);
+
+  d2k_map_sector_nodes_free(&nodes);
+  grid_map_free(&grid);
+}
+
+/* vi: set et ts=2 sw=2: */
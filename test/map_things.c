@@ -0,0 +1,154 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+typedef struct {
+  int16_t  types[8];
+  uint16_t map_object_types[8];
+  size_t   count;
+} SpawnLog;
+
+static bool log_spawn(const D2KMapThing *thing, uint16_t map_object_type,
+                                                void *data) {
+  SpawnLog *log = data;
+
+  log->types[log->count] = thing->type;
+  log->map_object_types[log->count] = map_object_type;
+  log->count++;
+
+  return true;
+}
+
+static void put_thing(char *data, int16_t x, int16_t y, int16_t angle,
+                                  int16_t type, int16_t options) {
+  int16_t fields[5] = { x, y, angle, type, options };
+
+  for (size_t i = 0; i < 5; i++) {
+    data[i * 2]     = (char)((uint16_t)fields[i] & 0xFF);
+    data[i * 2 + 1] = (char)((uint16_t)fields[i] >> 8);
+  }
+}
+
+void test_map_things(void **state) {
+  Status status;
+  D2KMap map;
+  D2KMapLoader map_loader;
+  D2KLump things_lump;
+  D2KMapObjectInfo infos[4];
+  D2KMapThingTypes types;
+  D2KMapThingTable table;
+  D2KMapThing *thing;
+  SpawnLog log;
+  const uint32_t *indexes;
+  size_t count;
+  uint64_t mask;
+  char data[60];
+
+  (void)state;
+
+  status_init(&status);
+  d2k_map_init(&map);
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  memset(&things_lump, 0, sizeof(D2KLump));
+  memset(infos, 0, sizeof(infos));
+
+  put_thing(data,      -96, 128,  90,    1, 7);
+  put_thing(data + 10, 256, -32, 180, 3004, 7);
+  put_thing(data + 20,  64,  64,   0,    9, 4);
+  put_thing(data + 30,   0,   0, 270,    9, 7 | 16);
+  put_thing(data + 40,  32,  32,   0, 1234, 7 | 32 | 256);
+  put_thing(data + 50,  16,  16,  45,   11, 0);
+
+  map_loader.map = &map;
+  map_loader.map_lumps[D2K_MAP_LUMP_THINGS] = &things_lump;
+  things_lump.data.data = data;
+  things_lump.data.len = 59;
+  assert_false(d2k_map_loader_load_things(&map_loader, &status));
+  assert_true(status_match(&status, "d2k_map_things",
+                                    D2K_MAP_THINGS_MALFORMED_LUMP));
+  status_clear(&status);
+
+  things_lump.data.len = sizeof(data);
+  assert_true(d2k_map_loader_load_things(&map_loader, &status));
+  assert_int_equal(map.things.len, 6);
+
+  thing = array_index_fast(&map.things, 1);
+  assert_int_equal(thing->x, 256);
+  assert_int_equal(thing->y, -32);
+  assert_int_equal(thing->angle, 180);
+  assert_int_equal(thing->type, 3004);
+  assert_int_equal(thing->options, 7);
+
+  /* The reserved bit means the Boom bits are junk, so they're dropped */
+  thing = array_index_fast(&map.things, 4);
+  assert_int_equal(thing->options, 7);
+
+  /* The first info claiming a doomednum wins; -1 isn't spawnable */
+  infos[0].doomednum = 3004;
+  infos[1].doomednum = 9;
+  infos[2].doomednum = -1;
+  infos[3].doomednum = 3004;
+  assert_true(d2k_map_thing_types_init(&types, infos, 4, &status));
+  assert_int_equal(d2k_map_thing_types_lookup(&types, 3004), 0);
+  assert_int_equal(d2k_map_thing_types_lookup(&types, 9), 1);
+  assert_int_equal(d2k_map_thing_types_lookup(&types, 1),
+                   D2K_MAP_THING_NO_TYPE);
+  assert_int_equal(d2k_map_thing_types_lookup(&types, -1),
+                   D2K_MAP_THING_NO_TYPE);
+  assert_int_equal(d2k_map_thing_types_lookup(&types, 5000),
+                   D2K_MAP_THING_NO_TYPE);
+
+  assert_true(d2k_map_thing_table_init(&table, &map, &types, &status));
+
+  indexes = d2k_map_thing_table_type(&table, 1, &count);
+  assert_int_equal(count, 2);
+  assert_int_equal(indexes[0], 2);
+  assert_int_equal(indexes[1], 3);
+
+  indexes = d2k_map_thing_table_type(&table, 0, &count);
+  assert_int_equal(count, 1);
+  assert_int_equal(indexes[0], 1);
+
+  assert_null(d2k_map_thing_table_type(&table, 2, &count));
+  assert_int_equal(count, 0);
+  assert_null(d2k_map_thing_table_type(&table, 300, &count));
+  assert_int_equal(count, 0);
+
+  /* Starts and the unknown doomednum, in lump order */
+  indexes = d2k_map_thing_table_type(&table, D2K_MAP_THING_NO_TYPE, &count);
+  assert_int_equal(count, 3);
+  assert_int_equal(indexes[0], 0);
+  assert_int_equal(indexes[1], 4);
+  assert_int_equal(indexes[2], 5);
+
+  /* Single player on medium skips the hard-only and multiplayer things */
+  mask = d2k_map_thing_spawn_mask(2, D2K_MAP_THING_PLAY_MODE_SINGLE_PLAYER);
+  assert_int_equal(d2k_map_thing_table_spawn_count(&table, mask), 4);
+  memset(&log, 0, sizeof(SpawnLog));
+  assert_true(d2k_map_thing_table_spawn(&table, mask, log_spawn, &log));
+  assert_int_equal(log.count, 4);
+  assert_int_equal(log.types[0], 1);
+  assert_int_equal(log.types[1], 3004);
+  assert_int_equal(log.types[2], 1234);
+  assert_int_equal(log.types[3], 11);
+  assert_int_equal(log.map_object_types[1], 0);
+  assert_int_equal(log.map_object_types[2], D2K_MAP_THING_NO_TYPE);
+
+  /* Cooperative on nightmare spawns everything, still in lump order */
+  mask = d2k_map_thing_spawn_mask(4, D2K_MAP_THING_PLAY_MODE_COOPERATIVE);
+  assert_int_equal(d2k_map_thing_table_spawn_count(&table, mask), 6);
+  memset(&log, 0, sizeof(SpawnLog));
+  assert_true(d2k_map_thing_table_spawn(&table, mask, log_spawn, &log));
+  assert_int_equal(log.count, 6);
+  assert_int_equal(log.types[2], 9);
+  assert_int_equal(log.types[3], 9);
+  assert_int_equal(log.map_object_types[3], 1);
+
+  d2k_map_thing_table_free(&table);
+  d2k_map_thing_types_free(&types);
+  d2k_map_clear(&map);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,339 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+static const char textmap[] =
+  "// Converted from MAP01\n"
+  "namespace = \"Doom\";\n"
+  "\n"
+  "thing { x = 64.5; y = -32.0; angle = 90; type = 3004;\n"
+  "        skill2 = true; skill3 = true; single = true; ambush = true; }\n"
+  "thing { x = 0; y = 0; type = 1; skill1 = true; skill5 = true;\n"
+  "        coop = true; dm = true; single = true; }\n"
+  "vertex { x = 0.0; y = 0.0; }\n"
+  "vertex { x = 128.25; y = 0x40; }\n"
+  "/* A two-sided line\n"
+  "   with a back */\n"
+  "LineDef { v1 = 0; v2 = 1; sidefront = 0; sideback = 1;\n"
+  "          twosided = true; blocking = true; blocking = false;\n"
+  "          special = 11; comment = \"ignored\"; }\n"
+  "linedef { v1 = 1; v2 = 0; sidefront = 1; }\n"
+  "sidedef { sector = 0; offsetx = -8; texturemiddle = \"startan3\"; }\n"
+  "sidedef { sector = 0; texturetop = \"we\\\"ird\"; }\n"
+  "sector { heightfloor = -16; heightceiling = 128; texturefloor = \"FLOOR4_8\";\n"
+  "         textureceiling = \"CEIL3_5\"; id = 7; }\n"
+  "unknownblock { anything = 1.0e3; }\n";
+
+/* Only default textures, so the name caches can stand in for a WAD */
+static const char tagged[] =
+  "vertex { x = 0.0; y = 0.0; }\n"
+  "vertex { x = 1.0; y = 0.0; }\n"
+  "sidedef { sector = 1; }\n"
+  "sector { texturefloor = \"F\"; textureceiling = \"F\"; }\n"
+  "sector { texturefloor = \"F\"; textureceiling = \"F\"; id = 100; }\n"
+  "sector { texturefloor = \"F\"; textureceiling = \"F\"; id = 100; }\n"
+  "linedef { v1 = 0; v2 = 1; sidefront = 0; }\n"
+  "linedef { v1 = 1; v2 = 0; sidefront = 0; id = 100; }\n";
+
+static void assert_parse_fails(const char *text, int code) {
+  Status status;
+  D2KUDMFRecords records;
+
+  status_init(&status);
+  d2k_udmf_records_init(&records);
+  assert_false(d2k_udmf_parse(&records, text, strlen(text), &status));
+  assert_true(status_match(&status, "d2k_map_udmf", code));
+  assert_true(records.error_offset > 0);
+  status_clear(&status);
+  d2k_udmf_records_free(&records);
+}
+
+static void assert_arrays_equal(Array *a, Array *b) {
+  assert_int_equal(a->len, b->len);
+
+  if (a->len) {
+    assert_memory_equal(a->elements, b->elements, a->len * a->element_size);
+  }
+}
+
+static void assert_parallel_matches(const char *text, size_t len) {
+  Status status;
+  D2KUDMFRecords serial;
+
+  status_init(&status);
+  d2k_udmf_records_init(&serial);
+  assert_true(d2k_udmf_parse(&serial, text, len, &status));
+
+  for (size_t thread_count = 0; thread_count <= 20; thread_count++) {
+    D2KUDMFRecords parallel;
+
+    d2k_udmf_records_init(&parallel);
+    assert_true(d2k_udmf_parse_parallel(&parallel, text, len, thread_count,
+                                                              &status));
+    assert_arrays_equal(&parallel.things, &serial.things);
+    assert_arrays_equal(&parallel.vertexes, &serial.vertexes);
+    assert_arrays_equal(&parallel.linedefs, &serial.linedefs);
+    assert_arrays_equal(&parallel.sidedefs, &serial.sidedefs);
+    assert_arrays_equal(&parallel.sectors, &serial.sectors);
+    d2k_udmf_records_free(&parallel);
+  }
+
+  d2k_udmf_records_free(&serial);
+}
+
+static void test_parallel(void) {
+  /* Braces in strings and comments make for bad cuts */
+  static const char tricky[] =
+    "vertex { x = 0.0; y = 0.0; } // a } here\n"
+    "sidedef { sector = 0; texturetop = \"}}}}\"; }\n"
+    "/* } } } */ vertex { x = 1.0; y = 1.0; }\n"
+    "sector { texturefloor = \"F}\"; textureceiling = \"C{\"; }\n"
+    "/*\n}\n}\n*/\n"
+    "vertex { x = 2.0; y = 2.0; }\n";
+  static const char broken[] =
+    "vertex { x = 0.0; y = 0.0; }\n"
+    "vertex { x = 1.0; y = 1.0; }\n"
+    "vertex { x = 2.0; y = 2.0 }\n"
+    "vertex { x = 3.0; y = 3.0; }\n";
+  Status status;
+  D2KUDMFRecords serial;
+  D2KUDMFRecords parallel;
+
+  assert_parallel_matches(textmap, sizeof(textmap) - 1);
+  assert_parallel_matches(tricky, sizeof(tricky) - 1);
+
+  /* Errors come out as they would from a serial parse */
+  status_init(&status);
+  d2k_udmf_records_init(&serial);
+  d2k_udmf_records_init(&parallel);
+  assert_false(d2k_udmf_parse(&serial, broken, sizeof(broken) - 1, &status));
+  status_clear(&status);
+  assert_false(d2k_udmf_parse_parallel(&parallel, broken, sizeof(broken) - 1,
+                                                          4,
+                                                          &status));
+  assert_true(status_match(&status, "d2k_map_udmf",
+                                    D2K_MAP_UDMF_SYNTAX_ERROR));
+  assert_int_equal(parallel.error_offset, serial.error_offset);
+  status_clear(&status);
+  d2k_udmf_records_free(&serial);
+  d2k_udmf_records_free(&parallel);
+}
+
+static void test_lexer(void) {
+  static const char text[] = " Thing{x=-1.5e2;/**/y=\"a\\\"b\";}";
+  Status status;
+  D2KUDMFLexer lexer;
+  D2KUDMFToken token;
+  D2KUDMFTokenType expected[] = {
+    D2K_UDMF_TOKEN_IDENTIFIER,
+    D2K_UDMF_TOKEN_OPEN_BRACE,
+    D2K_UDMF_TOKEN_IDENTIFIER,
+    D2K_UDMF_TOKEN_EQUALS,
+    D2K_UDMF_TOKEN_FLOAT,
+    D2K_UDMF_TOKEN_SEMICOLON,
+    D2K_UDMF_TOKEN_IDENTIFIER,
+    D2K_UDMF_TOKEN_EQUALS,
+    D2K_UDMF_TOKEN_STRING,
+    D2K_UDMF_TOKEN_SEMICOLON,
+    D2K_UDMF_TOKEN_CLOSE_BRACE,
+    D2K_UDMF_TOKEN_END,
+    D2K_UDMF_TOKEN_END,
+  };
+
+  status_init(&status);
+  d2k_udmf_lexer_init(&lexer, text, sizeof(text) - 1);
+
+  for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+    assert_true(d2k_udmf_lexer_next(&lexer, &token, &status));
+    assert_int_equal(token.type, expected[i]);
+
+    if (i == 0) {
+      assert_int_equal(token.key, D2K_UDMF_KEY_THING);
+      assert_ptr_equal(token.text, text + 1);
+    }
+    else if (i == 4) {
+      assert_int_equal(token.len, 6);
+    }
+    else if (i == 8) {
+      assert_int_equal(token.len, 4);
+      assert_memory_equal(token.text, "a\\\"b", 4);
+    }
+  }
+
+  assert_int_equal(d2k_udmf_key("SideFront", 9), D2K_UDMF_KEY_SIDEFRONT);
+  assert_int_equal(d2k_udmf_key("x", 1), D2K_UDMF_KEY_X);
+  assert_int_equal(d2k_udmf_key("ambush", 6), D2K_UDMF_KEY_AMBUSH);
+  assert_int_equal(d2k_udmf_key("y", 1), D2K_UDMF_KEY_Y);
+  assert_int_equal(d2k_udmf_key("sidefronts", 10), D2K_UDMF_KEY_UNKNOWN);
+  assert_int_equal(d2k_udmf_key("side", 4), D2K_UDMF_KEY_UNKNOWN);
+}
+
+void test_map_udmf(void **state) {
+  Status status;
+  D2KUDMFRecords records;
+  D2KUDMFRecords tagged_records;
+  D2KMapThing *thing;
+  D2KFixedVertex *vertex;
+  D2KUDMFLinedef *linedef;
+  D2KUDMFSidedef *sidedef;
+  D2KUDMFSector *sector;
+  D2KMap map;
+  D2KMapLoader map_loader;
+
+  (void)state;
+
+  test_lexer();
+  test_parallel();
+
+  status_init(&status);
+  d2k_udmf_records_init(&records);
+  assert_true(d2k_udmf_parse(&records, textmap, sizeof(textmap) - 1,
+                                       &status));
+
+  assert_int_equal(records.things.len, 2);
+  assert_int_equal(records.vertexes.len, 2);
+  assert_int_equal(records.linedefs.len, 2);
+  assert_int_equal(records.sidedefs.len, 2);
+  assert_int_equal(records.sectors.len, 1);
+
+  thing = array_index_fast(&records.things, 0);
+  assert_int_equal(thing->x, 64);
+  assert_int_equal(thing->y, -32);
+  assert_int_equal(thing->angle, 90);
+  assert_int_equal(thing->type, 3004);
+  assert_int_equal(thing->options, D2K_MAP_THING_OPTION_EASY           |
+                                   D2K_MAP_THING_OPTION_NORMAL         |
+                                   D2K_MAP_THING_OPTION_AMBUSH         |
+                                   D2K_MAP_THING_OPTION_NOT_DEATHMATCH |
+                                   D2K_MAP_THING_OPTION_NOT_COOP);
+
+  thing = array_index_fast(&records.things, 1);
+  assert_int_equal(thing->options, D2K_MAP_THING_OPTION_EASY |
+                                   D2K_MAP_THING_OPTION_HARD);
+
+  vertex = array_index_fast(&records.vertexes, 1);
+  assert_int_equal(vertex->x, 128 * FRACUNIT + FRACUNIT / 4);
+  assert_int_equal(vertex->y, 64 * FRACUNIT);
+
+  linedef = array_index_fast(&records.linedefs, 0);
+  assert_int_equal(linedef->v1, 0);
+  assert_int_equal(linedef->v2, 1);
+  assert_int_equal(linedef->front_side, 0);
+  assert_int_equal(linedef->back_side, 1);
+  assert_int_equal(linedef->special, 11);
+  assert_int_equal(linedef->flags, D2K_LINEDEF_FLAG_TWO_SIDED);
+
+  linedef = array_index_fast(&records.linedefs, 1);
+  assert_int_equal(linedef->back_side, -1);
+  assert_int_equal(linedef->flags, 0);
+
+  sidedef = array_index_fast(&records.sidedefs, 0);
+  assert_int_equal(sidedef->texture_offset, -8 * FRACUNIT);
+  assert_memory_equal(sidedef->mid_texture, "STARTAN3", 8);
+  assert_memory_equal(sidedef->top_texture, "-\0\0\0\0\0\0\0", 8);
+
+  sidedef = array_index_fast(&records.sidedefs, 1);
+  assert_memory_equal(sidedef->top_texture, "WE\"IRD\0\0", 8);
+
+  sector = array_index_fast(&records.sectors, 0);
+  assert_int_equal(sector->floor_height, -16 * FRACUNIT);
+  assert_int_equal(sector->ceiling_height, 128 * FRACUNIT);
+  assert_int_equal(sector->light_level, 160);
+  assert_int_equal(sector->tag, 7);
+  assert_memory_equal(sector->floor_texture, "FLOOR4_8", 8);
+  assert_memory_equal(sector->ceiling_texture, "CEIL3_5\0", 8);
+
+  assert_parse_fails("thing { x = 0; y = 0; }", D2K_MAP_UDMF_MISSING_FIELD);
+  assert_parse_fails("vertex { x = 0.0 y = 0.0; }",
+                     D2K_MAP_UDMF_SYNTAX_ERROR);
+  assert_parse_fails("vertex { x = 0.0; y = 1e; }",
+                     D2K_MAP_UDMF_INVALID_VALUE);
+  assert_parse_fails("vertex { x = 0.0; y = 40000.0; }",
+                     D2K_MAP_UDMF_INVALID_VALUE);
+  assert_parse_fails("linedef { v1 = 08; }", D2K_MAP_UDMF_INVALID_VALUE);
+  assert_parse_fails("sidedef { texturetop = \"TOOLONGNAME\"; }",
+                     D2K_MAP_UDMF_INVALID_VALUE);
+  assert_parse_fails("sector { texturefloor = \"X; }",
+                     D2K_MAP_UDMF_UNTERMINATED_STRING);
+  assert_parse_fails("/* never closed", D2K_MAP_UDMF_UNTERMINATED_COMMENT);
+  assert_parse_fails("vertex { x = 0x1.8p1; y = 0.0; }",
+                     D2K_MAP_UDMF_INVALID_VALUE);
+
+  assert_parse_fails("namespace = \"zdoom\";",
+                     D2K_MAP_UDMF_UNSUPPORTED_NAMESPACE);
+  assert_parse_fails("namespace = doom;", D2K_MAP_UDMF_UNSUPPORTED_NAMESPACE);
+
+  /*
+   * Linedef ids are tags, matched against sector ids like vanilla's
+   * P_FindSectorFromLineTag: the first sector with the tag, whatever the
+   * sector count.
+   */
+  d2k_udmf_records_init(&tagged_records);
+  assert_true(d2k_udmf_parse(&tagged_records, tagged, sizeof(tagged) - 1,
+                                              &status));
+  d2k_map_init(&map);
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  map_loader.map = &map;
+  d2k_lump_name_cache_init(&map_loader.texture_name_cache);
+  d2k_lump_name_cache_init(&map_loader.flat_name_cache);
+  d2k_lump_name_cache_put(&map_loader.texture_name_cache,
+                          d2k_lump_name_cache_key("-\0\0\0\0\0\0\0"), 0);
+  d2k_lump_name_cache_put(&map_loader.flat_name_cache,
+                          d2k_lump_name_cache_key("F\0\0\0\0\0\0\0"), 0);
+  assert_true(d2k_map_loader_load_udmf_records(&map_loader, &tagged_records,
+                                                            &status));
+  assert_ptr_equal(
+    ((D2KLinedef *)array_index_fast(&map.linedefs, 0))->tagged_sector,
+    array_index_fast(&map.sectors, 0)
+  );
+  assert_ptr_equal(
+    ((D2KLinedef *)array_index_fast(&map.linedefs, 1))->tagged_sector,
+    array_index_fast(&map.sectors, 1)
+  );
+  assert_int_equal(
+    ((D2KLinedef *)array_index_fast(&map.linedefs, 1))->tag, 100
+  );
+
+  /* A tag no sector has is fine; the line just tags nothing */
+  d2k_map_clear(&map);
+  linedef = array_index_fast(&tagged_records.linedefs, 1);
+  linedef->id = 2;
+  assert_true(d2k_map_loader_load_udmf_records(&map_loader, &tagged_records,
+                                                            &status));
+  assert_null(
+    ((D2KLinedef *)array_index_fast(&map.linedefs, 1))->tagged_sector
+  );
+  d2k_map_clear(&map);
+  d2k_udmf_records_free(&tagged_records);
+
+  /* References are only checked once every block has been read */
+  d2k_map_init(&map);
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  map_loader.map = &map;
+  array_clear(&records.sidedefs);
+  array_clear(&records.sectors);
+  linedef = array_index_fast(&records.linedefs, 0);
+  linedef->v2 = 2;
+  assert_false(d2k_map_loader_load_udmf_records(&map_loader, &records,
+                                                             &status));
+  assert_true(status_match(&status, "d2k_map_udmf",
+                                    D2K_MAP_UDMF_INVALID_VERTEX_INDEX));
+  status_clear(&status);
+
+  d2k_map_clear(&map);
+  linedef->v2 = 1;
+  assert_false(d2k_map_loader_load_udmf_records(&map_loader, &records,
+                                                             &status));
+  assert_true(status_match(&status, "d2k_map_udmf",
+                                    D2K_MAP_UDMF_INVALID_SIDEDEF_INDEX));
+  status_clear(&status);
+  assert_int_equal(map.things.len, 2);
+  assert_int_equal(map.vertexes.len, 2);
+
+  d2k_map_clear(&map);
+  d2k_udmf_records_free(&records);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,445 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+static const char *bad_textmap =
+  "namespace = \"doom\";\n"
+  "vertex { x = 0.0; y = 0.0; }\n"
+  "vertex { x = 64.0; y = 0.0; }\n"
+  "linedef { v1 = 0; v2 = 5; sidefront = 0; twosided = true; }\n"
+  "linedef { v1 = -1; v2 = 1; sidefront = 0; sideback = 3; }\n"
+  "sidedef { sector = 2; }\n"
+  "sector { texturefloor = \"FLOOR4_8\"; textureceiling = \"CEIL3_5\"; }\n";
+
+static void put16(char *data, size_t offset, uint16_t value) {
+  data[offset]     = (char)(value & 0xFF);
+  data[offset + 1] = (char)(value >> 8);
+}
+
+static void set_lump(D2KLump *lump, char *data, size_t len) {
+  memset(lump, 0, sizeof(D2KLump));
+  lump->data.data = data;
+  lump->data.len = len;
+}
+
+static D2KMapProblem* problem_at(Array *problems, size_t index,
+                                                  D2KMapProblemType type,
+                                                  D2KMapLump lump,
+                                                  size_t record) {
+  D2KMapProblem *problem = array_index_fast(problems, index);
+
+  assert_int_equal(problem->type, type);
+  assert_int_equal(problem->lump, lump);
+  assert_int_equal(problem->record, record);
+
+  return problem;
+}
+
+static void assert_invalid_index(Array *problems, size_t index,
+                                                  D2KMapProblemType type,
+                                                  D2KMapLump lump,
+                                                  size_t record,
+                                                  int64_t bad_index,
+                                                  size_t count) {
+  D2KMapProblem *problem = problem_at(problems, index, type, lump, record);
+
+  assert_true(problem->as.invalid_index.index == bad_index);
+  assert_int_equal(problem->as.invalid_index.count, count);
+}
+
+/*
+ * Loads `linedefs_lump` into a map with 2 vertexes, 1 sidedef and 1 sector
+ * tagged `sector_tag`, so the loader can be checked against the validator.
+ */
+static void load_linedefs(D2KMap *map, D2KLump *linedefs_lump,
+                                       int16_t sector_tag,
+                                       Status *status) {
+  D2KMapLoader map_loader;
+  D2KSector *sector;
+  D2KSidedef *sidedef;
+
+  d2k_map_init(map);
+  assert_true(array_set_size(&map->vertexes, 2, status));
+  assert_true(array_set_size(&map->sectors, 1, status));
+  assert_true(array_set_size(&map->sidedefs, 1, status));
+  memset(array_index_fast(&map->vertexes, 0), 0, 2 * sizeof(D2KFixedVertex));
+
+  sector = array_index_fast(&map->sectors, 0);
+  memset(sector, 0, sizeof(D2KSector));
+  sector->tag = sector_tag;
+
+  sidedef = array_index_fast(&map->sidedefs, 0);
+  memset(sidedef, 0, sizeof(D2KSidedef));
+  sidedef->sector = sector;
+
+  memset(&map_loader, 0, sizeof(D2KMapLoader));
+  map_loader.map = map;
+  map_loader.map_lumps[D2K_MAP_LUMP_LINEDEFS] = linedefs_lump;
+
+  assert_true(d2k_map_loader_load_linedefs(&map_loader, status));
+}
+
+void test_map_validator(void **state) {
+  Status status;
+  Array problems;
+  D2KLump *lumps[D2K_VANILLA_MAP_LUMP_MAX];
+  D2KLump lump_storage[D2K_VANILLA_MAP_LUMP_MAX];
+  D2KLump textmap_lump;
+  D2KMapProblem *problem;
+  D2KMap map;
+  D2KLinedef *linedef;
+  char things[11];
+  char linedefs[3 * 14];
+  char sidedefs[2 * 30];
+  char vertexes[2 * 4];
+  char segs[2 * 12];
+  char subsectors[2 * 4];
+  char nodes[28];
+  char sectors[26];
+  char reject[1];
+  char blockmap[11 * 2];
+  char *bad_text = (char *)bad_textmap;
+
+  (void)state;
+
+  status_init(&status);
+  array_init(&problems, sizeof(D2KMapProblem));
+  memset(things, 0, sizeof(things));
+  memset(linedefs, 0, sizeof(linedefs));
+  memset(sidedefs, 0, sizeof(sidedefs));
+  memset(vertexes, 0, sizeof(vertexes));
+  memset(segs, 0, sizeof(segs));
+  memset(subsectors, 0, sizeof(subsectors));
+  memset(nodes, 0, sizeof(nodes));
+  memset(sectors, 0, sizeof(sectors));
+  memset(blockmap, 0, sizeof(blockmap));
+
+  put16(linedefs,  0, 0);
+  put16(linedefs,  2, 1);
+  put16(linedefs, 10, 0);
+  put16(linedefs, 12, 0xFFFF);
+  put16(linedefs, 14, 5);
+  put16(linedefs, 16, 1);
+  put16(linedefs, 18, D2K_LINEDEF_FLAG_TWO_SIDED);
+  put16(linedefs, 24, 1);
+  put16(linedefs, 26, 0xFFFF);
+  put16(linedefs, 28, 0);
+  put16(linedefs, 30, 9);
+  put16(linedefs, 38, 7);
+  put16(linedefs, 40, 8);
+
+  put16(sidedefs, 28, 0);
+  put16(sidedefs, 58, 3);
+
+  put16(segs,  0, 0);
+  put16(segs,  2, 1);
+  put16(segs, 12, 4);
+  put16(segs, 14, 1);
+  put16(segs, 18, 6);
+  put16(segs, 20, 2);
+
+  put16(subsectors, 0, 2);
+  put16(subsectors, 2, 0);
+  put16(subsectors, 4, 2);
+  put16(subsectors, 6, 1);
+
+  put16(nodes, 24, 0x8005);
+  put16(nodes, 26, 3);
+
+  /* 2x1 blocks: block 0 is fine, block 1 is bad and runs off the end */
+  put16(blockmap,  4, 2);
+  put16(blockmap,  6, 1);
+  put16(blockmap,  8, 6);
+  put16(blockmap, 10, 9);
+  put16(blockmap, 12, 0);
+  put16(blockmap, 14, 2);
+  put16(blockmap, 16, 0xFFFF);
+  put16(blockmap, 18, 0);
+  put16(blockmap, 20, 7);
+
+  memset(lumps, 0, sizeof(lumps));
+  lumps[D2K_VANILLA_MAP_LUMP_THINGS] = &lump_storage[1];
+  lumps[D2K_VANILLA_MAP_LUMP_LINEDEFS] = &lump_storage[2];
+  lumps[D2K_VANILLA_MAP_LUMP_SIDEDEFS] = &lump_storage[3];
+  lumps[D2K_VANILLA_MAP_LUMP_VERTEXES] = &lump_storage[4];
+  lumps[D2K_VANILLA_MAP_LUMP_SEGS] = &lump_storage[5];
+  lumps[D2K_VANILLA_MAP_LUMP_SSECTORS] = &lump_storage[6];
+  lumps[D2K_VANILLA_MAP_LUMP_NODES] = &lump_storage[7];
+  lumps[D2K_VANILLA_MAP_LUMP_SECTORS] = &lump_storage[8];
+  lumps[D2K_VANILLA_MAP_LUMP_REJECT] = &lump_storage[9];
+  lumps[D2K_VANILLA_MAP_LUMP_BLOCKMAP] = &lump_storage[10];
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_THINGS], things, sizeof(things));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_LINEDEFS], linedefs, sizeof(linedefs));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_SIDEDEFS], sidedefs, sizeof(sidedefs));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_VERTEXES], vertexes, sizeof(vertexes));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_SEGS], segs, sizeof(segs));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_SSECTORS], subsectors,
+                                                 sizeof(subsectors));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_NODES], nodes, sizeof(nodes));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_SECTORS], sectors, sizeof(sectors));
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_REJECT], reject, 0);
+  set_lump(lumps[D2K_VANILLA_MAP_LUMP_BLOCKMAP], blockmap, sizeof(blockmap));
+
+  assert_true(d2k_map_validate_lumps(lumps, false, &problems, &status));
+  assert_int_equal(problems.len, 16);
+
+  problem = problem_at(&problems, 0, D2K_MAP_PROBLEM_MALFORMED_LUMP,
+                                     D2K_MAP_LUMP_THINGS,
+                                     0);
+  assert_int_equal(problem->as.malformed_lump.lump_size, 11);
+  assert_int_equal(problem->as.malformed_lump.record_size, 10);
+
+  assert_invalid_index(&problems, 1,
+    D2K_MAP_PROBLEM_INVALID_LINEDEF_START_VERTEX_INDEX,
+    D2K_MAP_LUMP_LINEDEFS, 1, 5, 2
+  );
+  problem_at(&problems, 2, D2K_MAP_PROBLEM_TWO_SIDED_LINEDEF_MISSING_BACK_SIDE,
+                           D2K_MAP_LUMP_LINEDEFS,
+                           1);
+  assert_invalid_index(&problems, 3,
+    D2K_MAP_PROBLEM_INVALID_LINEDEF_END_VERTEX_INDEX,
+    D2K_MAP_LUMP_LINEDEFS, 2, 9, 2
+  );
+  assert_invalid_index(&problems, 4,
+    D2K_MAP_PROBLEM_INVALID_LINEDEF_FRONT_SIDEDEF_INDEX,
+    D2K_MAP_LUMP_LINEDEFS, 2, 7, 2
+  );
+  assert_invalid_index(&problems, 5,
+    D2K_MAP_PROBLEM_INVALID_LINEDEF_BACK_SIDEDEF_INDEX,
+    D2K_MAP_LUMP_LINEDEFS, 2, 8, 2
+  );
+  assert_invalid_index(&problems, 6,
+    D2K_MAP_PROBLEM_INVALID_SIDEDEF_SECTOR_INDEX,
+    D2K_MAP_LUMP_SIDEDEFS, 1, 3, 1
+  );
+  assert_invalid_index(&problems, 7,
+    D2K_MAP_PROBLEM_INVALID_SEG_START_VERTEX_INDEX,
+    D2K_MAP_LUMP_SEGS, 1, 4, 2
+  );
+  assert_invalid_index(&problems, 8,
+    D2K_MAP_PROBLEM_INVALID_SEG_LINEDEF_INDEX,
+    D2K_MAP_LUMP_SEGS, 1, 6, 3
+  );
+  problem = problem_at(&problems, 9, D2K_MAP_PROBLEM_INVALID_SEG_LINE_SIDE,
+                                     D2K_MAP_LUMP_SEGS,
+                                     1);
+  assert_int_equal(problem->as.invalid_seg_line_side.side, 2);
+
+  problem = problem_at(&problems, 10, D2K_MAP_PROBLEM_OUT_OF_RANGE_SEG_LIST,
+                                      D2K_MAP_LUMP_SSECTORS,
+                                      1);
+  assert_int_equal(problem->as.out_of_range_seg_list.first_seg, 1);
+  assert_int_equal(problem->as.out_of_range_seg_list.seg_count, 2);
+  assert_int_equal(problem->as.out_of_range_seg_list.total_seg_count, 2);
+
+  problem = problem_at(&problems, 11, D2K_MAP_PROBLEM_INVALID_NODE_CHILD_INDEX,
+                                      D2K_MAP_LUMP_NODES,
+                                      0);
+  assert_int_equal(problem->as.invalid_node_child_index.side, 0);
+  assert_true(problem->as.invalid_node_child_index.subsector);
+  assert_int_equal(problem->as.invalid_node_child_index.index, 5);
+  assert_int_equal(problem->as.invalid_node_child_index.count, 2);
+
+  problem = problem_at(&problems, 12, D2K_MAP_PROBLEM_INVALID_NODE_CHILD_INDEX,
+                                      D2K_MAP_LUMP_NODES,
+                                      0);
+  assert_int_equal(problem->as.invalid_node_child_index.side, 1);
+  assert_false(problem->as.invalid_node_child_index.subsector);
+  assert_int_equal(problem->as.invalid_node_child_index.index, 3);
+  assert_int_equal(problem->as.invalid_node_child_index.count, 1);
+
+  problem = problem_at(&problems, 13, D2K_MAP_PROBLEM_TRUNCATED_REJECT,
+                                      D2K_MAP_LUMP_REJECT,
+                                      0);
+  assert_int_equal(problem->as.truncated_reject.lump_size, 0);
+  assert_int_equal(problem->as.truncated_reject.expected_size, 1);
+
+  assert_invalid_index(&problems, 14,
+    D2K_MAP_PROBLEM_INVALID_BLOCKMAP_LINEDEF_INDEX,
+    D2K_MAP_LUMP_BLOCKMAP, 1, 7, 3
+  );
+  problem = problem_at(&problems, 15,
+    D2K_MAP_PROBLEM_UNTERMINATED_BLOCKMAP_LINE_LIST,
+    D2K_MAP_LUMP_BLOCKMAP,
+    1
+  );
+  assert_int_equal(problem->as.blockmap_line_list.offset, 9);
+
+  /* Blocks sharing a bad list only report it once */
+  put16(blockmap, 8, 9);
+  put16(subsectors, 0, 1);
+  array_clear(&problems);
+  lumps[D2K_VANILLA_MAP_LUMP_THINGS]->data.len = 10;
+  lumps[D2K_VANILLA_MAP_LUMP_LINEDEFS]->data.len = 14;
+  lumps[D2K_VANILLA_MAP_LUMP_SIDEDEFS]->data.len = 30;
+  lumps[D2K_VANILLA_MAP_LUMP_SEGS]->data.len = 12;
+  lumps[D2K_VANILLA_MAP_LUMP_SSECTORS]->data.len = 4;
+  lumps[D2K_VANILLA_MAP_LUMP_NODES] = NULL;
+  lumps[D2K_VANILLA_MAP_LUMP_REJECT]->data.len = 1;
+  assert_true(d2k_map_validate_lumps(lumps, false, &problems, &status));
+  assert_int_equal(problems.len, 3);
+  problem_at(&problems, 0, D2K_MAP_PROBLEM_MISSING_LUMP,
+                           D2K_MAP_LUMP_NODES,
+                           0);
+  assert_invalid_index(&problems, 1,
+    D2K_MAP_PROBLEM_INVALID_BLOCKMAP_LINEDEF_INDEX,
+    D2K_MAP_LUMP_BLOCKMAP, 0, 7, 1
+  );
+  problem_at(&problems, 2, D2K_MAP_PROBLEM_UNTERMINATED_BLOCKMAP_LINE_LIST,
+                           D2K_MAP_LUMP_BLOCKMAP,
+                           0);
+
+  /*
+   * The loader takes what the validator passes: a one-sided linedef, and
+   * a tag that's matched against sector tags rather than used as an index
+   */
+  put16(linedefs, 8, 300);
+  load_linedefs(&map, lumps[D2K_VANILLA_MAP_LUMP_LINEDEFS], 300, &status);
+  linedef = array_index_fast(&map.linedefs, 0);
+  assert_int_equal(linedef->tag, 300);
+  assert_ptr_equal(linedef->tagged_sector, array_index_fast(&map.sectors, 0));
+  assert_ptr_equal(linedef->front_side, array_index_fast(&map.sidedefs, 0));
+  assert_null(linedef->back_side);
+  d2k_map_clear(&map);
+
+  load_linedefs(&map, lumps[D2K_VANILLA_MAP_LUMP_LINEDEFS], 7, &status);
+  linedef = array_index_fast(&map.linedefs, 0);
+  assert_null(linedef->tagged_sector);
+  d2k_map_clear(&map);
+  put16(linedefs, 8, 0);
+
+  /* GL nodes stand in for missing vanilla ones */
+  array_clear(&problems);
+  put16(blockmap, 8, 6);
+  put16(blockmap, 10, 6);
+  put16(blockmap, 14, 0);
+  assert_true(d2k_map_validate_lumps(lumps, true, &problems, &status));
+  assert_int_equal(problems.len, 0);
+
+  /* Extended nodes skip the vanilla node checks */
+  memcpy(nodes, "XNOD", 4);
+  lumps[D2K_VANILLA_MAP_LUMP_NODES] = &lump_storage[7];
+  lumps[D2K_VANILLA_MAP_LUMP_SEGS]->data.len = 7;
+  assert_true(d2k_map_validate_lumps(lumps, false, &problems, &status));
+  assert_int_equal(problems.len, 0);
+
+  lumps[D2K_VANILLA_MAP_LUMP_BLOCKMAP]->data.len = 6;
+  assert_true(d2k_map_validate_lumps(lumps, false, &problems, &status));
+  assert_int_equal(problems.len, 1);
+  problem = problem_at(&problems, 0, D2K_MAP_PROBLEM_TRUNCATED_BLOCKMAP_HEADER,
+                                     D2K_MAP_LUMP_BLOCKMAP,
+                                     0);
+  assert_int_equal(problem->as.truncated_blockmap_header.lump_size, 6);
+
+  array_clear(&problems);
+  lumps[D2K_VANILLA_MAP_LUMP_BLOCKMAP]->data.len = sizeof(blockmap);
+  put16(blockmap, 4, 0xFFFE);
+  put16(blockmap, 6, 0xFFFF);
+  assert_true(d2k_map_validate_lumps(lumps, false, &problems, &status));
+  assert_int_equal(problems.len, 2);
+  problem = problem_at(&problems, 0, D2K_MAP_PROBLEM_NEGATIVE_BLOCKMAP_WIDTH,
+                                     D2K_MAP_LUMP_BLOCKMAP,
+                                     0);
+  assert_int_equal(problem->as.negative_blockmap_width.blockmap_width, -2);
+  problem = problem_at(&problems, 1, D2K_MAP_PROBLEM_NEGATIVE_BLOCKMAP_HEIGHT,
+                                     D2K_MAP_LUMP_BLOCKMAP,
+                                     0);
+  assert_int_equal(problem->as.negative_blockmap_height.blockmap_height, -1);
+
+  array_clear(&problems);
+  put16(blockmap, 4, 4);
+  put16(blockmap, 6, 4);
+  assert_true(d2k_map_validate_lumps(lumps, false, &problems, &status));
+  assert_int_equal(problems.len, 1);
+  problem = problem_at(&problems, 0,
+    D2K_MAP_PROBLEM_TRUNCATED_BLOCKMAP_LINE_LIST_DIRECTORY,
+    D2K_MAP_LUMP_BLOCKMAP,
+    0
+  );
+  assert_int_equal(
+    problem->as.truncated_blockmap_line_list_directory.block_count, 16
+  );
+
+  array_clear(&problems);
+  put16(blockmap, 4, 2);
+  put16(blockmap, 6, 1);
+  put16(blockmap, 8, 2);
+  put16(blockmap, 10, 11);
+  assert_true(d2k_map_validate_lumps(lumps, false, &problems, &status));
+  assert_int_equal(problems.len, 2);
+  problem = problem_at(&problems, 0,
+    D2K_MAP_PROBLEM_INVALID_OFFSET_IN_BLOCKMAP_DIRECTORY,
+    D2K_MAP_LUMP_BLOCKMAP,
+    0
+  );
+  assert_int_equal(problem->as.blockmap_line_list.offset, 2);
+  problem = problem_at(&problems, 1,
+    D2K_MAP_PROBLEM_INVALID_OFFSET_IN_BLOCKMAP_DIRECTORY,
+    D2K_MAP_LUMP_BLOCKMAP,
+    1
+  );
+  assert_int_equal(problem->as.blockmap_line_list.offset, 11);
+
+  array_clear(&problems);
+  set_lump(&textmap_lump, bad_text, strlen(bad_textmap));
+  assert_true(d2k_map_validate_udmf(&textmap_lump, &problems, &status));
+  assert_int_equal(problems.len, 5);
+  assert_invalid_index(&problems, 0,
+    D2K_MAP_PROBLEM_INVALID_LINEDEF_END_VERTEX_INDEX,
+    D2K_MAP_LUMP_TEXTMAP, 0, 5, 2
+  );
+  problem_at(&problems, 1, D2K_MAP_PROBLEM_TWO_SIDED_LINEDEF_MISSING_BACK_SIDE,
+                           D2K_MAP_LUMP_TEXTMAP,
+                           0);
+  assert_invalid_index(&problems, 2,
+    D2K_MAP_PROBLEM_INVALID_LINEDEF_START_VERTEX_INDEX,
+    D2K_MAP_LUMP_TEXTMAP, 1, -1, 2
+  );
+  assert_invalid_index(&problems, 3,
+    D2K_MAP_PROBLEM_INVALID_LINEDEF_BACK_SIDEDEF_INDEX,
+    D2K_MAP_LUMP_TEXTMAP, 1, 3, 1
+  );
+  assert_invalid_index(&problems, 4,
+    D2K_MAP_PROBLEM_INVALID_SIDEDEF_SECTOR_INDEX,
+    D2K_MAP_LUMP_TEXTMAP, 0, 2, 1
+  );
+
+  array_clear(&problems);
+  set_lump(&textmap_lump, bad_text, 40);
+  assert_true(d2k_map_validate_udmf(&textmap_lump, &problems, &status));
+  assert_int_equal(problems.len, 1);
+  problem = problem_at(&problems, 0, D2K_MAP_PROBLEM_UDMF_SYNTAX_ERROR,
+                                     D2K_MAP_LUMP_TEXTMAP,
+                                     0);
+  assert_true(problem->as.udmf_syntax_error.offset > 0);
+  assert_int_equal(problem->as.udmf_syntax_error.code,
+                   D2K_MAP_UDMF_SYNTAX_ERROR);
+
+  array_free(&problems);
+}
+
+/* vi: set et ts=2 sw=2: */
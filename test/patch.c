@@ -0,0 +1,137 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+#define PATCH_WIDTH   3
+#define PATCH_HEIGHT 70
+#define DEST_WIDTH    4
+#define DEST_HEIGHT  64
+
+static void put16(unsigned char *data, int value) {
+  data[0] = value & 0xFF;
+  data[1] = (value >> 8) & 0xFF;
+}
+
+static void put32(unsigned char *data, int value) {
+  put16(data, value);
+  put16(data + 2, value >> 16);
+}
+
+/*
+ * Column 0: one post covering the whole height.
+ * Column 1: two posts, the second using a tall-patch relative offset.
+ * Column 2: empty.
+ */
+static size_t build_patch(unsigned char *data) {
+  size_t pos = 8 + (PATCH_WIDTH * 4);
+
+  put16(data, PATCH_WIDTH);
+  put16(data + 2, PATCH_HEIGHT);
+  put16(data + 4, 1);
+  put16(data + 6, 2);
+
+  put32(data + 8, pos);
+  data[pos++] = 0;
+  data[pos++] = PATCH_HEIGHT;
+  data[pos++] = 0;
+  for (int i = 0; i < PATCH_HEIGHT; i++) {
+    data[pos++] = 100 + i;
+  }
+  data[pos++] = 0;
+  data[pos++] = 0xFF;
+
+  put32(data + 12, pos);
+  data[pos++] = 10;
+  data[pos++] = 5;
+  data[pos++] = 0;
+  for (int i = 0; i < 5; i++) {
+    data[pos++] = 1 + i;
+  }
+  data[pos++] = 0;
+  data[pos++] = 4; /* <= 10, so relative: 14 */
+  data[pos++] = 2;
+  data[pos++] = 0;
+  data[pos++] = 50;
+  data[pos++] = 51;
+  data[pos++] = 0;
+  data[pos++] = 0xFF;
+
+  put32(data + 16, pos);
+  data[pos++] = 0xFF;
+
+  return pos;
+}
+
+void test_patch(void **state) {
+  Status status;
+  unsigned char data[256];
+  D2KLump lump;
+  D2KPatchPosts patch_posts;
+  D2KPatchBitmap patch_bitmap;
+  uint8_t dest[DEST_WIDTH * DEST_HEIGHT];
+  uint8_t dest_mask[DEST_WIDTH * DEST_HEIGHT];
+
+  (void)state;
+
+  status_init(&status);
+
+  lump.data.data = (char *)data;
+  lump.data.len = build_patch(data);
+
+  assert_true(d2k_patch_posts_init_from_lump(&patch_posts, &lump, &status));
+  assert_int_equal(patch_posts.width, PATCH_WIDTH);
+  assert_int_equal(patch_posts.posts.len, 3);
+  assert_int_equal(d2k_patch_posts_column_start(&patch_posts, 1), 1);
+  assert_int_equal(d2k_patch_posts_column_end(&patch_posts, 1), 3);
+  assert_int_equal(
+    ((D2KPatchPost *)array_index_fast(&patch_posts.posts, 2))->top,
+    14
+  );
+  assert_true(d2k_patch_bitmap_init_from_posts(&patch_bitmap, &patch_posts,
+                                                              &status));
+  d2k_patch_posts_free(&patch_posts);
+
+  assert_int_equal(patch_bitmap.height, PATCH_HEIGHT);
+  assert_int_equal(patch_bitmap.left_offset, 1);
+  assert_int_equal(patch_bitmap.top_offset, 2);
+
+  memset(dest, 7, sizeof(dest));
+  memset(dest_mask, 0, sizeof(dest_mask));
+
+  d2k_patch_bitmap_blit(&patch_bitmap, dest, dest_mask, DEST_WIDTH,
+                                                        DEST_HEIGHT,
+                                                        1,
+                                                        -3);
+
+  for (int y = 0; y < DEST_HEIGHT; y++) {
+    assert_int_equal(dest[y], 7);
+    assert_int_equal(dest[DEST_HEIGHT + y], 100 + y + 3);
+    assert_int_equal(dest_mask[DEST_HEIGHT + y], 0xFF);
+    assert_int_equal(dest[(3 * DEST_HEIGHT) + y], 7);
+    assert_int_equal(dest_mask[(3 * DEST_HEIGHT) + y], 0);
+  }
+
+  for (int y = 0; y < DEST_HEIGHT; y++) {
+    uint8_t expected = 7;
+
+    /* The second post starts at row 14 and overwrites the first's last */
+    if (y >= 7 && y <= 10) {
+      expected = 1 + (y - 7);
+    }
+    else if (y == 11 || y == 12) {
+      expected = 50 + (y - 11);
+    }
+
+    assert_int_equal(dest[(2 * DEST_HEIGHT) + y], expected);
+  }
+
+  d2k_patch_bitmap_free(&patch_bitmap);
+
+  lump.data.len = 6;
+  assert_false(d2k_patch_posts_init_from_lump(&patch_posts, &lump, &status));
+}
+
+/* vi: set et ts=2 sw=2: */
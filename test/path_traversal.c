@@ -0,0 +1,133 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+#define GRID_WIDTH  4
+#define GRID_HEIGHT 4
+
+#define map_coord(n) d2k_int_to_fixed_point(n)
+
+typedef struct HitStruct {
+  D2KLinedef *line;
+  size_t      lines_passed;
+} Hit;
+
+static bool stop_at_solid_line(D2KPathTraversal *traversal,
+                               D2KIntercept *intercept,
+                               void *data) {
+  Hit *hit = data;
+
+  (void)traversal;
+
+  assert_int_equal(intercept->type, D2K_INTERCEPT_LINE);
+
+  if (!(intercept->d.line->flags & D2K_LINEDEF_FLAG_TWO_SIDED)) {
+    hit->line = intercept->d.line;
+    return false;
+  }
+
+  hit->lines_passed++;
+
+  return true;
+}
+
+void test_path_traversal(void **state) {
+  Status status;
+  GridMap grid;
+  D2KPathTraversal traversal;
+  Hit hit;
+
+  (void)state;
+
+  status_init(&status);
+
+  assert_true(grid_map_init(&grid, GRID_WIDTH, GRID_HEIGHT, &status));
+  assert_true(d2k_path_traversal_init(&traversal, &grid.map, &status));
+
+  /* Straight along row 0: crosses the three interior column edges */
+  assert_true(d2k_path_traversal_collect(&traversal,
+    map_coord(64), map_coord(64), map_coord(448), map_coord(64),
+    D2K_PATH_TRAVERSE_ADD_LINES
+  ));
+  assert_int_equal(d2k_path_traversal_intercept_count(&traversal), 3);
+  for (size_t i = 0; i < 3; i++) {
+    D2KIntercept *intercept = d2k_path_traversal_intercept(&traversal, i);
+
+    assert_ptr_equal(intercept->d.line,
+                     grid_map_vertical_line(&grid, i + 1, 0));
+    assert_in_range(
+      intercept->frac,
+      (((2 * i) + 1) * FRACUNIT / 6) - 2,
+      (((2 * i) + 1) * FRACUNIT / 6) + 2
+    );
+  }
+
+  /* Backwards and diagonally: still sorted from the start of the trace */
+  assert_true(d2k_path_traversal_collect(&traversal,
+    map_coord(448), map_coord(320), map_coord(64), map_coord(64),
+    D2K_PATH_TRAVERSE_ADD_LINES
+  ));
+  assert_int_equal(d2k_path_traversal_intercept_count(&traversal), 5);
+  assert_ptr_equal(d2k_path_traversal_intercept(&traversal, 0)->d.line,
+                   grid_map_vertical_line(&grid, 3, 2));
+  for (size_t i = 1; i < 5; i++) {
+    assert_true(d2k_path_traversal_intercept(&traversal, i - 1)->frac <=
+                d2k_path_traversal_intercept(&traversal, i)->frac);
+  }
+
+  /* Nothing to collect unless asked */
+  assert_true(d2k_path_traversal_collect(&traversal,
+    map_coord(64), map_coord(64), map_coord(448), map_coord(64), 0
+  ));
+  assert_int_equal(d2k_path_traversal_intercept_count(&traversal), 0);
+
+  /* A hitscan stopping at the first solid line */
+  grid_map_vertical_line(&grid, 2, 0)->flags &= ~D2K_LINEDEF_FLAG_TWO_SIDED;
+  grid_map_vertical_line(&grid, 2, 0)->back_side = NULL;
+
+  memset(&hit, 0, sizeof(Hit));
+  assert_false(d2k_path_traverse(&traversal,
+    map_coord(64), map_coord(64), map_coord(448), map_coord(64),
+    D2K_PATH_TRAVERSE_ADD_LINES,
+    stop_at_solid_line,
+    &hit
+  ));
+  assert_ptr_equal(hit.line, grid_map_vertical_line(&grid, 2, 0));
+  assert_int_equal(hit.lines_passed, 1);
+
+  /* Going the other way it's the last line crossed */
+  memset(&hit, 0, sizeof(Hit));
+  assert_false(d2k_path_traverse(&traversal,
+    map_coord(448), map_coord(64), map_coord(64), map_coord(64),
+    D2K_PATH_TRAVERSE_ADD_LINES,
+    stop_at_solid_line,
+    &hit
+  ));
+  assert_ptr_equal(hit.line, grid_map_vertical_line(&grid, 2, 0));
+  assert_int_equal(hit.lines_passed, 1);
+
+  /* Traces that miss it run to the end */
+  memset(&hit, 0, sizeof(Hit));
+  assert_true(d2k_path_traverse(&traversal,
+    map_coord(64), map_coord(192), map_coord(448), map_coord(192),
+    D2K_PATH_TRAVERSE_ADD_LINES,
+    stop_at_solid_line,
+    &hit
+  ));
+  assert_null(hit.line);
+  assert_int_equal(hit.lines_passed, 3);
+
+  /* The early out bails as soon as a one-sided line is collected */
+  assert_false(d2k_path_traversal_collect(&traversal,
+    map_coord(64), map_coord(64), map_coord(448), map_coord(64),
+    D2K_PATH_TRAVERSE_ADD_LINES | D2K_PATH_TRAVERSE_EARLY_OUT
+  ));
+
+  d2k_path_traversal_free(&traversal);
+  grid_map_free(&grid);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,143 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+#define GRID_WIDTH  4
+#define GRID_HEIGHT 4
+
+static void set_reject(GridMap *grid, size_t looker_sector,
+                                      size_t target_sector,
+                                      bool rejected) {
+  size_t bit = d2k_map_reject_bit(&grid->map, looker_sector, target_sector);
+  uint8_t *byte = array_index_fast(&grid->map.reject, bit >> 3);
+
+  if (rejected) {
+    *byte |= (1 << (bit & 7));
+  }
+  else {
+    *byte &= ~(1 << (bit & 7));
+  }
+}
+
+static bool can_see(D2KSight *sight, GridMap *grid, size_t x1, size_t y1,
+                                                    size_t x2, size_t y2) {
+  D2KSightActor looker;
+  D2KSightActor target;
+
+  grid_map_place_actor(grid, &looker, x1, y1);
+  grid_map_place_actor(grid, &target, x2, y2);
+
+  return d2k_sight_check(sight, &looker, &target);
+}
+
+void test_sight(void **state) {
+  Status status;
+  GridMap grid;
+  D2KSight sight;
+  D2KSightActor lookers[GRID_WIDTH * GRID_HEIGHT];
+  bool results[GRID_WIDTH * GRID_HEIGHT];
+  D2KSightActor target;
+  D2KDivline flat_line = {0, 64 * FRACUNIT, FRACUNIT, 0};
+
+  (void)state;
+
+  /* Vanilla's on-the-line test for horizontal lines compares x to y */
+  assert_int_equal(d2k_divline_side(&flat_line, 64 * FRACUNIT, 0), 2);
+  assert_int_equal(d2k_divline_side(&flat_line, 0, 64 * FRACUNIT), 0);
+  assert_int_equal(d2k_divline_side(&flat_line, 0, 128 * FRACUNIT), 1);
+
+  status_init(&status);
+
+  assert_true(grid_map_init(&grid, GRID_WIDTH, GRID_HEIGHT, &status));
+  assert_true(d2k_sight_init(&sight, &grid.map, &status));
+
+  for (size_t y = 0; y < GRID_HEIGHT; y++) {
+    for (size_t x = 0; x < GRID_WIDTH; x++) {
+      D2KSightActor actor;
+
+      grid_map_place_actor(&grid, &actor, x, y);
+      assert_ptr_equal(actor.subsector->sector, grid_map_sector(&grid, x, y));
+    }
+  }
+
+  /* Open grid */
+  assert_true(can_see(&sight, &grid, 0, 0, 3, 3));
+  assert_true(can_see(&sight, &grid, 3, 0, 0, 2));
+  assert_true(can_see(&sight, &grid, 1, 1, 1, 1));
+
+  /* REJECT is one-way */
+  set_reject(&grid, 0, 15, true);
+  assert_false(can_see(&sight, &grid, 0, 0, 3, 3));
+  assert_true(can_see(&sight, &grid, 3, 3, 0, 0));
+  set_reject(&grid, 0, 15, false);
+  assert_true(can_see(&sight, &grid, 0, 0, 3, 3));
+
+  /* A solid wall between columns 1 and 2 */
+  for (size_t y = 0; y < GRID_HEIGHT; y++) {
+    grid_map_vertical_line(&grid, 2, y)->flags &= ~D2K_LINEDEF_FLAG_TWO_SIDED;
+  }
+  assert_false(can_see(&sight, &grid, 0, 0, 3, 0));
+  assert_false(can_see(&sight, &grid, 3, 3, 1, 0));
+  assert_true(can_see(&sight, &grid, 0, 0, 1, 3));
+  assert_true(can_see(&sight, &grid, 2, 0, 3, 3));
+  for (size_t y = 0; y < GRID_HEIGHT; y++) {
+    grid_map_vertical_line(&grid, 2, y)->flags |= D2K_LINEDEF_FLAG_TWO_SIDED;
+  }
+
+  /* A closed door */
+  grid_map_sector(&grid, 1, 0)->ceiling_height = 0;
+  assert_false(can_see(&sight, &grid, 0, 0, 2, 0));
+  grid_map_sector(&grid, 1, 0)->ceiling_height = d2k_int_to_fixed_point(128);
+
+  /* A ledge: too high to see over, then low enough */
+  grid_map_sector(&grid, 1, 0)->floor_height = d2k_int_to_fixed_point(100);
+  assert_false(can_see(&sight, &grid, 0, 0, 2, 0));
+  grid_map_sector(&grid, 1, 0)->floor_height = d2k_int_to_fixed_point(24);
+  assert_true(can_see(&sight, &grid, 0, 0, 2, 0));
+
+  /* Batches agree with single checks */
+  grid_map_sector(&grid, 1, 0)->floor_height = d2k_int_to_fixed_point(100);
+  grid_map_horizontal_line(&grid, 2, 2)->flags &= ~D2K_LINEDEF_FLAG_TWO_SIDED;
+  grid_map_place_actor(&grid, &target, 2, 1);
+
+  for (size_t y = 0; y < GRID_HEIGHT; y++) {
+    for (size_t x = 0; x < GRID_WIDTH; x++) {
+      grid_map_place_actor(&grid, &lookers[(y * GRID_WIDTH) + x], x, y);
+    }
+  }
+
+  d2k_sight_check_many(&sight, lookers, GRID_WIDTH * GRID_HEIGHT, &target,
+                                                                  results);
+
+  for (size_t i = 0; i < GRID_WIDTH * GRID_HEIGHT; i++) {
+    assert_int_equal(results[i], d2k_sight_check(&sight, &lookers[i],
+                                                         &target));
+  }
+
+  assert_false(results[0]);  /* Over the ledge at (1, 0) */
+  assert_false(results[14]); /* Through the wall below (2, 2) */
+  assert_true(results[6]);   /* Same subsector */
+  assert_true(results[4]);
+
+  d2k_sight_free(&sight);
+  grid_map_free(&grid);
+
+  /*
+   * A solid wall split across rows 0 to 2: the trace only crosses its middle
+   * seg, after passing the bottom one in the looker's own subsector.
+   */
+  assert_true(grid_map_init(&grid, GRID_WIDTH, GRID_HEIGHT, &status));
+  assert_true(grid_map_split_vertical_line(&grid, 1, 0, 3, &status));
+  grid_map_vertical_line(&grid, 1, 0)->flags &= ~D2K_LINEDEF_FLAG_TWO_SIDED;
+  assert_true(d2k_sight_init(&sight, &grid.map, &status));
+  assert_false(can_see(&sight, &grid, 0, 0, 1, 2));
+  assert_false(can_see(&sight, &grid, 1, 2, 0, 0));
+  assert_true(can_see(&sight, &grid, 0, 3, 1, 3));
+  d2k_sight_free(&sight);
+  grid_map_free(&grid);
+}
+
+/* vi: set et ts=2 sw=2: */
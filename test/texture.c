@@ -0,0 +1,255 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+#include "d2k_test.h"
+
+#include <cmocka.h>
+
+#define MAX_LUMPS 4
+
+typedef struct {
+  const char    *name;
+  unsigned char *data;
+  size_t         len;
+} TestLump;
+
+static void put16(unsigned char *data, int value) {
+  data[0] = value & 0xFF;
+  data[1] = (value >> 8) & 0xFF;
+}
+
+static void put32(unsigned char *data, int value) {
+  put16(data, value);
+  put16(data + 2, value >> 16);
+}
+
+static void build_wad(Buffer *buffer, TestLump *lumps, size_t lump_count) {
+  size_t pos = 12;
+
+  buffer->len = 0;
+  memcpy(buffer->data, "IWAD", 4);
+  put32((unsigned char *)buffer->data + 4, lump_count);
+
+  for (size_t i = 0; i < lump_count; i++) {
+    memcpy(buffer->data + pos, lumps[i].data, lumps[i].len);
+    pos += lumps[i].len;
+  }
+
+  /* The info table has to start at 28 or later */
+  pos = pos < 28 ? 28 : pos;
+  put32((unsigned char *)buffer->data + 8, pos);
+
+  for (size_t i = 0, data_pos = 12; i < lump_count; i++) {
+    put32((unsigned char *)buffer->data + pos, data_pos);
+    put32((unsigned char *)buffer->data + pos + 4, lumps[i].len);
+    memset(buffer->data + pos + 8, 0, 8);
+    memcpy(buffer->data + pos + 8, lumps[i].name, strlen(lumps[i].name));
+    data_pos += lumps[i].len;
+    pos += 16;
+  }
+
+  buffer->len = pos;
+}
+
+/* A 2x2 patch: column 0 is 1, 2 and column 1 is 3, 4 */
+static size_t build_patch(unsigned char *data) {
+  size_t pos = 16;
+
+  put16(data, 2);
+  put16(data + 2, 2);
+  put16(data + 4, 0);
+  put16(data + 6, 0);
+
+  for (int column = 0; column < 2; column++) {
+    put32(data + 8 + (column * 4), pos);
+    data[pos++] = 0;
+    data[pos++] = 2;
+    data[pos++] = 0;
+    data[pos++] = 1 + (column * 2);
+    data[pos++] = 2 + (column * 2);
+    data[pos++] = 0;
+    data[pos++] = 0xFF;
+  }
+
+  return pos;
+}
+
+static size_t build_texture1(unsigned char *data, short width,
+                                                  short height,
+                                                  short patch) {
+  memset(data, 0, 40);
+  put32(data, 1);
+  put32(data + 4, 8);
+  memcpy(data + 8, "STARTAN", 7);
+  put16(data + 8 + 12, width);
+  put16(data + 8 + 14, height);
+  put16(data + 8 + 20, 1);
+  put16(data + 8 + 26, patch);
+
+  return 8 + 22 + 10;
+}
+
+static void load(D2KWad *wad, D2KLumpDirectory *lump_directory,
+                              PArray *wads,
+                              Buffer *buffer,
+                              TestLump *lumps,
+                              size_t lump_count) {
+  Status status;
+
+  status_init(&status);
+  build_wad(buffer, lumps, lump_count);
+
+  assert_true(d2k_wad_init_from_data(wad, D2K_WAD_SOURCE_IWAD, buffer,
+                                                               &status));
+  parray_clear(wads);
+  assert_true(parray_append(wads, (void *)wad, &status));
+  assert_true(d2k_lump_directory_init(lump_directory, wads, &status));
+}
+
+static void unload(D2KWad *wad, D2KLumpDirectory *lump_directory) {
+  Status status;
+
+  status_init(&status);
+  d2k_lump_directory_free(lump_directory, &status);
+  array_free(&wad->lumps);
+  buffer_free(&wad->data);
+}
+
+void test_texture(void **state) {
+  Status status;
+  Buffer buffer;
+  PArray wads;
+  D2KWad wad;
+  D2KLumpDirectory lump_directory;
+  D2KLump *lump = NULL;
+  D2KTexture *texture = NULL;
+  D2KTextureTable *texture_table = NULL;
+  D2KTextureComposite *composite = NULL;
+  const uint8_t *pixels = NULL;
+  const uint8_t *mask = NULL;
+  unsigned char pnames[12];
+  unsigned char texture1[64];
+  unsigned char patch[64];
+  TestLump lumps[MAX_LUMPS] = {
+    { "PNAMES",   pnames,   sizeof(pnames) },
+    { "TEXTURE1", texture1, 0              },
+    { "WALL",     patch,    0              },
+  };
+
+  (void)state;
+
+  status_init(&status);
+  parray_init(&wads);
+  assert_true(buffer_init_alloc(&buffer, 512, &status));
+
+  put32(pnames, 1);
+  memcpy(pnames + 4, "wall\0\0\0\0", 8);
+  lumps[1].len = build_texture1(texture1, 2, 2, 0);
+  lumps[2].len = build_patch(patch);
+
+  load(&wad, &lump_directory, &wads, &buffer, lumps, 3);
+
+  assert_true(d2k_lump_directory_lookup(&lump_directory, "WALL", &lump,
+                                                                 &status));
+  assert_ptr_equal(lump->data.data, wad.data.data + 12 + sizeof(pnames) +
+                                                         lumps[1].len);
+
+  assert_false(d2k_lump_directory_lookup(&lump_directory, "NOPE", &lump,
+                                                                  &status));
+  assert_true(status_match(&status, "base", ERROR_NOT_FOUND));
+  status_clear(&status);
+
+  /* Names are matched case-insensitively */
+  assert_true(d2k_lump_directory_lookup_texture(&lump_directory, "startan",
+                                                                 &texture,
+                                                                 &status));
+  assert_string_equal(texture->name, "STARTAN");
+  assert_int_equal(texture->width, 2);
+  assert_int_equal(texture->height, 2);
+  assert_int_equal(texture->width_mask, 1);
+
+  /* "-" is always texture 0 */
+  texture = NULL;
+  assert_true(d2k_lump_directory_lookup_texture(&lump_directory, "-",
+                                                                 &texture,
+                                                                 &status));
+  assert_int_equal(texture->index, 0);
+
+  assert_false(d2k_lump_directory_lookup_texture(&lump_directory, "NOPE",
+                                                                  &texture,
+                                                                  &status));
+  assert_true(status_match(&status, "d2k_texture", D2K_TEXTURE_NOT_FOUND));
+  status_clear(&status);
+
+  /* Columns wrap, so -1 is the last one */
+  assert_true(d2k_texture_table_get_column(
+    lump_directory.texture_table, 0, -1, &pixels, &mask, &status
+  ));
+  assert_int_equal(pixels[0], 3);
+  assert_int_equal(pixels[1], 4);
+  assert_true(mask[0] && mask[1]);
+
+  /* The decoded patch counts against the budget, and goes first */
+  texture_table = lump_directory.texture_table;
+  composite = array_index_fast(&texture_table->composites, 0);
+  assert_int_equal(texture_table->cache_size, 16);
+  d2k_texture_table_set_cache_budget(texture_table, 8);
+  assert_int_equal(texture_table->cache_size, 8);
+  assert_non_null(composite->pixels);
+  d2k_texture_table_set_cache_budget(texture_table, 0);
+  assert_int_equal(texture_table->cache_size, 0);
+  assert_null(composite->pixels);
+
+  /* Building over budget still drops the patches it decoded */
+  assert_true(d2k_texture_table_get_composite(texture_table, 0, &composite,
+                                                                &status));
+  assert_int_equal(texture_table->cache_size, 8);
+
+  unload(&wad, &lump_directory);
+
+  /* A negative size is rejected, and the partial table is freed cleanly */
+  lumps[1].len = build_texture1(texture1, -2, 2, 0);
+  load(&wad, &lump_directory, &wads, &buffer, lumps, 3);
+  assert_false(d2k_lump_directory_lookup_texture(&lump_directory, "STARTAN",
+                                                                  &texture,
+                                                                  &status));
+  assert_true(status_match(&status, "d2k_texture",
+                                    D2K_TEXTURE_MALFORMED_TEXTURE_LUMP));
+  status_clear(&status);
+  unload(&wad, &lump_directory);
+
+  lumps[1].len = build_texture1(texture1, 2, 2, 1);
+  load(&wad, &lump_directory, &wads, &buffer, lumps, 3);
+  assert_false(d2k_lump_directory_lookup_texture(&lump_directory, "STARTAN",
+                                                                  &texture,
+                                                                  &status));
+  assert_true(status_match(&status, "d2k_texture",
+                                    D2K_TEXTURE_INVALID_PATCH_INDEX));
+  status_clear(&status);
+  unload(&wad, &lump_directory);
+
+  /* Truncated: the texture's offset points past the end of the lump */
+  lumps[1].len = 8;
+  load(&wad, &lump_directory, &wads, &buffer, lumps, 3);
+  assert_false(d2k_lump_directory_lookup_texture(&lump_directory, "STARTAN",
+                                                                  &texture,
+                                                                  &status));
+  assert_true(status_match(&status, "d2k_texture",
+                                    D2K_TEXTURE_MALFORMED_TEXTURE_LUMP));
+  status_clear(&status);
+  unload(&wad, &lump_directory);
+
+  load(&wad, &lump_directory, &wads, &buffer, &lumps[1], 2);
+  assert_false(d2k_lump_directory_lookup_texture(&lump_directory, "STARTAN",
+                                                                  &texture,
+                                                                  &status));
+  assert_true(status_match(&status, "d2k_texture",
+                                    D2K_TEXTURE_MISSING_PNAMES_LUMP));
+  status_clear(&status);
+  unload(&wad, &lump_directory);
+
+  parray_free(&wads);
+  buffer_free(&buffer);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -0,0 +1,108 @@
+#include <setjmp.h>
+
+#include "d2k.h"
+
+#include <cmocka.h>
+
+typedef struct {
+  D2KThinker thinker;
+  int        think_count;
+} TestMover;
+
+typedef struct {
+  D2KThinker thinker;
+  int        think_count;
+  char       payload[100];
+} TestActor;
+
+static void think(TestMover *mover) {
+  mover->think_count++;
+}
+
+void test_thinker(void **state) {
+  Status status;
+  D2KThinkerRuntime runtime;
+  D2KThinkerIterator iterator;
+  size_t movers;
+  size_t actors;
+  TestMover *first = NULL;
+  TestMover *mover = NULL;
+  TestActor *actor = NULL;
+  size_t count = 0;
+
+  (void)state;
+
+  status_init(&status);
+  d2k_thinker_runtime_init(&runtime);
+
+  assert_true(d2k_thinker_runtime_add_class(&runtime, sizeof(TestMover),
+                                                      &movers,
+                                                      &status));
+  assert_true(d2k_thinker_runtime_add_class(&runtime, sizeof(TestActor),
+                                                      &actors,
+                                                      &status));
+  assert_false(d2k_thinker_runtime_add_class(&runtime, 1, &actors, &status));
+  assert_false(d2k_thinker_runtime_spawn(&runtime, 7, (void **)&mover,
+                                                      &status));
+
+  /* Enough to need more than one chunk */
+  for (size_t i = 0; i < D2K_THINKER_POOL_CHUNK_SIZE + 10; i++) {
+    assert_true(d2k_thinker_runtime_spawn(&runtime, movers, (void **)&mover,
+                                                            &status));
+    mover->thinker.function = (D2KActionFunction)think;
+
+    if (!first) {
+      first = mover;
+    }
+  }
+
+  assert_true(d2k_thinker_runtime_spawn(&runtime, actors, (void **)&actor,
+                                                          &status));
+  actor->thinker.function = (D2KActionFunction)think;
+
+  d2k_thinker_runtime_run(&runtime);
+  assert_int_equal(first->think_count, 1);
+  assert_int_equal(mover->think_count, 1);
+  assert_int_equal(actor->think_count, 1);
+
+  /* Per-class iteration only sees that class, in memory order */
+  d2k_thinker_iterator_init(&iterator, &runtime, movers);
+  while ((mover = d2k_thinker_iterator_next(&iterator))) {
+    assert_int_equal(mover->thinker.pool_slot, count);
+    count++;
+  }
+  assert_int_equal(count, D2K_THINKER_POOL_CHUNK_SIZE + 10);
+
+  /* Removed thinkers stop running but stay put until they're collected */
+  first->thinker.references = 1;
+  d2k_thinker_runtime_remove(&runtime, &first->thinker);
+  d2k_thinker_runtime_remove(&runtime, &first->thinker);
+  d2k_thinker_runtime_remove(&runtime, &actor->thinker);
+  assert_true(d2k_thinker_is_removed(&runtime, &first->thinker));
+  assert_int_equal(d2k_thinker_runtime_live_count(&runtime, movers),
+                   D2K_THINKER_POOL_CHUNK_SIZE + 9);
+  assert_int_equal(d2k_thinker_runtime_live_count(&runtime, actors), 0);
+
+  d2k_thinker_runtime_run(&runtime);
+  assert_int_equal(first->think_count, 1);
+  assert_int_equal(actor->think_count, 1);
+
+  /* Still referenced, so the slot isn't recycled yet */
+  assert_true(d2k_thinker_runtime_collect(&runtime, &status));
+  assert_true(d2k_thinker_runtime_spawn(&runtime, movers, (void **)&mover,
+                                                          &status));
+  assert_true(mover != first);
+  assert_int_equal(mover->thinker.pool_slot, D2K_THINKER_POOL_CHUNK_SIZE + 10);
+
+  first->thinker.references = 0;
+  assert_true(d2k_thinker_runtime_collect(&runtime, &status));
+  assert_true(d2k_thinker_runtime_spawn(&runtime, movers, (void **)&mover,
+                                                          &status));
+  assert_ptr_equal(mover, first);
+  assert_int_equal(mover->think_count, 0);
+  assert_false(d2k_thinker_is_removed(&runtime, &mover->thinker));
+
+  d2k_thinker_runtime_free(&runtime);
+}
+
+/* vi: set et ts=2 sw=2: */
@@ -5,12 +5,50 @@
 
 #include <cmocka.h>
 
+static void free_wad(D2KWad *wad) {
+  array_free(&wad->lumps);
+  buffer_free(&wad->data);
+}
+
 void test_wad(void **state) {
   Status status;
+  SSlice lump_name;
+  Buffer lump_data;
+  D2KWad wad;
+  D2KWad copy;
+  D2KWad other;
+  char name[] = "DEHACKED";
+  char patch[] = "Patch File for DeHackEd v3.0\n";
 
   (void)state;
 
   status_init(&status);
+
+  lump_name.data = name;
+  lump_name.len = 8;
+  lump_name.byte_len = 8;
+
+  assert_true(buffer_init_alloc(&lump_data, sizeof(patch), &status));
+  buffer_append_fast(&lump_data, patch, sizeof(patch) - 1);
+
+  assert_true(d2k_wad_init_from_lump_file_data(&wad, &lump_name, &lump_data,
+                                                                 &status));
+  assert_true(wad.hash == d2k_hash(wad.data.data, wad.data.len, 0));
+
+  /* The hash follows the content, not where it was loaded from */
+  assert_true(d2k_wad_init_from_data(&copy, D2K_WAD_SOURCE_PWAD, &wad.data,
+                                                                 &status));
+  assert_true(copy.hash == wad.hash);
+
+  lump_data.data[0] = 'p';
+  assert_true(d2k_wad_init_from_lump_file_data(&other, &lump_name, &lump_data,
+                                                                  &status));
+  assert_true(other.hash != wad.hash);
+
+  free_wad(&wad);
+  free_wad(&copy);
+  free_wad(&other);
+  buffer_free(&lump_data);
 }
 
 /* vi: set et ts=2 sw=2: */
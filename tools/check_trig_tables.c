@@ -0,0 +1,344 @@
+/*****************************************************************************/
+/* D2K: A Doom Source Port for the 21st Century                              */
+/*                                                                           */
+/* Copyright (C) 2014: See COPYRIGHT file                                    */
+/*                                                                           */
+/* This file is part of D2K.                                                 */
+/*                                                                           */
+/* D2K is free software: you can redistribute it and/or modify it under the  */
+/* terms of the GNU General Public License as published by the Free Software */
+/* Foundation, either version 2 of the License, or (at your option) any      */
+/* later version.                                                            */
+/*                                                                           */
+/* D2K is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS */
+/* FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more    */
+/* details.                                                                  */
+/*                                                                           */
+/* You should have received a copy of the GNU General Public License along   */
+/* with D2K.  If not, see <http://www.gnu.org/licenses/>.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+/*
+ * Checks the built-in trig tables checked in as src/trig_tables.c.  Those
+ * have to be vanilla's tables.c data exactly, since a single entry off by one
+ * desyncs demos, so this never writes them; it only reads them back:
+ *
+ *   cc -o check_trig_tables tools/check_trig_tables.c -lm
+ *   ./check_trig_tables src/trig_tables.c [reference.wad]
+ *
+ * Every entry that differs from id's R_InitTables formulas (single-precision
+ * intermediates and all) is listed.  Vanilla's data differs from them in a
+ * few places, so the list is how to tell real tables from formula output.
+ * Given a WAD with SINETABL/TANGTABL/TANTOANG lumps (prboom-plus.wad, for
+ * example), the file is also compared with them, and any mismatch fails.
+ *
+ * This deliberately depends on nothing but libc.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define FRACBITS   16
+#define FRACUNIT   (1 << FRACBITS)
+#define FINEANGLES 8192
+#define SLOPERANGE 2048
+
+#define SINE_COUNT             (5 * FINEANGLES / 4)
+#define TANGENT_COUNT          (FINEANGLES / 2)
+#define TANGENT_TO_ANGLE_COUNT (SLOPERANGE + 1)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+typedef struct {
+  int32_t  sine[SINE_COUNT];
+  int32_t  tangent[TANGENT_COUNT];
+  uint32_t tangent_to_angle[TANGENT_TO_ANGLE_COUNT];
+} Tables;
+
+static Tables source;
+static Tables other;
+
+static void compute_tables(int32_t *sine, int32_t *tangent,
+                                          uint32_t *tangent_to_angle) {
+  for (int i = 0; i < TANGENT_COUNT; i++) {
+    float a = (i - FINEANGLES / 4 + 0.5) * M_PI * 2 / FINEANGLES;
+    float fv = FRACUNIT * tan(a);
+
+    tangent[i] = (int32_t)fv;
+  }
+
+  for (int i = 0; i < SINE_COUNT; i++) {
+    float a = (i + 0.5) * M_PI * 2 / FINEANGLES;
+
+    sine[i] = (int32_t)(FRACUNIT * sin(a));
+  }
+
+  for (int i = 0; i < TANGENT_TO_ANGLE_COUNT; i++) {
+    float f = atan((float)i / SLOPERANGE) / (3.141592657 * 2);
+
+    tangent_to_angle[i] = (uint32_t)(0xffffffff * f);
+  }
+}
+
+static size_t report_differences(const char *name,
+                                 const char *against,
+                                 const uint32_t *source_values,
+                                 const uint32_t *values,
+                                 size_t count) {
+  size_t differences = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    if (values[i] != source_values[i]) {
+      printf("%s[%zu]: %" PRId32 ", %s %" PRId32 "\n",
+        name, i, (int32_t)source_values[i], against, (int32_t)values[i]
+      );
+      differences++;
+    }
+  }
+
+  return differences;
+}
+
+static size_t compare_tables(const char *against) {
+  size_t differences = 0;
+
+  differences += report_differences("finesine", against,
+    (const uint32_t *)source.sine, (const uint32_t *)other.sine, SINE_COUNT
+  );
+  differences += report_differences("finetangent", against,
+    (const uint32_t *)source.tangent, (const uint32_t *)other.tangent,
+    TANGENT_COUNT
+  );
+  differences += report_differences("tantoangle", against,
+    source.tangent_to_angle, other.tangent_to_angle, TANGENT_TO_ANGLE_COUNT
+  );
+
+  return differences;
+}
+
+/*
+ * Reads the initializer of the table declared as `name`: integers, unsigned
+ * ones with a `u` suffix, and INT32_MIN written as (-2147483647 - 1).
+ */
+static int read_source_table(const char *text, const char *path,
+                                               const char *name,
+                                               uint32_t *dest,
+                                               size_t count) {
+  const char *p = strstr(text, name);
+  size_t i = 0;
+
+  if (p) {
+    p = strchr(p, '{');
+  }
+
+  if (!p) {
+    fprintf(stderr, "%s: no %s table\n", path, name);
+    return 0;
+  }
+
+  p++;
+
+  while (i < count) {
+    char *end;
+    long long value;
+
+    p += strspn(p, " \t\r\n,");
+
+    if (strncmp(p, "(-2147483647 - 1)", 17) == 0) {
+      dest[i++] = (uint32_t)INT32_MIN;
+      p += 17;
+      continue;
+    }
+
+    value = strtoll(p, &end, 10);
+
+    if (end == p) {
+      break;
+    }
+
+    dest[i++] = (uint32_t)value;
+    p = end + (*end == 'u');
+  }
+
+  p += strspn(p, " \t\r\n,");
+
+  if ((i != count) || (*p != '}')) {
+    fprintf(stderr, "%s: %s should have %zu entries\n", path, name, count);
+    return 0;
+  }
+
+  return 1;
+}
+
+static int read_source_tables(const char *path) {
+  FILE *file = fopen(path, "rb");
+  char *text = NULL;
+  long len;
+  int ok = 0;
+
+  if (!file) {
+    fprintf(stderr, "%s: could not open\n", path);
+    return 0;
+  }
+
+  if ((fseek(file, 0, SEEK_END) == 0) &&
+      ((len = ftell(file)) >= 0)      &&
+      (fseek(file, 0, SEEK_SET) == 0) &&
+      ((text = malloc((size_t)len + 1)) != NULL) &&
+      (fread(text, 1, (size_t)len, file) == (size_t)len)) {
+    text[len] = '\0';
+    ok = read_source_table(text, path, "d2k_finesine[",
+                           (uint32_t *)source.sine, SINE_COUNT)       &&
+         read_source_table(text, path, "d2k_finetangent[",
+                           (uint32_t *)source.tangent, TANGENT_COUNT) &&
+         read_source_table(text, path, "d2k_tantoangle[",
+                           source.tangent_to_angle,
+                           TANGENT_TO_ANGLE_COUNT);
+  }
+  else {
+    fprintf(stderr, "%s: could not read\n", path);
+  }
+
+  free(text);
+  fclose(file);
+
+  return ok;
+}
+
+static uint32_t read_le32(const unsigned char *data) {
+  return ((uint32_t)data[0])         |
+         ((uint32_t)data[1] <<  8)   |
+         ((uint32_t)data[2] << 16)   |
+         ((uint32_t)data[3] << 24);
+}
+
+static int read_lump(FILE *wad, const char *wad_path,
+                                const char *name,
+                                uint32_t *dest,
+                                size_t count) {
+  unsigned char header[12];
+  uint32_t lump_count;
+  uint32_t directory_offset;
+
+  if ((fseek(wad, 0, SEEK_SET) != 0) ||
+      (fread(header, sizeof(header), 1, wad) != 1)) {
+    fprintf(stderr, "%s: could not read WAD header\n", wad_path);
+    return 0;
+  }
+
+  lump_count = read_le32(&header[4]);
+  directory_offset = read_le32(&header[8]);
+
+  for (uint32_t i = 0; i < lump_count; i++) {
+    unsigned char entry[16];
+    unsigned char *data;
+    uint32_t offset;
+    uint32_t size;
+
+    if ((fseek(wad, (long)(directory_offset + (i * 16)), SEEK_SET) != 0) ||
+        (fread(entry, sizeof(entry), 1, wad) != 1)) {
+      fprintf(stderr, "%s: truncated lump directory\n", wad_path);
+      return 0;
+    }
+
+    if (strncmp((const char *)&entry[8], name, 8) != 0) {
+      continue;
+    }
+
+    offset = read_le32(&entry[0]);
+    size = read_le32(&entry[4]);
+
+    if (size != count * 4) {
+      fprintf(stderr, "%s: %s is %u bytes, expected %zu\n",
+        wad_path, name, size, count * 4
+      );
+      return 0;
+    }
+
+    data = malloc(size);
+
+    if ((!data) ||
+        (fseek(wad, (long)offset, SEEK_SET) != 0) ||
+        (fread(data, size, 1, wad) != 1)) {
+      fprintf(stderr, "%s: could not read %s\n", wad_path, name);
+      free(data);
+      return 0;
+    }
+
+    for (size_t j = 0; j < count; j++) {
+      dest[j] = read_le32(&data[j * 4]);
+    }
+
+    free(data);
+    return 1;
+  }
+
+  fprintf(stderr, "%s: no %s lump\n", wad_path, name);
+  return 0;
+}
+
+static int read_wad_tables(const char *wad_path, int32_t *sine,
+                                                int32_t *tangent,
+                                                uint32_t *tangent_to_angle) {
+  FILE *wad = fopen(wad_path, "rb");
+  int ok;
+
+  if (!wad) {
+    fprintf(stderr, "%s: could not open\n", wad_path);
+    return 0;
+  }
+
+  ok = read_lump(wad, wad_path, "SINETABL", (uint32_t *)sine,
+                                            SINE_COUNT)               &&
+       read_lump(wad, wad_path, "TANGTABL", (uint32_t *)tangent,
+                                            TANGENT_COUNT)            &&
+       read_lump(wad, wad_path, "TANTOANG", tangent_to_angle,
+                                            TANGENT_TO_ANGLE_COUNT);
+
+  fclose(wad);
+
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  size_t differences;
+
+  if ((argc != 2) && (argc != 3)) {
+    fprintf(stderr, "Usage: %s <trig_tables.c> [reference.wad]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!read_source_tables(argv[1])) {
+    return EXIT_FAILURE;
+  }
+
+  compute_tables(other.sine, other.tangent, other.tangent_to_angle);
+  differences = compare_tables("formula");
+  printf("%zu entries differ from the formulas\n", differences);
+
+  if (argc == 3) {
+    if (!read_wad_tables(argv[2], other.sine, other.tangent,
+                                  other.tangent_to_angle)) {
+      return EXIT_FAILURE;
+    }
+
+    differences = compare_tables(argv[2]);
+    printf("%zu entries differ from %s\n", differences, argv[2]);
+
+    if (differences) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/* vi: set et ts=2 sw=2: */